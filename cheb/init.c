@@ -23,6 +23,53 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_chebyshev.h>
+#include <gsl/gsl_fft_dct.h>
+
+/* Orders from which the coefficients are computed with a DCT-II in
+   O(n log n) rather than by direct summation in O(n^2) */
+
+#ifndef CHEB_DCT_MIN_ORDER
+#define CHEB_DCT_MIN_ORDER 32
+#endif
+
+/* c_j = 2/n sum_k f_k cos(pi j (k+1/2)/n) is 1/n times the DCT-II of f
+   with n = order + 1. The DCT workspace, with its wavetables, is
+   allocated and freed on each call; the series struct is public, so
+   it has no room to keep one. This costs O(n) memory and time, which
+   is small beside the n function evaluations. Since n is at least one
+   the workspace can only fail for lack of memory, which has then been
+   reported through the error handler and is returned to the caller. */
+
+static int
+cheb_init_dct (gsl_cheb_series * cs)
+{
+  const size_t n = cs->order + 1;
+  gsl_fft_dct_workspace * w;
+  size_t j;
+  int status;
+
+  w = gsl_fft_dct_workspace_alloc (GSL_FFT_DCT_II, n);
+
+  if (w == 0)
+    {
+      return GSL_ENOMEM;
+    }
+
+  for (j = 0; j < n; j++)
+    {
+      cs->c[j] = cs->f[j];
+    }
+
+  status = gsl_fft_dct_transform (cs->c, 1, n, w);
+  gsl_fft_dct_workspace_free (w);
+
+  for (j = 0; j < n; j++)
+    {
+      cs->c[j] /= n;
+    }
+
+  return status;
+}
 
 /*-*-*-*-*-*-*-*-*-*-*-* Allocators *-*-*-*-*-*-*-*-*-*-*-*/
 
@@ -86,6 +133,10 @@ int gsl_cheb_init(gsl_cheb_series * cs, const gsl_function *func,
       cs->f[k] = GSL_FN_EVAL(func, (y*bma + bpa));
     }
     
+    if(cs->order >= CHEB_DCT_MIN_ORDER) {
+      return cheb_init_dct(cs);
+    }
+
     for(j = 0; j<=cs->order; j++) {
       double sum = 0.0;
       for(k = 0; k<=cs->order; k++) 
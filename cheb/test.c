@@ -108,6 +108,32 @@ test_dim (const size_t n, const double a, const double b,
   gsl_cheb_free(cs);
 }
 
+/* compare the coefficients of a high order series, computed with a
+   DCT, against the direct sum */
+
+void
+test_order (const size_t order, gsl_function * F, const double a,
+            const double b)
+{
+  gsl_cheb_series * cs = gsl_cheb_alloc(order);
+  const double n = order + 1.0;
+  size_t j, k;
+
+  gsl_cheb_init(cs, F, a, b);
+
+  for (j = 0; j <= order; j++)
+    {
+      double sum = 0.0;
+      for (k = 0; k <= order; k++)
+        sum += cs->f[k] * cos(M_PI * j * (k + 0.5) / n);
+      gsl_test_abs (cs->c[j], 2.0 * sum / n, 1e-13,
+                    "gsl_cheb_init, order %u, c[%u]",
+                    (unsigned int) order, (unsigned int) j);
+    }
+
+  gsl_cheb_free(cs);
+}
+
 int 
 main(void)
 {
@@ -293,5 +319,10 @@ main(void)
   test_dim (2, -5.0, 5.0, &F_P, &F_DP, &F_IP2);
   test_dim (1, -5.0, 5.0, &F_P, &F_DP, &F_IP1);
 
+  /* Test orders using the fast transform */
+  test_order (32, &F_sin, -M_PI, M_PI);
+  test_order (255, &F_sin, -M_PI, M_PI);
+  test_order (1000, &F_sin, -M_PI, M_PI);
+
   exit (gsl_test_summary());
 }
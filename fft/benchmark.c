@@ -1,155 +1,305 @@
 /* fft/benchmark.c
- * 
+ *
  * Copyright (C) 1996, 1997, 1998, 1999, 2000, 2007 Brian Gough
- * 
+ *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
  * the Free Software Foundation; either version 3 of the License, or (at
  * your option) any later version.
- * 
+ *
  * This program is distributed in the hope that it will be useful, but
  * WITHOUT ANY WARRANTY; without even the implied warranty of
  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
  * General Public License for more details.
- * 
+ *
  * You should have received a copy of the GNU General Public License
  * along with this program; if not, write to the Free Software
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+/* Usage: benchmark [-m max_n] [-r samples] [-t nthreads] [-v variant]
+
+   Times the fft routines for lengths up to max_n (default 2^20) which
+   are powers of 2, products of 2, 3, 5 and 7 (smooth), and primes,
+   and prints the results as comma separated values with the columns
+
+     variant,class,n,median_us,min_us,mflops
+
+   Each variant is run once to warm up, then calibrated so that a
+   sample takes at least 10 ms, and the time per transform is the
+   median of the samples (default 9). mflops is the conventional
+   normalized rate 5 n log2(n) / t, with t the median in microseconds,
+   for complex data and half that for real data, so that it can be
+   compared across lengths, algorithms and releases. nthreads is passed to
+   gsl_fft_complex_workspace_set_threads(). The -v option selects a
+   single variant. Build with "make benchmark". */
+
 #include <config.h>
 #include <stddef.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
-#include <float.h>
-
 #include <time.h>
 
-#include <gsl/gsl_complex.h>
-#include <gsl/gsl_fft_complex.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
 
 #include <gsl/gsl_errno.h>
+#include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_fft_complex_float.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_real_float.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+#include <gsl/gsl_fft_halfcomplex_float.h>
 
-#include "complex_internal.h"
-#include "bitreverse.h"
 #include "urand.c"
 
-void my_error_handler (const char *reason, const char *file,
-                       int line, int err);
+typedef struct
+  {
+    size_t n;
+    void * data;
+    void * wavetable;
+    void * hc_wavetable;
+    void * work;
+  }
+bench_state;
 
-int
-main (int argc, char *argv[])
+#define BASE_DOUBLE
+#include "templates_on.h"
+#include "benchmark_source.c"
+#include "templates_off.h"
+#undef  BASE_DOUBLE
+
+#define BASE_FLOAT
+#include "templates_on.h"
+#include "benchmark_source.c"
+#include "templates_off.h"
+#undef  BASE_FLOAT
+
+typedef struct
+  {
+    const char * name;
+    int real;          /* flops are counted as half those of complex data */
+    int pow2;          /* only for powers of 2 */
+    int (*alloc) (bench_state * s, size_t nthreads);
+    int (*run) (bench_state * s);
+    void (*free) (bench_state * s);
+  }
+bench_variant;
+
+static const bench_variant variants[] =
+  {
+    { "complex", 0, 0, bench_complex_alloc, bench_complex_run, bench_complex_free },
+    { "complex_float", 0, 0, bench_complex_float_alloc, bench_complex_float_run, bench_complex_float_free },
+    { "radix2", 0, 1, bench_radix2_alloc, bench_radix2_run, bench_radix2_free },
+    { "radix2_float", 0, 1, bench_radix2_float_alloc, bench_radix2_float_run, bench_radix2_float_free },
+    { "real", 1, 0, bench_real_alloc, bench_real_run, bench_real_free },
+    { "real_float", 1, 0, bench_real_float_alloc, bench_real_float_run, bench_real_float_free },
+    { "real_radix2", 1, 1, bench_real_radix2_alloc, bench_real_radix2_run, bench_real_radix2_free },
+    { "real_radix2_float", 1, 1, bench_real_radix2_float_alloc, bench_real_radix2_float_run, bench_real_radix2_float_free },
+    { NULL, 0, 0, NULL, NULL, NULL }
+  };
+
+/* the smooth lengths of the benchFFT suite */
+
+static const size_t smooth[] =
+  {
+    6, 9, 12, 15, 18, 24, 36, 80, 108, 210, 504, 1000, 1960, 4725, 10368,
+    27000, 75600, 165375, 362880, 1000000, 0
+  };
+
+#define BENCH_MIN_TIME 0.01
+
+/* wall clock time in seconds, or processor time where there is no
+   monotonic clock */
+
+static double
+bench_clock (void)
 {
-  double *data, *fft_data;
-  gsl_fft_complex_wavetable * cw;
-  unsigned int i, logn;
-  int result;
-  int status;
-  clock_t start, end;
-  int resolution = CLOCKS_PER_SEC;
-  unsigned int n = 1;
+#if defined(_POSIX_TIMERS) && (_POSIX_TIMERS > 0) && defined(CLOCK_MONOTONIC)
+  struct timespec t;
+  clock_gettime (CLOCK_MONOTONIC, &t);
+  return t.tv_sec + 1e-9 * t.tv_nsec;
+#else
+  return clock () / (double) CLOCKS_PER_SEC;
+#endif
+}
 
-  gsl_set_error_handler (&my_error_handler);
+static int
+bench_compare (const void * a, const void * b)
+{
+  const double x = *(const double *) a;
+  const double y = *(const double *) b;
 
-  if (argc == 2)
-    {
-      n = strtol (argv[1], NULL, 0);
-    }
-  else
+  return (x > y) - (x < y);
+}
+
+static int
+bench_is_prime (size_t n)
+{
+  size_t f;
+
+  for (f = 2; f * f <= n; f++)
     {
-      printf ("test n\n");
-      exit (EXIT_FAILURE);
+      if (n % f == 0)
+        {
+          return 0;
+        }
     }
 
-  cw = gsl_fft_complex_wavetable_alloc (n);
-  cwork = gsl_fft_complex_wavetable_workspace_alloc (n);
-  status = gsl_fft_complex_init (n, cw, cwork);
-  status = gsl_fft_complex_generate (n, cw, cwork);
+  return n > 1;
+}
+
+static void
+bench_run (const bench_variant * v, const char * class, size_t n,
+           size_t samples, size_t nthreads)
+{
+  bench_state s;
+  double * t = (double *) malloc (samples * sizeof (double));
+  double start, elapsed, flops;
+  size_t iters = 1, i, k;
+  int status;
 
-  data = (double *) malloc (n * 2 * sizeof (double));
-  fft_data = (double *) malloc (n * 2 * sizeof (double));
+  memset (&s, 0, sizeof (s));
+  s.n = n;
 
-  for (i = 0; i < n; i++)
+  status = (t == NULL) ? GSL_ENOMEM : v->alloc (&s, nthreads);
+
+  if (status == 0)
     {
-      REAL(data,1,i) = urand ();
-      IMAG(data,1,i) = urand ();
+      status = v->run (&s);     /* warm up */
     }
 
+  /* calibrate the number of forward and inverse pairs in a sample */
+
+  while (status == 0)
+    {
+      start = bench_clock ();
+
+      for (i = 0; i < iters && status == 0; i++)
+        {
+          status = v->run (&s);
+        }
 
-  /* compute the fft */
+      elapsed = bench_clock () - start;
 
-  memcpy (fft_data, data, n * 2 * sizeof (double));
+      if (elapsed >= BENCH_MIN_TIME)
+        {
+          break;
+        }
 
-  start = clock ();
-  i = 0;
-  do
+      iters *= 2;
+    }
+
+  for (k = 0; k < samples && status == 0; k++)
     {
-      status = gsl_fft_complex_forward (fft_data, 1, n, cw, cwork);
-      i++;
-      end = clock ();
+      start = bench_clock ();
+
+      for (i = 0; i < iters && status == 0; i++)
+        {
+          status = v->run (&s);
+        }
+
+      t[k] = (bench_clock () - start) / (2.0 * iters);
     }
-  while (end < start + resolution && status == 0);
 
   if (status == 0)
     {
-      printf ("n = %d gsl_fft_complex_forward %f seconds\n", n, (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC));
+      qsort (t, samples, sizeof (double), bench_compare);
+
+      flops = (v->real ? 2.5 : 5.0) * n * log ((double) n) / log (2.0);
+
+      printf ("%s,%s,%lu,%.4g,%.4g,%.1f\n", v->name, class,
+              (unsigned long) n, 1e6 * t[samples / 2], 1e6 * t[0],
+              flops / (1e6 * t[samples / 2]));
     }
   else
     {
-      printf ("MR fft failed\n");
+      fprintf (stderr, "benchmark: %s n = %lu failed: %s\n", v->name,
+               (unsigned long) n, gsl_strerror (status));
     }
 
+  fflush (stdout);
 
-  /* compute the fft with radix2 */
-  memcpy (fft_data, data, n * 2 * sizeof (double));
-
-  result = fft_binary_logn(n) ;
+  v->free (&s);
+  free (t);
+}
 
-  if (result == -1) {
-    exit(EXIT_SUCCESS) ;
-  } else {
-    logn = result ;
-  }
+int
+main (int argc, char *argv[])
+{
+  size_t max_n = 1048576, samples = 9, nthreads = 1;
+  const char * only = NULL;
+  const bench_variant * v;
+  size_t n, k;
+  int i;
 
-  start = clock ();
-  i = 0;
-  do
+  for (i = 1; i + 1 < argc; i += 2)
     {
-      status = gsl_fft_complex_radix2_forward (fft_data, 1, n);
-      i++;
-      end = clock ();
+      if (strcmp (argv[i], "-m") == 0)
+        max_n = strtoul (argv[i + 1], NULL, 0);
+      else if (strcmp (argv[i], "-r") == 0)
+        samples = strtoul (argv[i + 1], NULL, 0);
+      else if (strcmp (argv[i], "-t") == 0)
+        nthreads = strtoul (argv[i + 1], NULL, 0);
+      else if (strcmp (argv[i], "-v") == 0)
+        only = argv[i + 1];
+      else
+        break;
     }
-  while (end < start + resolution && status == 0);
 
-  if (status == 0)
-    {
-      printf ("n = %d gsl_fft_complex_radix2_forward %f seconds\n", n, (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC));
-    }
-  else
+  if (i != argc || max_n < 2 || samples == 0)
     {
-      printf ("fft_radix2: not a power of 2\n");
+      fprintf (stderr, "usage: benchmark [-m max_n] [-r samples] "
+               "[-t nthreads] [-v variant]\n");
+      exit (EXIT_FAILURE);
     }
 
-  start = clock ();
-  i = 0;
-  do
+  gsl_set_error_handler_off ();
+
+  printf ("variant,class,n,median_us,min_us,mflops\n");
+
+  for (v = variants; v->name != NULL; v++)
     {
-      status = fft_complex_bitreverse_order (fft_data, 1, n, logn);
-      i++;
-      end = clock ();
-    }
-  while (end < start + resolution && status == 0);
+      if (only != NULL && strcmp (only, v->name) != 0)
+        {
+          continue;
+        }
 
-  printf ("n = %d gsl_fft_complex_bitreverse_order %f seconds\n", n, (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC));
+      for (n = 2; n <= max_n; n *= 2)
+        {
+          bench_run (v, "pow2", n, samples, nthreads);
+        }
 
+      if (v->pow2)
+        {
+          continue;
+        }
 
-  return 0;
-}
+      for (k = 0; smooth[k] != 0 && smooth[k] <= max_n; k++)
+        {
+          bench_run (v, "smooth", smooth[k], samples, nthreads);
+        }
 
+      /* the first prime above each power of 2 */
 
-void
-my_error_handler (const char *reason, const char *file, int line, int err)
-{
-  printf ("error: %s in %s at %d (gsl_errno=%d)\n", reason, file, line, err);
+      for (n = 4; n < max_n; n *= 2)
+        {
+          size_t p = n + 1;
+
+          while (!bench_is_prime (p))
+            {
+              p++;
+            }
+
+          if (p <= max_n)
+            {
+              bench_run (v, "prime", p, samples, nthreads);
+            }
+        }
+    }
+
+  return 0;
 }
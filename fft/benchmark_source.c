@@ -0,0 +1,171 @@
+/* fft/benchmark_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Each variant allocates its tables and data for a length n, and runs
+   a forward transform followed by the normalized inverse, so that the
+   data stays the same size however many times it is run. */
+
+static BASE *
+FUNCTION(bench,data) (size_t size)
+{
+  BASE * data = (BASE *) malloc (size * sizeof (BASE));
+  size_t i;
+
+  if (data != NULL)
+    {
+      for (i = 0; i < size; i++)
+        {
+          data[i] = (BASE) (urand () - 0.5);
+        }
+    }
+
+  return data;
+}
+
+static int
+FUNCTION(bench_complex,alloc) (bench_state * s, size_t nthreads)
+{
+  TYPE(gsl_fft_complex_workspace) * work;
+
+  s->data = FUNCTION(bench,data) (2 * s->n);
+  s->wavetable = FUNCTION(gsl_fft_complex_wavetable,alloc) (s->n);
+  s->work = work = FUNCTION(gsl_fft_complex_workspace,alloc) (s->n);
+
+  if (s->data == NULL || s->wavetable == NULL || work == NULL)
+    {
+      return GSL_ENOMEM;
+    }
+
+  return FUNCTION(gsl_fft_complex_workspace,set_threads) (work, nthreads);
+}
+
+static int
+FUNCTION(bench_complex,run) (bench_state * s)
+{
+  int status = FUNCTION(gsl_fft_complex,forward) ((BASE *) s->data, 1, s->n,
+                                                   s->wavetable, s->work);
+  if (status)
+    {
+      return status;
+    }
+
+  return FUNCTION(gsl_fft_complex,inverse) ((BASE *) s->data, 1, s->n,
+                                            s->wavetable, s->work);
+}
+
+static void
+FUNCTION(bench_complex,free) (bench_state * s)
+{
+  FUNCTION(gsl_fft_complex_workspace,free) (s->work);
+  FUNCTION(gsl_fft_complex_wavetable,free) (s->wavetable);
+  free (s->data);
+}
+
+static int
+FUNCTION(bench_radix2,alloc) (bench_state * s, size_t nthreads)
+{
+  s->data = FUNCTION(bench,data) (2 * s->n);
+
+  return (s->data == NULL) ? GSL_ENOMEM : GSL_SUCCESS;
+}
+
+static int
+FUNCTION(bench_radix2,run) (bench_state * s)
+{
+  int status = FUNCTION(gsl_fft_complex,radix2_forward) ((BASE *) s->data, 1,
+                                                          s->n);
+  if (status)
+    {
+      return status;
+    }
+
+  return FUNCTION(gsl_fft_complex,radix2_inverse) ((BASE *) s->data, 1, s->n);
+}
+
+static void
+FUNCTION(bench_radix2,free) (bench_state * s)
+{
+  free (s->data);
+}
+
+static int
+FUNCTION(bench_real,alloc) (bench_state * s, size_t nthreads)
+{
+  s->data = FUNCTION(bench,data) (s->n);
+  s->wavetable = FUNCTION(gsl_fft_real_wavetable,alloc) (s->n);
+  s->hc_wavetable = FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (s->n);
+  s->work = FUNCTION(gsl_fft_real_workspace,alloc) (s->n);
+
+  if (s->data == NULL || s->wavetable == NULL || s->hc_wavetable == NULL
+      || s->work == NULL)
+    {
+      return GSL_ENOMEM;
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+FUNCTION(bench_real,run) (bench_state * s)
+{
+  int status = FUNCTION(gsl_fft_real,transform) ((BASE *) s->data, 1, s->n,
+                                                  s->wavetable, s->work);
+  if (status)
+    {
+      return status;
+    }
+
+  return FUNCTION(gsl_fft_halfcomplex,inverse) ((BASE *) s->data, 1, s->n,
+                                                s->hc_wavetable, s->work);
+}
+
+static void
+FUNCTION(bench_real,free) (bench_state * s)
+{
+  FUNCTION(gsl_fft_real_workspace,free) (s->work);
+  FUNCTION(gsl_fft_halfcomplex_wavetable,free) (s->hc_wavetable);
+  FUNCTION(gsl_fft_real_wavetable,free) (s->wavetable);
+  free (s->data);
+}
+
+static int
+FUNCTION(bench_real_radix2,alloc) (bench_state * s, size_t nthreads)
+{
+  s->data = FUNCTION(bench,data) (s->n);
+
+  return (s->data == NULL) ? GSL_ENOMEM : GSL_SUCCESS;
+}
+
+static int
+FUNCTION(bench_real_radix2,run) (bench_state * s)
+{
+  int status = FUNCTION(gsl_fft_real,radix2_transform) ((BASE *) s->data, 1,
+                                                         s->n);
+  if (status)
+    {
+      return status;
+    }
+
+  return FUNCTION(gsl_fft_halfcomplex,radix2_inverse) ((BASE *) s->data, 1,
+                                                       s->n);
+}
+
+static void
+FUNCTION(bench_real_radix2,free) (bench_state * s)
+{
+  free (s->data);
+}
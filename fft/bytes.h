@@ -0,0 +1,46 @@
+/* fft/bytes.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* The memory held by a wavetable, including the private Bluestein,
+   four-step and half length tables hung off it, and by a workspace,
+   including its Bluestein and per-thread scratch space, for the
+   max_bytes limit of the plan cache.  Not part of the public
+   interface. */
+
+#ifndef __FFT_BYTES_H__
+#define __FFT_BYTES_H__
+
+#include <stddef.h>
+#include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_fft_complex_float.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_real_float.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+#include <gsl/gsl_fft_halfcomplex_float.h>
+
+size_t gsl_fft_complex_wavetable_bytes (const gsl_fft_complex_wavetable * wavetable);
+size_t gsl_fft_complex_wavetable_float_bytes (const gsl_fft_complex_wavetable_float * wavetable);
+size_t gsl_fft_real_wavetable_bytes (const gsl_fft_real_wavetable * wavetable);
+size_t gsl_fft_real_wavetable_float_bytes (const gsl_fft_real_wavetable_float * wavetable);
+size_t gsl_fft_halfcomplex_wavetable_bytes (const gsl_fft_halfcomplex_wavetable * wavetable);
+size_t gsl_fft_halfcomplex_wavetable_float_bytes (const gsl_fft_halfcomplex_wavetable_float * wavetable);
+size_t gsl_fft_complex_workspace_bytes (const gsl_fft_complex_workspace * workspace);
+size_t gsl_fft_complex_workspace_float_bytes (const gsl_fft_complex_workspace_float * workspace);
+size_t gsl_fft_real_workspace_bytes (const gsl_fft_real_workspace * workspace);
+size_t gsl_fft_real_workspace_float_bytes (const gsl_fft_real_workspace_float * workspace);
+
+#endif /* __FFT_BYTES_H__ */
@@ -0,0 +1,313 @@
+/* fft/c_batch.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Batches of transforms of the same length. The sequences are taken
+   in blocks of up to w->block, and each block is gathered into an
+   interleaved buffer and transformed with a single set of passes (see
+   fft_complex_transform_interleaved in c_main.c), so the loops of each
+   pass run across the sequences of the block. This helps short
+   sequences, whose first passes have inner loops too short to
+   vectorize. The block size is chosen so that the buffer and the
+   scratch space of a thread stay in the L1 cache. Where this allows
+   fewer than FFT_BATCH_MIN_BLOCK sequences the cost of the gather and
+   scatter outweighs the gain, and the sequences are transformed one at
+   a time in place. The blocks are divided between nthreads threads. */
+
+#ifndef FFT_BATCH_BLOCK
+#define FFT_BATCH_BLOCK 16
+#endif
+
+#ifndef FFT_BATCH_MIN_BLOCK
+#define FFT_BATCH_MIN_BLOCK 8
+#endif
+
+#ifndef FFT_BATCH_BYTES
+#define FFT_BATCH_BYTES 16384
+#endif
+
+typedef struct
+  {
+    BASE * data;
+    size_t stride;
+    size_t dist;
+    size_t n;
+    size_t howmany;
+    size_t block;
+    size_t thread_size;
+    const TYPE(gsl_fft_complex_wavetable) * wavetable;
+    BASE * scratch;
+    gsl_fft_direction sign;
+  }
+TYPE(fft_complex_batch_pass);
+
+/* BASE elements of scratch space per thread: the interleaved buffer,
+   and the scratch space of the interleaved transform */
+
+static size_t
+FUNCTION(fft_complex,batch_thread_size) (const size_t n, const size_t block)
+{
+  return 4 * n * block + FUNCTION(fft_bluestein,scratch) (n);
+}
+
+static int
+FUNCTION(fft_complex,batch_blocks) (void * ctx, size_t thread, size_t begin,
+                                    size_t end)
+{
+  const TYPE(fft_complex_batch_pass) * pass = (TYPE(fft_complex_batch_pass) *) ctx;
+  const size_t n = pass->n;
+  const size_t stride = pass->stride;
+  const size_t dist = pass->dist;
+  BASE * const buf = pass->scratch + thread * pass->thread_size;
+  BASE * const scratch = buf + 2 * n * pass->block;
+  size_t s, t, j;
+
+  for (s = begin; s < end; s++)
+    {
+      const size_t t0 = s * pass->block;
+      const size_t b = GSL_MIN (pass->block, pass->howmany - t0);
+      BASE * const x = pass->data + 2 * t0 * dist;
+      int status;
+
+      if (b == 1)
+        {
+          /* a single sequence is transformed where it is */
+
+          status = FUNCTION(fft_complex,transform_interleaved) (x, stride, n, 1,
+                                                                pass->wavetable,
+                                                                buf, pass->sign);
+          if (status)
+            {
+              return status;
+            }
+
+          continue;
+        }
+
+      for (j = 0; j < n; j++)
+        {
+          for (t = 0; t < b; t++)
+            {
+              REAL(buf,1,j * b + t) = REAL(x,1,t * dist + j * stride);
+              IMAG(buf,1,j * b + t) = IMAG(x,1,t * dist + j * stride);
+            }
+        }
+
+      status = FUNCTION(fft_complex,transform_interleaved) (buf, 1, n, b,
+                                                            pass->wavetable,
+                                                            scratch,
+                                                            pass->sign);
+      if (status)
+        {
+          return status;
+        }
+
+      for (j = 0; j < n; j++)
+        {
+          for (t = 0; t < b; t++)
+            {
+              REAL(x,1,t * dist + j * stride) = REAL(buf,1,j * b + t);
+              IMAG(x,1,t * dist + j * stride) = IMAG(buf,1,j * b + t);
+            }
+        }
+    }
+
+  return 0;
+}
+
+TYPE(gsl_fft_complex_batch_workspace) *
+FUNCTION(gsl_fft_complex_batch_workspace,alloc) (size_t n)
+{
+  TYPE(gsl_fft_complex_batch_workspace) * w;
+
+  if (n == 0)
+    {
+      GSL_ERROR_VAL ("length n must be positive integer", GSL_EDOM, 0);
+    }
+
+  w = (TYPE(gsl_fft_complex_batch_workspace) *)
+    calloc (1, sizeof (TYPE(gsl_fft_complex_batch_workspace)));
+
+  if (w == NULL)
+    {
+      GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
+    }
+
+  w->n = n;
+  w->block = FFT_BATCH_BYTES / (4 * n * sizeof (BASE));
+
+  if (w->block > FFT_BATCH_BLOCK)
+    {
+      w->block = FFT_BATCH_BLOCK;
+    }
+  else if (w->block < FFT_BATCH_MIN_BLOCK)
+    {
+      w->block = 1;
+    }
+
+  if (FUNCTION(gsl_fft_complex_batch_workspace,set_threads) (w, 1))
+    {
+      free (w);
+      GSL_ERROR_VAL ("failed to allocate scratch space", GSL_ENOMEM, 0);
+    }
+
+  return w;
+}
+
+void
+FUNCTION(gsl_fft_complex_batch_workspace,free) (TYPE(gsl_fft_complex_batch_workspace) * w)
+{
+  RETURN_IF_NULL (w);
+
+  free (w->scratch);
+  free (w);
+}
+
+int
+FUNCTION(gsl_fft_complex_batch_workspace,set_threads) (TYPE(gsl_fft_complex_batch_workspace) * w,
+                                                       const size_t nthreads)
+{
+  const size_t nt = (nthreads == 0) ? 1 : nthreads;
+  const size_t thread_size = FUNCTION(fft_complex,batch_thread_size) (w->n,
+                                                                     w->block);
+
+  BASE * scratch = (BASE *) malloc (nt * thread_size * sizeof (BASE));
+
+  if (scratch == NULL)
+    {
+      GSL_ERROR ("failed to allocate thread workspaces", GSL_ENOMEM);
+    }
+
+  free (w->scratch);
+
+  w->nthreads = nt;
+  w->scratch = scratch;
+
+  return GSL_SUCCESS;
+}
+
+int
+FUNCTION(gsl_fft_complex,batch_forward) (TYPE(gsl_complex_packed_array) data,
+                                         const size_t stride,
+                                         const size_t dist,
+                                         const size_t n,
+                                         const size_t howmany,
+                                         const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                         TYPE(gsl_fft_complex_batch_workspace) * work)
+{
+  return FUNCTION(gsl_fft_complex,batch_transform) (data, stride, dist, n,
+                                                    howmany, wavetable, work,
+                                                    gsl_fft_forward);
+}
+
+int
+FUNCTION(gsl_fft_complex,batch_backward) (TYPE(gsl_complex_packed_array) data,
+                                          const size_t stride,
+                                          const size_t dist,
+                                          const size_t n,
+                                          const size_t howmany,
+                                          const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                          TYPE(gsl_fft_complex_batch_workspace) * work)
+{
+  return FUNCTION(gsl_fft_complex,batch_transform) (data, stride, dist, n,
+                                                    howmany, wavetable, work,
+                                                    gsl_fft_backward);
+}
+
+int
+FUNCTION(gsl_fft_complex,batch_inverse) (TYPE(gsl_complex_packed_array) data,
+                                         const size_t stride,
+                                         const size_t dist,
+                                         const size_t n,
+                                         const size_t howmany,
+                                         const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                         TYPE(gsl_fft_complex_batch_workspace) * work)
+{
+  int status = FUNCTION(gsl_fft_complex,batch_transform) (data, stride, dist,
+                                                          n, howmany,
+                                                          wavetable, work,
+                                                          gsl_fft_backward);
+  if (status)
+    {
+      return status;
+    }
+
+  /* normalize inverse fft with 1/n */
+
+  {
+    const ATOMIC norm = ONE / (ATOMIC) n;
+    size_t t, j;
+
+    for (t = 0; t < howmany; t++)
+      {
+        for (j = 0; j < n; j++)
+          {
+            REAL(data,1,t * dist + j * stride) *= norm;
+            IMAG(data,1,t * dist + j * stride) *= norm;
+          }
+      }
+  }
+
+  return status;
+}
+
+int
+FUNCTION(gsl_fft_complex,batch_transform) (TYPE(gsl_complex_packed_array) data,
+                                           const size_t stride,
+                                           const size_t dist,
+                                           const size_t n,
+                                           const size_t howmany,
+                                           const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                           TYPE(gsl_fft_complex_batch_workspace) * work,
+                                           const gsl_fft_direction sign)
+{
+  TYPE(fft_complex_batch_pass) pass;
+
+  if (n == 0)
+    {
+      GSL_ERROR ("length n must be positive integer", GSL_EDOM);
+    }
+
+  if (n != wavetable->n)
+    {
+      GSL_ERROR ("wavetable does not match length of data", GSL_EINVAL);
+    }
+
+  if (n != work->n)
+    {
+      GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
+    }
+
+  if (n == 1 || howmany == 0)
+    {
+      return 0;
+    }
+
+  pass.data = data;
+  pass.stride = stride;
+  pass.dist = dist;
+  pass.n = n;
+  pass.howmany = howmany;
+  pass.block = work->block;
+  pass.thread_size = FUNCTION(fft_complex,batch_thread_size) (n, work->block);
+  pass.wavetable = wavetable;
+  pass.scratch = work->scratch;
+  pass.sign = sign;
+
+  return parallel_for (work->nthreads,
+                       (howmany + work->block - 1) / work->block,
+                       FUNCTION(fft_complex,batch_blocks), &pass);
+}
@@ -0,0 +1,278 @@
+/* fft/c_bluestein.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Bluestein's algorithm for a DFT of prime length p.
+
+   Using l k = (l^2 + k^2 - (k-l)^2)/2 the forward DFT becomes
+
+     X_k = c_k sum_l (x_l c_l) conj(c_(k-l)),   c_l = exp(-i pi l^2/p)
+
+   which is a convolution. It is computed cyclically with a power of 2
+   length m >= 2p-1 using the mixed-radix routines, so that a pass of
+   prime factor p costs O(m log m) per subtransform instead of the
+   O(p^2) of the generic pass_n. The chirp c_l and the transform of
+   the convolution kernel are computed once in the wavetable. The
+   backward DFT is obtained by conjugating the input and output.
+
+   Factors larger than FFT_BLUESTEIN_MIN use this method. For smaller
+   factors the O(p^2) pass is faster, since the convolution length m is
+   up to four times p and the pass_n sums run over the contiguous
+   subtransforms together. */
+
+#ifndef FFT_BLUESTEIN_MIN
+#define FFT_BLUESTEIN_MIN 90
+#endif
+
+typedef struct
+  {
+    size_t p;
+    size_t m;
+    TYPE(gsl_complex) * chirp;     /* c_l, l = 0 .. p-1 */
+    TYPE(gsl_complex) * kernel;    /* forward DFT of conj(c), scaled by 1/m */
+    TYPE(gsl_fft_complex_wavetable) * wavetable;   /* for length m */
+  }
+TYPE(fft_bluestein);
+
+static void
+FUNCTION(fft_bluestein,free) (TYPE(fft_bluestein) * b)
+{
+  RETURN_IF_NULL (b);
+
+  FUNCTION(gsl_fft_complex_wavetable,free) (b->wavetable);
+  free (b->kernel);
+  free (b->chirp);
+  free (b);
+}
+
+static size_t
+FUNCTION(fft_bluestein,bytes) (const TYPE(fft_bluestein) * b)
+{
+  return sizeof (TYPE(fft_bluestein))
+    + (b->p + b->m) * sizeof (TYPE(gsl_complex))
+    + FUNCTION(gsl_fft_complex_wavetable,bytes) (b->wavetable);
+}
+
+static TYPE(fft_bluestein) *
+FUNCTION(fft_bluestein,alloc) (const size_t p)
+{
+  size_t l, m = 1, s = 0;
+  TYPE(fft_bluestein) * b;
+  TYPE(gsl_fft_complex_workspace) * work;
+
+  while (m < 2 * p - 1)
+    {
+      m *= 2;
+    }
+
+  b = (TYPE(fft_bluestein) *) calloc (1, sizeof (TYPE(fft_bluestein)));
+
+  if (b == NULL)
+    {
+      GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
+    }
+
+  b->p = p;
+  b->m = m;
+  b->chirp = (TYPE(gsl_complex) *) malloc (p * sizeof (TYPE(gsl_complex)));
+  b->kernel = (TYPE(gsl_complex) *) calloc (m, sizeof (TYPE(gsl_complex)));
+
+  if (b->chirp == NULL || b->kernel == NULL)
+    {
+      FUNCTION(fft_bluestein,free) (b);
+      GSL_ERROR_VAL ("failed to allocate chirp tables", GSL_ENOMEM, 0);
+    }
+
+  b->wavetable = FUNCTION(gsl_fft_complex_wavetable,alloc) (m);
+
+  if (b->wavetable == NULL)
+    {
+      FUNCTION(fft_bluestein,free) (b);
+      GSL_ERROR_VAL ("failed to allocate convolution wavetable", GSL_ENOMEM, 0);
+    }
+
+  /* the exponent l^2 is reduced modulo 2p, keeping the argument of
+     the trigonometric functions small for large p */
+
+  for (l = 0; l < p; l++)
+    {
+      const double theta = -M_PI * (double) s / (double) p;
+      GSL_REAL(b->chirp[l]) = cos (theta);
+      GSL_IMAG(b->chirp[l]) = sin (theta);
+
+      s = (s + 2 * l + 1) % (2 * p);
+    }
+
+  {
+    BASE * const kernel = (BASE *) b->kernel;
+    const ATOMIC norm = 1.0 / m;
+
+    REAL(kernel,1,0) = norm * GSL_REAL(b->chirp[0]);
+    IMAG(kernel,1,0) = -norm * GSL_IMAG(b->chirp[0]);
+
+    for (l = 1; l < p; l++)
+      {
+        REAL(kernel,1,l) = norm * GSL_REAL(b->chirp[l]);
+        IMAG(kernel,1,l) = -norm * GSL_IMAG(b->chirp[l]);
+        REAL(kernel,1,m - l) = REAL(kernel,1,l);
+        IMAG(kernel,1,m - l) = IMAG(kernel,1,l);
+      }
+
+    work = FUNCTION(gsl_fft_complex_workspace,alloc) (m);
+
+    if (work == NULL)
+      {
+        FUNCTION(fft_bluestein,free) (b);
+        GSL_ERROR_VAL ("failed to allocate workspace", GSL_ENOMEM, 0);
+      }
+
+    FUNCTION(gsl_fft_complex,forward) (kernel, 1, m, b->wavetable, work);
+    FUNCTION(gsl_fft_complex_workspace,free) (work);
+  }
+
+  return b;
+}
+
+static int
+FUNCTION(fft_bluestein,memcpy) (TYPE(fft_bluestein) * dest,
+                                TYPE(fft_bluestein) * src)
+{
+  if (dest->p != src->p)
+    {
+      GSL_ERROR ("length of src and dest do not match", GSL_EINVAL);
+    }
+
+  memcpy (dest->chirp, src->chirp, src->p * sizeof (TYPE(gsl_complex)));
+  memcpy (dest->kernel, src->kernel, src->m * sizeof (TYPE(gsl_complex)));
+
+  return FUNCTION(gsl_fft_complex,memcpy) (dest->wavetable, src->wavetable);
+}
+
+/* fft_bluestein_scratch() returns the number of BASE elements of
+   scratch space needed by the Bluestein passes of a transform of
+   length n, in addition to the scratch space of the transform itself.
+   Every prime factor of n above FFT_BLUESTEIN_MIN is left over by the
+   factorizations in factorize.c, so only the largest needs to be
+   found. */
+
+static size_t
+FUNCTION(fft_bluestein,scratch) (size_t n)
+{
+  size_t f, p = 0, m = 1;
+
+  for (f = 2; f * f <= n; f++)
+    {
+      while (n % f == 0)
+        {
+          n /= f;
+          if (f > FFT_BLUESTEIN_MIN)
+            p = f;
+        }
+    }
+
+  if (n > FFT_BLUESTEIN_MIN && n > p)
+    {
+      p = n;
+    }
+
+  if (p == 0)
+    {
+      return 0;
+    }
+
+  while (m < 2 * p - 1)
+    {
+      m *= 2;
+    }
+
+  /* the p-point input/output, a table of p phase factors for the real
+     passes, and the convolution with its own transform scratch space */
+
+  return 4 * p + 4 * m;
+}
+
+/* defined in c_main.c, and also used by the four-step transforms in
+   c_fourstep.c */
+
+static int
+FUNCTION(fft_complex,transform_interleaved) (BASE data[],
+                                             const size_t stride,
+                                             const size_t n0,
+                                             const size_t b,
+                                             const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                             BASE scratch[],
+                                             const gsl_fft_direction sign);
+
+/* fft_bluestein_dft() computes the DFT of the p complex elements of z
+   in place, in the direction sign. work must hold 4m BASE elements. */
+
+static void
+FUNCTION(fft_bluestein,dft) (const TYPE(fft_bluestein) * b,
+                             const gsl_fft_direction sign,
+                             BASE z[],
+                             BASE work[])
+{
+  const size_t p = b->p;
+  const size_t m = b->m;
+  const BASE * const chirp = (const BASE *) b->chirp;
+  const BASE * const kernel = (const BASE *) b->kernel;
+  const ATOMIC conj = (sign == gsl_fft_forward) ? 1.0 : -1.0;
+
+  BASE * const a = work;
+  size_t l;
+
+  for (l = 0; l < p; l++)
+    {
+      const ATOMIC x_real = REAL(z,1,l);
+      const ATOMIC x_imag = conj * IMAG(z,1,l);
+      const ATOMIC c_real = REAL(chirp,1,l);
+      const ATOMIC c_imag = IMAG(chirp,1,l);
+      REAL(a,1,l) = x_real * c_real - x_imag * c_imag;
+      IMAG(a,1,l) = x_real * c_imag + x_imag * c_real;
+    }
+
+  for (l = p; l < m; l++)
+    {
+      REAL(a,1,l) = 0.0;
+      IMAG(a,1,l) = 0.0;
+    }
+
+  FUNCTION(fft_complex,transform_interleaved) (a, 1, m, 1, b->wavetable,
+                                               work + 2 * m, gsl_fft_forward);
+
+  for (l = 0; l < m; l++)
+    {
+      const ATOMIC a_real = REAL(a,1,l);
+      const ATOMIC a_imag = IMAG(a,1,l);
+      const ATOMIC k_real = REAL(kernel,1,l);
+      const ATOMIC k_imag = IMAG(kernel,1,l);
+      REAL(a,1,l) = a_real * k_real - a_imag * k_imag;
+      IMAG(a,1,l) = a_real * k_imag + a_imag * k_real;
+    }
+
+  FUNCTION(fft_complex,transform_interleaved) (a, 1, m, 1, b->wavetable,
+                                               work + 2 * m, gsl_fft_backward);
+
+  for (l = 0; l < p; l++)
+    {
+      const ATOMIC y_real = REAL(a,1,l);
+      const ATOMIC y_imag = IMAG(a,1,l);
+      const ATOMIC c_real = REAL(chirp,1,l);
+      const ATOMIC c_imag = IMAG(chirp,1,l);
+      REAL(z,1,l) = y_real * c_real - y_imag * c_imag;
+      IMAG(z,1,l) = conj * (y_real * c_imag + y_imag * c_real);
+    }
+}
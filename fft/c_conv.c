@@ -0,0 +1,208 @@
+/* fft/c_conv.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Convolution and correlation of complex data, as for real data in
+   real_conv.c. The transform of the kernel is stored scaled by 1/n, and
+   the correlation multiplies by its complex conjugate, giving
+   r_k = sum_l x_(l+k) conj(h_l). */
+
+TYPE(gsl_fft_complex_convolution) *
+FUNCTION(gsl_fft_complex_convolution,alloc) (TYPE(gsl_const_complex_packed_array) kernel,
+                                             const size_t stride,
+                                             const size_t nk,
+                                             const size_t nx)
+{
+  TYPE(gsl_fft_complex_convolution) * c;
+  size_t i;
+
+  if (nk == 0 || nx == 0)
+    {
+      GSL_ERROR_VAL ("lengths must be positive integers", GSL_EDOM, 0);
+    }
+
+  c = (TYPE(gsl_fft_complex_convolution) *)
+    calloc (1, sizeof (TYPE(gsl_fft_complex_convolution)));
+
+  if (c == NULL)
+    {
+      GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
+    }
+
+  c->nk = nk;
+  c->nx = nx;
+  c->n = fft_good_length (nx + nk - 1);
+
+  c->wavetable = FUNCTION(gsl_fft_complex_wavetable,alloc) (c->n);
+  c->work = FUNCTION(gsl_fft_complex_workspace,alloc) (c->n);
+  c->kernel = (BASE *) malloc (2 * c->n * sizeof (BASE));
+  c->data = (BASE *) malloc (2 * c->n * sizeof (BASE));
+
+  if (c->wavetable == NULL || c->work == NULL || c->kernel == NULL
+      || c->data == NULL)
+    {
+      FUNCTION(gsl_fft_complex_convolution,free) (c);
+      GSL_ERROR_VAL ("failed to allocate space for convolution", GSL_ENOMEM, 0);
+    }
+
+  {
+    const ATOMIC norm = 1.0 / (double) c->n;
+
+    for (i = 0; i < nk; i++)
+      {
+        REAL(c->kernel,1,i) = norm * REAL(kernel,stride,i);
+        IMAG(c->kernel,1,i) = norm * IMAG(kernel,stride,i);
+      }
+
+    for (i = nk; i < c->n; i++)
+      {
+        REAL(c->kernel,1,i) = 0.0;
+        IMAG(c->kernel,1,i) = 0.0;
+      }
+  }
+
+  FUNCTION(gsl_fft_complex,forward) (c->kernel, 1, c->n, c->wavetable, c->work);
+
+  return c;
+}
+
+void
+FUNCTION(gsl_fft_complex_convolution,free) (TYPE(gsl_fft_complex_convolution) * c)
+{
+  RETURN_IF_NULL (c);
+
+  FUNCTION(gsl_fft_complex_wavetable,free) (c->wavetable);
+  FUNCTION(gsl_fft_complex_workspace,free) (c->work);
+  free (c->kernel);
+  free (c->data);
+  free (c);
+}
+
+/* transforms the signal, multiplies by the kernel and transforms back,
+   leaving the circular result of length n in c->data */
+
+static int
+FUNCTION(fft_complex,conv_apply) (TYPE(gsl_fft_complex_convolution) * c,
+                                  TYPE(gsl_const_complex_packed_array) x,
+                                  const size_t xstride,
+                                  const size_t nx, const int conj)
+{
+  const size_t n = c->n;
+  const ATOMIC s = conj ? -1.0 : 1.0;
+  BASE * const data = c->data;
+  const BASE * const kernel = c->kernel;
+  size_t i;
+  int status;
+
+  if (nx == 0 || nx > c->nx)
+    {
+      GSL_ERROR ("signal length must be between 1 and the length nx used "
+                 "to allocate the convolution", GSL_EBADLEN);
+    }
+
+  for (i = 0; i < nx; i++)
+    {
+      REAL(data,1,i) = REAL(x,xstride,i);
+      IMAG(data,1,i) = IMAG(x,xstride,i);
+    }
+
+  for (i = nx; i < n; i++)
+    {
+      REAL(data,1,i) = 0.0;
+      IMAG(data,1,i) = 0.0;
+    }
+
+  status = FUNCTION(gsl_fft_complex,forward) (data, 1, n, c->wavetable,
+                                              c->work);
+  if (status)
+    {
+      return status;
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      const ATOMIC x_real = REAL(data,1,i);
+      const ATOMIC x_imag = IMAG(data,1,i);
+      const ATOMIC h_real = REAL(kernel,1,i);
+      const ATOMIC h_imag = s * IMAG(kernel,1,i);
+
+      REAL(data,1,i) = x_real * h_real - x_imag * h_imag;
+      IMAG(data,1,i) = x_real * h_imag + x_imag * h_real;
+    }
+
+  return FUNCTION(gsl_fft_complex,backward) (data, 1, n, c->wavetable, c->work);
+}
+
+int
+FUNCTION(gsl_fft_complex,convolve) (TYPE(gsl_fft_complex_convolution) * c,
+                                    TYPE(gsl_const_complex_packed_array) x,
+                                    const size_t xstride,
+                                    const size_t nx,
+                                    TYPE(gsl_complex_packed_array) y,
+                                    const size_t ystride)
+{
+  const size_t ny = nx + c->nk - 1;
+  size_t i;
+  int status = FUNCTION(fft_complex,conv_apply) (c, x, xstride, nx, 0);
+
+  if (status)
+    {
+      return status;
+    }
+
+  for (i = 0; i < ny; i++)
+    {
+      REAL(y,ystride,i) = REAL(c->data,1,i);
+      IMAG(y,ystride,i) = IMAG(c->data,1,i);
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+FUNCTION(gsl_fft_complex,correlate) (TYPE(gsl_fft_complex_convolution) * c,
+                                     TYPE(gsl_const_complex_packed_array) x,
+                                     const size_t xstride,
+                                     const size_t nx,
+                                     TYPE(gsl_complex_packed_array) y,
+                                     const size_t ystride)
+{
+  const size_t nk = c->nk;
+  const size_t n = c->n;
+  size_t i;
+  int status = FUNCTION(fft_complex,conv_apply) (c, x, xstride, nx, 1);
+
+  if (status)
+    {
+      return status;
+    }
+
+  /* negative lags -(nk-1) .. -1 are at the end of the circular result */
+
+  for (i = 1; i < nk; i++)
+    {
+      REAL(y,ystride,nk - 1 - i) = REAL(c->data,1,n - i);
+      IMAG(y,ystride,nk - 1 - i) = IMAG(c->data,1,n - i);
+    }
+
+  for (i = 0; i < nx; i++)
+    {
+      REAL(y,ystride,nk - 1 + i) = REAL(c->data,1,i);
+      IMAG(y,ystride,nk - 1 + i) = IMAG(c->data,1,i);
+    }
+
+  return GSL_SUCCESS;
+}
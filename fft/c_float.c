@@ -12,6 +12,7 @@
 #define BASE_FLOAT
 #include "templates_on.h"
 #include "c_pass.h"
+#include "c_bluestein.c"
 #include "c_init.c"
 #include "c_main.c"
 #include "c_pass_2.c"
@@ -20,7 +21,10 @@
 #include "c_pass_5.c"
 #include "c_pass_6.c"
 #include "c_pass_7.c"
+#include "c_pass_8.c"
+#include "c_pass_unit.c"
 #include "c_pass_n.c"
+#include "c_pass_bluestein.c"
 #include "bitreverse.c"
 #include "c_radix2.c"
 #include "templates_off.h"
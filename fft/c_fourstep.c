@@ -0,0 +1,425 @@
+/* fft/c_fourstep.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Four-step transforms of large lengths n = n1 n2, with n1 <= n2
+   the divisor of n closest to sqrt(n). Writing j = j1 n2 + j2 and
+   k = k1 + n1 k2,
+
+     X_k = sum_j2 w_n2^(j2 k2) [w_n^(j2 k1) sum_j1 x_j w_n1^(j1 k1)]
+
+   so the transform is computed as
+
+     1. n2 column transforms of length n1, multiplied by the twiddle
+        factors w_n^(j2 k1) and stored by rows in the scratch space,
+     2. n1 row transforms of length n2, in place in the scratch space,
+     3. a transpose of the n1 x n2 result back into the data.
+
+   Each pass of the mixed-radix transform reads and writes all of the
+   data, which for these lengths is larger than the L2 cache, whereas
+   every column and row transform here fits in it. The columns are
+   gathered in blocks of FFT_FOURSTEP_BLOCK and transformed together as
+   an interleaved sequence (see c_main.c), and step 3 is done for
+   blocks of FFT_FOURSTEP_BLOCK rows so that both the reads and the
+   writes use whole cache lines. Steps 1 and 2-3 are divided between
+   the threads of the workspace.
+
+   For the columns j2 = j0 + t of a block the twiddle factor is
+   w_n^(j0 k1) w_n^(t k1). The first is the product of w_n^(e mod n2)
+   and w_n1^(e / n2) for e = j0 k1 < n, from two tables of n2 and n1
+   elements, and the second comes from a table of FFT_FOURSTEP_BLOCK
+   elements for each k1, so the multiplication by the twiddle factors
+   vectorizes without a table of n elements. */
+
+#ifndef FFT_FOURSTEP_MIN
+#define FFT_FOURSTEP_MIN 4194304
+#endif
+
+#ifndef FFT_FOURSTEP_MIN_SPLIT
+#define FFT_FOURSTEP_MIN_SPLIT 64
+#endif
+
+#ifndef FFT_FOURSTEP_BLOCK
+#define FFT_FOURSTEP_BLOCK 32
+#endif
+
+typedef struct
+  {
+    size_t n;
+    size_t n1;
+    size_t n2;
+    TYPE(gsl_fft_complex_wavetable) * wavetable1;
+    TYPE(gsl_fft_complex_wavetable) * wavetable2;
+    TYPE(gsl_complex) * twiddle_lo;   /* w_n^r for r = 0 .. n2 - 1 */
+    TYPE(gsl_complex) * twiddle_hi;   /* w_n1^q for q = 0 .. n1 - 1 */
+    TYPE(gsl_complex) * twiddle_block;   /* w_n^(t k1) at k1 BLOCK + t */
+  }
+TYPE(fft_fourstep);
+
+typedef struct
+  {
+    const TYPE(fft_fourstep) * f;
+    BASE * data;
+    size_t stride;
+    BASE * rows;
+    BASE * scratch;
+    size_t thread_size;
+    gsl_fft_direction sign;
+  }
+TYPE(fft_fourstep_pass);
+
+/* returns n1 for the lengths which use the four-step algorithm, and
+   zero for the others. n2 = n/n1 is kept below FFT_FOURSTEP_MIN so
+   that the row transforms do not split again. */
+
+static size_t
+FUNCTION(fft_fourstep,split) (const size_t n)
+{
+  size_t n1;
+
+  if (n < FFT_FOURSTEP_MIN)
+    {
+      return 0;
+    }
+
+  n1 = (size_t) sqrt ((double) n);
+
+  while (n1 * n1 > n)
+    {
+      n1--;
+    }
+
+  for (; n1 >= FFT_FOURSTEP_MIN_SPLIT; n1--)
+    {
+      if (n % n1 == 0)
+        {
+          return (n / n1 < FFT_FOURSTEP_MIN) ? n1 : 0;
+        }
+    }
+
+  return 0;
+}
+
+/* BASE elements of scratch space for each thread: the column block and
+   its transform scratch in step 1, or the scratch of one row transform
+   in step 2 */
+
+static size_t
+FUNCTION(fft_fourstep,thread_size) (const size_t n1, const size_t n2)
+{
+  const size_t cols = 4 * n1 * FFT_FOURSTEP_BLOCK + FUNCTION(fft_bluestein,scratch) (n1);
+  const size_t rows = 2 * n2 + FUNCTION(fft_bluestein,scratch) (n2);
+
+  return GSL_MAX (cols, rows);
+}
+
+/* fft_complex_scratch() returns the number of BASE elements of scratch
+   space needed by a complex transform of length n using nthreads
+   threads */
+
+static size_t
+FUNCTION(fft_complex,scratch) (const size_t n, const size_t nthreads)
+{
+  const size_t n1 = FUNCTION(fft_fourstep,split) (n);
+
+  if (n1 != 0)
+    {
+      /* the rows of step 2, followed by the space of each thread */
+
+      return 2 * n + nthreads * FUNCTION(fft_fourstep,thread_size) (n1, n / n1);
+    }
+
+  /* the Bluestein passes keep their scratch space after the 2n
+     elements used by the other passes */
+
+  return 2 * n + FUNCTION(fft_bluestein,scratch) (n);
+}
+
+static void
+FUNCTION(fft_fourstep,free) (TYPE(fft_fourstep) * f)
+{
+  RETURN_IF_NULL (f);
+
+  FUNCTION(gsl_fft_complex_wavetable,free) (f->wavetable1);
+  FUNCTION(gsl_fft_complex_wavetable,free) (f->wavetable2);
+  free (f->twiddle_lo);
+  free (f->twiddle_hi);
+  free (f->twiddle_block);
+  free (f);
+}
+
+static size_t
+FUNCTION(fft_fourstep,bytes) (const TYPE(fft_fourstep) * f)
+{
+  return sizeof (TYPE(fft_fourstep))
+    + (f->n2 + f->n1 + f->n1 * FFT_FOURSTEP_BLOCK) * sizeof (TYPE(gsl_complex))
+    + FUNCTION(gsl_fft_complex_wavetable,bytes) (f->wavetable1)
+    + FUNCTION(gsl_fft_complex_wavetable,bytes) (f->wavetable2);
+}
+
+/* returns a null pointer, without an error, for the lengths which use
+   the mixed-radix passes directly */
+
+static TYPE(fft_fourstep) *
+FUNCTION(fft_fourstep,alloc) (const size_t n)
+{
+  const size_t n1 = FUNCTION(fft_fourstep,split) (n);
+  TYPE(fft_fourstep) * f;
+  size_t i;
+
+  if (n1 == 0)
+    {
+      return NULL;
+    }
+
+  f = (TYPE(fft_fourstep) *) calloc (1, sizeof (TYPE(fft_fourstep)));
+
+  if (f == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate struct", GSL_ENOMEM);
+    }
+
+  f->n = n;
+  f->n1 = n1;
+  f->n2 = n / n1;
+  f->wavetable1 = FUNCTION(gsl_fft_complex_wavetable,alloc) (f->n1);
+  f->wavetable2 = FUNCTION(gsl_fft_complex_wavetable,alloc) (f->n2);
+  f->twiddle_lo = (TYPE(gsl_complex) *) malloc (f->n2 * sizeof (TYPE(gsl_complex)));
+  f->twiddle_hi = (TYPE(gsl_complex) *) malloc (f->n1 * sizeof (TYPE(gsl_complex)));
+  f->twiddle_block = (TYPE(gsl_complex) *) malloc (f->n1 * FFT_FOURSTEP_BLOCK
+                                                   * sizeof (TYPE(gsl_complex)));
+
+  if (f->wavetable1 == NULL || f->wavetable2 == NULL
+      || f->twiddle_lo == NULL || f->twiddle_hi == NULL
+      || f->twiddle_block == NULL)
+    {
+      FUNCTION(fft_fourstep,free) (f);
+      GSL_ERROR_NULL ("failed to allocate four-step tables", GSL_ENOMEM);
+    }
+
+  for (i = 0; i < f->n2; i++)
+    {
+      const double theta = -2.0 * M_PI * (double) i / (double) n;
+      GSL_REAL(f->twiddle_lo[i]) = cos (theta);
+      GSL_IMAG(f->twiddle_lo[i]) = sin (theta);
+    }
+
+  for (i = 0; i < f->n1; i++)
+    {
+      const double theta = -2.0 * M_PI * (double) i / (double) f->n1;
+      GSL_REAL(f->twiddle_hi[i]) = cos (theta);
+      GSL_IMAG(f->twiddle_hi[i]) = sin (theta);
+    }
+
+  for (i = 0; i < f->n1 * FFT_FOURSTEP_BLOCK; i++)
+    {
+      const size_t e = (i / FFT_FOURSTEP_BLOCK) * (i % FFT_FOURSTEP_BLOCK);
+      const double theta = -2.0 * M_PI * (double) e / (double) n;
+      GSL_REAL(f->twiddle_block[i]) = cos (theta);
+      GSL_IMAG(f->twiddle_block[i]) = sin (theta);
+    }
+
+  return f;
+}
+
+static int
+FUNCTION(fft_fourstep,memcpy) (TYPE(fft_fourstep) * dest,
+                               const TYPE(fft_fourstep) * src)
+{
+  int status;
+
+  memcpy (dest->twiddle_lo, src->twiddle_lo, src->n2 * sizeof (TYPE(gsl_complex)));
+  memcpy (dest->twiddle_hi, src->twiddle_hi, src->n1 * sizeof (TYPE(gsl_complex)));
+  memcpy (dest->twiddle_block, src->twiddle_block,
+          src->n1 * FFT_FOURSTEP_BLOCK * sizeof (TYPE(gsl_complex)));
+
+  status = FUNCTION(gsl_fft_complex,memcpy) (dest->wavetable1, src->wavetable1);
+
+  if (status)
+    {
+      return status;
+    }
+
+  return FUNCTION(gsl_fft_complex,memcpy) (dest->wavetable2, src->wavetable2);
+}
+
+/* step 1 for the blocks of columns [begin, end) */
+
+static int
+FUNCTION(fft_fourstep,columns) (void * ctx, size_t thread, size_t begin,
+                                size_t end)
+{
+  const TYPE(fft_fourstep_pass) * pass = (TYPE(fft_fourstep_pass) *) ctx;
+  const TYPE(fft_fourstep) * f = pass->f;
+  const size_t n1 = f->n1;
+  const size_t n2 = f->n2;
+  const size_t stride = pass->stride;
+  const ATOMIC conj = (pass->sign == gsl_fft_forward) ? 1.0 : -1.0;
+  const BASE * const lo = (const BASE *) f->twiddle_lo;
+  const BASE * const hi = (const BASE *) f->twiddle_hi;
+  const BASE * const block = (const BASE *) f->twiddle_block;
+  BASE * const buf = pass->scratch + thread * pass->thread_size;
+  BASE * const scratch = buf + 2 * n1 * FFT_FOURSTEP_BLOCK;
+  size_t s, t, j1, k1, q, r;
+
+  for (s = begin; s < end; s++)
+    {
+      const size_t j0 = s * FFT_FOURSTEP_BLOCK;
+      const size_t b = GSL_MIN (FFT_FOURSTEP_BLOCK, n2 - j0);
+      int status;
+
+      for (j1 = 0; j1 < n1; j1++)
+        {
+          const BASE * const x = pass->data + 2 * (j1 * n2 + j0) * stride;
+
+          for (t = 0; t < b; t++)
+            {
+              REAL(buf,1,j1 * b + t) = REAL(x,stride,t);
+              IMAG(buf,1,j1 * b + t) = IMAG(x,stride,t);
+            }
+        }
+
+      status = FUNCTION(fft_complex,transform_interleaved) (buf, 1, n1, b,
+                                                            f->wavetable1,
+                                                            scratch,
+                                                            pass->sign);
+      if (status)
+        {
+          return status;
+        }
+
+      /* e = j0 k1 = q n2 + r, updated as k1 increases */
+
+      q = 0;
+      r = 0;
+
+      for (k1 = 0; k1 < n1; k1++)
+        {
+          const BASE * const z = buf + 2 * k1 * b;
+          const BASE * const v = block + 2 * k1 * FFT_FOURSTEP_BLOCK;
+          BASE * const y = pass->rows + 2 * (k1 * n2 + j0);
+          const ATOMIC l_real = REAL(lo,1,r);
+          const ATOMIC l_imag = IMAG(lo,1,r);
+          const ATOMIC h_real = REAL(hi,1,q);
+          const ATOMIC h_imag = IMAG(hi,1,q);
+          const ATOMIC u_real = l_real * h_real - l_imag * h_imag;
+          const ATOMIC u_imag = l_real * h_imag + l_imag * h_real;
+
+          for (t = 0; t < b; t++)
+            {
+              const ATOMIC v_real = REAL(v,1,t);
+              const ATOMIC v_imag = IMAG(v,1,t);
+              const ATOMIC w_real = u_real * v_real - u_imag * v_imag;
+              const ATOMIC w_imag = conj * (u_real * v_imag + u_imag * v_real);
+              const ATOMIC z_real = REAL(z,1,t);
+              const ATOMIC z_imag = IMAG(z,1,t);
+
+              REAL(y,1,t) = z_real * w_real - z_imag * w_imag;
+              IMAG(y,1,t) = z_real * w_imag + z_imag * w_real;
+            }
+
+          r += j0;
+
+          if (r >= n2)
+            {
+              r -= n2;
+              q++;
+            }
+        }
+    }
+
+  return 0;
+}
+
+/* steps 2 and 3 for the blocks of rows [begin, end) */
+
+static int
+FUNCTION(fft_fourstep,rows) (void * ctx, size_t thread, size_t begin,
+                             size_t end)
+{
+  const TYPE(fft_fourstep_pass) * pass = (TYPE(fft_fourstep_pass) *) ctx;
+  const TYPE(fft_fourstep) * f = pass->f;
+  const size_t n1 = f->n1;
+  const size_t n2 = f->n2;
+  const size_t stride = pass->stride;
+  BASE * const scratch = pass->scratch + thread * pass->thread_size;
+  size_t s, t, k1, k2;
+
+  for (s = begin; s < end; s++)
+    {
+      const size_t k0 = s * FFT_FOURSTEP_BLOCK;
+      const size_t b = GSL_MIN (FFT_FOURSTEP_BLOCK, n1 - k0);
+      const BASE * const y = pass->rows + 2 * k0 * n2;
+
+      for (k1 = k0; k1 < k0 + b; k1++)
+        {
+          int status = FUNCTION(fft_complex,transform_interleaved) (pass->rows + 2 * k1 * n2,
+                                                                    1, n2, 1,
+                                                                    f->wavetable2,
+                                                                    scratch,
+                                                                    pass->sign);
+          if (status)
+            {
+              return status;
+            }
+        }
+
+      for (k2 = 0; k2 < n2; k2++)
+        {
+          BASE * const x = pass->data + 2 * (k0 + n1 * k2) * stride;
+
+          for (t = 0; t < b; t++)
+            {
+              REAL(x,stride,t) = REAL(y,1,t * n2 + k2);
+              IMAG(x,stride,t) = IMAG(y,1,t * n2 + k2);
+            }
+        }
+    }
+
+  return 0;
+}
+
+/* transforms data of length f->n in place. scratch must hold
+   fft_complex_scratch(n, nthreads) elements. */
+
+static int
+FUNCTION(fft_fourstep,transform) (const TYPE(fft_fourstep) * f,
+                                  BASE data[], const size_t stride,
+                                  BASE scratch[], const size_t nthreads,
+                                  const gsl_fft_direction sign)
+{
+  const size_t nb1 = (f->n2 + FFT_FOURSTEP_BLOCK - 1) / FFT_FOURSTEP_BLOCK;
+  const size_t nb2 = (f->n1 + FFT_FOURSTEP_BLOCK - 1) / FFT_FOURSTEP_BLOCK;
+  TYPE(fft_fourstep_pass) pass;
+  int status;
+
+  pass.f = f;
+  pass.data = data;
+  pass.stride = stride;
+  pass.rows = scratch;
+  pass.scratch = scratch + 2 * f->n;
+  pass.thread_size = FUNCTION(fft_fourstep,thread_size) (f->n1, f->n2);
+  pass.sign = sign;
+
+  status = parallel_for (nthreads, nb1, FUNCTION(fft_fourstep,columns),
+                         &pass);
+  if (status)
+    {
+      return status;
+    }
+
+  return parallel_for (nthreads, nb2, FUNCTION(fft_fourstep,rows), &pass);
+}
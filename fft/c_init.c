@@ -41,6 +41,8 @@ FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
       GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
     }
 
+  wavetable->fourstep = NULL;
+
   wavetable->trig = (TYPE(gsl_complex) *) malloc (n * sizeof (TYPE(gsl_complex)));
 
   if (wavetable->trig == NULL)
@@ -109,6 +111,50 @@ FUNCTION(gsl_fft_complex_wavetable,alloc) (size_t n)
                         GSL_ESANITY, 0);
     }
 
+  /* chirp tables for the large prime factors, see c_bluestein.c */
+
+  for (i = 0; i < n_factors; i++)
+    {
+      wavetable->bluestein[i] = NULL;
+    }
+
+  for (i = 0; i < n_factors; i++)
+    {
+      if (wavetable->factor[i] > FFT_BLUESTEIN_MIN)
+        {
+          wavetable->bluestein[i] = 
+            FUNCTION(fft_bluestein,alloc) (wavetable->factor[i]);
+
+          if (wavetable->bluestein[i] == NULL)
+            {
+              /* error in constructor, prevent memory leak */
+
+              FUNCTION(gsl_fft_complex_wavetable,free) (wavetable);
+
+              GSL_ERROR_VAL ("failed to allocate chirp tables", 
+                             GSL_ENOMEM, 0);
+            }
+        }
+    }
+
+  /* tables for the column and row transforms of large lengths, see
+     c_fourstep.c */
+
+  if (FUNCTION(fft_fourstep,split) (n) != 0)
+    {
+      wavetable->fourstep = FUNCTION(fft_fourstep,alloc) (n);
+
+      if (wavetable->fourstep == NULL)
+        {
+          /* error in constructor, prevent memory leak */
+
+          FUNCTION(gsl_fft_complex_wavetable,free) (wavetable);
+
+          GSL_ERROR_VAL ("failed to allocate four-step tables",
+                         GSL_ENOMEM, 0);
+        }
+    }
+
   return wavetable;
 }
 
@@ -132,8 +178,10 @@ FUNCTION(gsl_fft_complex_workspace,alloc) (size_t n)
     }
 
   workspace->n = n ;
+  workspace->nthreads = 1 ;
 
-  workspace->scratch = (BASE *) malloc (2 * n * sizeof (BASE));
+  workspace->scratch = (BASE *) malloc (FUNCTION(fft_complex,scratch) (n, 1)
+                                        * sizeof (BASE));
 
   if (workspace->scratch == NULL)
     {
@@ -146,10 +194,47 @@ FUNCTION(gsl_fft_complex_workspace,alloc) (size_t n)
 }
 
 
+size_t
+FUNCTION(gsl_fft_complex_wavetable,bytes) (const TYPE(gsl_fft_complex_wavetable) * wavetable)
+{
+  size_t bytes = sizeof (TYPE(gsl_fft_complex_wavetable))
+    + wavetable->n * sizeof (TYPE(gsl_complex));
+  size_t i;
+
+  for (i = 0; i < wavetable->nf; i++)
+    {
+      if (wavetable->bluestein[i] != NULL)
+        bytes += FUNCTION(fft_bluestein,bytes) (wavetable->bluestein[i]);
+    }
+
+  if (wavetable->fourstep != NULL)
+    bytes += FUNCTION(fft_fourstep,bytes) (wavetable->fourstep);
+
+  return bytes;
+}
+
+size_t
+FUNCTION(gsl_fft_complex_workspace,bytes) (const TYPE(gsl_fft_complex_workspace) * workspace)
+{
+  return sizeof (TYPE(gsl_fft_complex_workspace))
+    + FUNCTION(fft_complex,scratch) (workspace->n, workspace->nthreads)
+    * sizeof (BASE);
+}
+
 void
 FUNCTION(gsl_fft_complex_wavetable,free) (TYPE(gsl_fft_complex_wavetable) * wavetable)
 {
+  size_t i;
+
   RETURN_IF_NULL (wavetable);
+
+  for (i = 0; i < wavetable->nf; i++)
+    {
+      FUNCTION(fft_bluestein,free) (wavetable->bluestein[i]);
+    }
+
+  FUNCTION(fft_fourstep,free) (wavetable->fourstep);
+
   /* release trigonometric lookup tables */
 
   free (wavetable->trig);
@@ -169,6 +254,28 @@ FUNCTION(gsl_fft_complex_workspace,free) (TYPE(gsl_fft_complex_workspace) * work
   free (workspace) ;
 }
 
+int
+FUNCTION(gsl_fft_complex_workspace,set_threads) (TYPE(gsl_fft_complex_workspace) * workspace,
+                                                 const size_t nthreads)
+{
+  const size_t nt = (nthreads == 0) ? 1 : nthreads;
+
+  BASE * scratch = (BASE *) malloc (FUNCTION(fft_complex,scratch) (workspace->n, nt)
+                                    * sizeof (BASE));
+
+  if (scratch == NULL)
+    {
+      GSL_ERROR ("failed to allocate thread workspaces", GSL_ENOMEM);
+    }
+
+  free (workspace->scratch);
+
+  workspace->nthreads = nt;
+  workspace->scratch = scratch;
+
+  return GSL_SUCCESS;
+}
+
 
 int
 FUNCTION(gsl_fft_complex,memcpy) (TYPE(gsl_fft_complex_wavetable) * dest,
@@ -184,11 +291,26 @@ FUNCTION(gsl_fft_complex,memcpy) (TYPE(gsl_fft_complex_wavetable) * dest,
   n = dest->n ;
   nf = dest->nf ;
 
-  memcpy(dest->trig, src->trig, n * sizeof (double)) ;
+  memcpy(dest->trig, src->trig, n * sizeof (TYPE(gsl_complex))) ;
   
   for (i = 0 ; i < nf ; i++)
     {
       dest->twiddle[i] = dest->trig + (src->twiddle[i] - src->trig) ;
+
+      if (src->bluestein[i] != NULL)
+        {
+          int status = FUNCTION(fft_bluestein,memcpy) (dest->bluestein[i], 
+                                                       src->bluestein[i]);
+          if (status)
+            {
+              return status;
+            }
+        }
+    }
+
+  if (src->fourstep != NULL)
+    {
+      return FUNCTION(fft_fourstep,memcpy) (dest->fourstep, src->fourstep);
     }
 
   return 0 ;
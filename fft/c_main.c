@@ -83,25 +83,6 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
                                      TYPE(gsl_fft_complex_workspace) * work,
                                      const gsl_fft_direction sign)
 {
-  const size_t nf = wavetable->nf;
-
-  size_t i;
-
-  size_t q, product = 1;
-
-  TYPE(gsl_complex) *twiddle1, *twiddle2, *twiddle3, *twiddle4,
-    *twiddle5, *twiddle6;
-
-  size_t state = 0;
-
-  BASE * const scratch = work->scratch;
-
-  BASE * in = data;
-  size_t istride = stride;
-
-  BASE * out = scratch;
-  size_t ostride = 1;
-
   if (n == 0)
     {
       GSL_ERROR ("length n must be positive integer", GSL_EDOM);
@@ -122,6 +103,74 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
       GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
     }
 
+  return FUNCTION(fft_complex,transform_scratch) (data, stride, n, wavetable,
+                                                  work->scratch,
+                                                  work->nthreads, sign);
+}
+
+/* fft_complex_transform_scratch() transforms a single sequence with
+   the four-step algorithm where the wavetable has the tables for it,
+   and with the mixed-radix passes otherwise. scratch must hold
+   fft_complex_scratch(n, nthreads) elements. */
+
+static int
+FUNCTION(fft_complex,transform_scratch) (BASE data[],
+                                         const size_t stride,
+                                         const size_t n,
+                                         const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                         BASE scratch[],
+                                         const size_t nthreads,
+                                         const gsl_fft_direction sign)
+{
+  if (wavetable->fourstep != NULL)
+    {
+      return FUNCTION(fft_fourstep,transform) (wavetable->fourstep, data,
+                                               stride, scratch, nthreads,
+                                               sign);
+    }
+
+  return FUNCTION(fft_complex,transform_interleaved) (data, stride, n, 1,
+                                                      wavetable, scratch,
+                                                      sign);
+}
+
+/* fft_complex_transform_interleaved() transforms b sequences of
+   length n stored interleaved, with element j of sequence t at
+   position j*b + t of data (in units of stride). This is a single
+   sequence of length n*b which has already been through passes with a
+   product of b, so each pass is applied with its product and length
+   multiplied by b. The twiddle factors of the length n wavetable are
+   then the ones required, and the innermost loops of the passes run
+   over all b sequences at once. scratch must hold 2*n*b elements
+   followed by the Bluestein scratch space for length n. */
+
+static int
+FUNCTION(fft_complex,transform_interleaved) (BASE data[],
+                                             const size_t stride,
+                                             const size_t n0,
+                                             const size_t b,
+                                             const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                             BASE scratch[],
+                                             const gsl_fft_direction sign)
+{
+  const size_t nf = wavetable->nf;
+  const size_t n = n0 * b;
+
+  size_t i;
+
+  size_t q, product = b;
+
+  TYPE(gsl_complex) *twiddle1, *twiddle2, *twiddle3, *twiddle4,
+    *twiddle5, *twiddle6, *twiddle7;
+
+  size_t state = 0;
+
+  BASE * in = data;
+  size_t istride = stride;
+
+  BASE * out = scratch;
+  size_t ostride = 1;
+
   for (i = 0; i < nf; i++)
     {
       const size_t factor = wavetable->factor[i];
@@ -145,11 +194,18 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
           state = 0;
         }
 
+      /* in and out are always distinct buffers, so the unit stride
+         passes can be used whenever both strides are 1 */
+
       if (factor == 2)
         {
           twiddle1 = wavetable->twiddle[i];
-          FUNCTION(fft_complex,pass_2) (in, istride, out, ostride, sign, 
-                                        product, n, twiddle1);
+          if (istride == 1 && ostride == 1)
+            FUNCTION(fft_complex,pass_2_unit) (in, out, sign, product, n,
+                                               twiddle1);
+          else
+            FUNCTION(fft_complex,pass_2) (in, istride, out, ostride, sign, 
+                                          product, n, twiddle1);
         }
       else if (factor == 3)
         {
@@ -163,9 +219,13 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
           twiddle1 = wavetable->twiddle[i];
           twiddle2 = twiddle1 + q;
           twiddle3 = twiddle2 + q;
-          FUNCTION(fft_complex,pass_4) (in, istride, out, ostride, sign, 
-                                        product, n, twiddle1, twiddle2, 
-                                        twiddle3);
+          if (istride == 1 && ostride == 1)
+            FUNCTION(fft_complex,pass_4_unit) (in, out, sign, product, n,
+                                               twiddle1, twiddle2, twiddle3);
+          else
+            FUNCTION(fft_complex,pass_4) (in, istride, out, ostride, sign, 
+                                          product, n, twiddle1, twiddle2, 
+                                          twiddle3);
         }
       else if (factor == 5)
         {
@@ -201,6 +261,41 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
                                         twiddle3, twiddle4, twiddle5, 
                                         twiddle6);
         }
+      else if (factor == 8)
+        {
+          twiddle1 = wavetable->twiddle[i];
+          twiddle2 = twiddle1 + q;
+          twiddle3 = twiddle2 + q;
+          twiddle4 = twiddle3 + q;
+          twiddle5 = twiddle4 + q;
+          twiddle6 = twiddle5 + q;
+          twiddle7 = twiddle6 + q;
+          if (istride == 1 && ostride == 1 && product == factor && n > factor)
+            FUNCTION(fft_complex,pass_8_unit_first) (in, out, sign, n,
+                                                     twiddle1, twiddle2,
+                                                     twiddle3, twiddle4,
+                                                     twiddle5, twiddle6,
+                                                     twiddle7);
+          else if (istride == 1 && ostride == 1)
+            FUNCTION(fft_complex,pass_8_unit) (in, out, sign, product, n,
+                                               twiddle1, twiddle2, twiddle3,
+                                               twiddle4, twiddle5, twiddle6,
+                                               twiddle7);
+          else
+            FUNCTION(fft_complex,pass_8) (in, istride, out, ostride, sign, 
+                                          product, n, twiddle1, twiddle2, 
+                                          twiddle3, twiddle4, twiddle5, 
+                                          twiddle6, twiddle7);
+        }
+      else if (wavetable->bluestein[i] != NULL)
+        {
+          twiddle1 = wavetable->twiddle[i];
+          FUNCTION(fft_complex,pass_bluestein) (in, istride, out, ostride, 
+                                                sign, factor, product, n, 
+                                                twiddle1, 
+                                                wavetable->bluestein[i],
+                                                scratch + 2 * n);
+        }
       else
         {
           twiddle1 = wavetable->twiddle[i];
@@ -219,5 +314,4 @@ FUNCTION(gsl_fft_complex,transform) (TYPE(gsl_complex_packed_array) data,
     }
 
   return 0;
-
 }
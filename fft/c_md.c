@@ -0,0 +1,602 @@
+/* fft/c_md.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Multidimensional transforms of row-major arrays, computed as
+   sequences of one dimensional mixed-radix transforms.
+
+   The rows are contiguous and are transformed in place. The columns
+   are gathered FFT_BLOCK at a time into a contiguous buffer,
+   transformed there with unit stride and scattered back, so that the
+   array is streamed through the cache once per block of columns
+   instead of once per column. Each thread has its own 1d workspaces
+   and column buffer; the wavetables are shared. */
+
+#ifndef FFT_BLOCK
+#define FFT_BLOCK 16
+#endif
+
+typedef struct
+  {
+    BASE * data;
+    size_t tda;
+    size_t nrows;
+    size_t ncols;
+    size_t plane;
+    size_t block_size;
+    const TYPE(gsl_fft_complex_wavetable) * wavetable;
+    TYPE(gsl_fft_complex_workspace) ** work;
+    BASE * block;
+    gsl_fft_direction sign;
+  }
+TYPE(fft_complex_md_pass);
+
+static int
+FUNCTION(fft_complex,md_rows) (void * ctx, size_t thread, size_t begin,
+                               size_t end)
+{
+  const TYPE(fft_complex_md_pass) * pass = (TYPE(fft_complex_md_pass) *) ctx;
+  size_t i;
+
+  for (i = begin; i < end; i++)
+    {
+      int status = FUNCTION(gsl_fft_complex,transform) (pass->data + 2 * i * pass->tda,
+                                                        1, pass->ncols,
+                                                        pass->wavetable,
+                                                        pass->work[thread],
+                                                        pass->sign);
+      if (status)
+        {
+          return status;
+        }
+    }
+
+  return 0;
+}
+
+/* the loop runs over blocks of FFT_BLOCK columns, in all the planes
+   of a 3d array (planes are pass->plane complex elements apart) */
+
+static int
+FUNCTION(fft_complex,md_columns) (void * ctx, size_t thread, size_t begin,
+                                  size_t end)
+{
+  const TYPE(fft_complex_md_pass) * pass = (TYPE(fft_complex_md_pass) *) ctx;
+  const size_t nrows = pass->nrows;
+  const size_t tda = pass->tda;
+  const size_t nblocks = (pass->ncols + FFT_BLOCK - 1) / FFT_BLOCK;
+  BASE * const block = pass->block + 2 * pass->block_size * thread;
+  size_t b, i, c;
+
+  for (b = begin; b < end; b++)
+    {
+      const size_t c0 = (b % nblocks) * FFT_BLOCK;
+      const size_t nc = GSL_MIN (FFT_BLOCK, pass->ncols - c0);
+      BASE * const x = pass->data + 2 * ((b / nblocks) * pass->plane + c0);
+
+      for (i = 0; i < nrows; i++)
+        {
+          for (c = 0; c < nc; c++)
+            {
+              REAL(block,1,c * nrows + i) = REAL(x,1,i * tda + c);
+              IMAG(block,1,c * nrows + i) = IMAG(x,1,i * tda + c);
+            }
+        }
+
+      for (c = 0; c < nc; c++)
+        {
+          int status = FUNCTION(gsl_fft_complex,transform) (block + 2 * c * nrows,
+                                                            1, nrows,
+                                                            pass->wavetable,
+                                                            pass->work[thread],
+                                                            pass->sign);
+          if (status)
+            {
+              return status;
+            }
+        }
+
+      for (i = 0; i < nrows; i++)
+        {
+          for (c = 0; c < nc; c++)
+            {
+              REAL(x,1,i * tda + c) = REAL(block,1,c * nrows + i);
+              IMAG(x,1,i * tda + c) = IMAG(block,1,c * nrows + i);
+            }
+        }
+    }
+
+  return 0;
+}
+
+/* transform the ncols columns of length nrows in each of nplanes
+   planes, with rows tda and planes plane complex elements apart */
+
+static int
+FUNCTION(fft_complex,md_transform_columns) (BASE data[], const size_t tda,
+                                            const size_t nrows,
+                                            const size_t ncols,
+                                            const size_t nplanes,
+                                            const size_t plane,
+                                            const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                            TYPE(gsl_fft_complex_workspace) ** work,
+                                            BASE block[],
+                                            const size_t block_size,
+                                            const size_t nthreads,
+                                            const gsl_fft_direction sign)
+{
+  TYPE(fft_complex_md_pass) pass;
+  const size_t nblocks = (ncols + FFT_BLOCK - 1) / FFT_BLOCK;
+
+  if (nrows == 1)
+    {
+      return 0;
+    }
+
+  pass.data = data;
+  pass.tda = tda;
+  pass.nrows = nrows;
+  pass.ncols = ncols;
+  pass.plane = plane;
+  pass.block_size = block_size;
+  pass.wavetable = wavetable;
+  pass.work = work;
+  pass.block = block;
+  pass.sign = sign;
+
+  return parallel_for (nthreads, nplanes * nblocks,
+                       FUNCTION(fft_complex,md_columns), &pass);
+}
+
+static int
+FUNCTION(fft_complex,md_transform_rows) (BASE data[], const size_t tda,
+                                         const size_t nrows,
+                                         const size_t ncols,
+                                         const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                         TYPE(gsl_fft_complex_workspace) ** work,
+                                         const size_t nthreads,
+                                         const gsl_fft_direction sign)
+{
+  TYPE(fft_complex_md_pass) pass;
+
+  if (ncols == 1)
+    {
+      return 0;
+    }
+
+  pass.data = data;
+  pass.tda = tda;
+  pass.nrows = nrows;
+  pass.ncols = ncols;
+  pass.plane = 0;
+  pass.block_size = 0;
+  pass.wavetable = wavetable;
+  pass.work = work;
+  pass.block = NULL;
+  pass.sign = sign;
+
+  return parallel_for (nthreads, nrows,
+                       FUNCTION(fft_complex,md_rows), &pass);
+}
+
+static void
+FUNCTION(fft_complex,md_work_free) (TYPE(gsl_fft_complex_workspace) ** work,
+                                    const size_t nthreads)
+{
+  size_t t;
+
+  RETURN_IF_NULL (work);
+
+  for (t = 0; t < nthreads; t++)
+    {
+      FUNCTION(gsl_fft_complex_workspace,free) (work[t]);
+    }
+
+  free (work);
+}
+
+static TYPE(gsl_fft_complex_workspace) **
+FUNCTION(fft_complex,md_work_alloc) (const size_t n, const size_t nthreads)
+{
+  size_t t;
+  TYPE(gsl_fft_complex_workspace) ** work = (TYPE(gsl_fft_complex_workspace) **)
+    calloc (nthreads, sizeof (TYPE(gsl_fft_complex_workspace) *));
+
+  if (work == NULL)
+    {
+      return NULL;
+    }
+
+  for (t = 0; t < nthreads; t++)
+    {
+      work[t] = FUNCTION(gsl_fft_complex_workspace,alloc) (n);
+
+      if (work[t] == NULL)
+        {
+          FUNCTION(fft_complex,md_work_free) (work, nthreads);
+          return NULL;
+        }
+    }
+
+  return work;
+}
+
+/* 2d transforms */
+
+TYPE(gsl_fft_complex_2d_workspace) *
+FUNCTION(gsl_fft_complex_2d_workspace,alloc) (const size_t n1, const size_t n2)
+{
+  TYPE(gsl_fft_complex_2d_workspace) * w;
+
+  if (n1 == 0 || n2 == 0)
+    {
+      GSL_ERROR_VAL ("dimensions must be positive integers", GSL_EDOM, 0);
+    }
+
+  w = (TYPE(gsl_fft_complex_2d_workspace) *)
+    calloc (1, sizeof (TYPE(gsl_fft_complex_2d_workspace)));
+
+  if (w == NULL)
+    {
+      GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
+    }
+
+  w->n1 = n1;
+  w->n2 = n2;
+
+  w->wavetable1 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n1);
+  w->wavetable2 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n2);
+
+  if (w->wavetable1 == NULL || w->wavetable2 == NULL)
+    {
+      FUNCTION(gsl_fft_complex_2d_workspace,free) (w);
+      GSL_ERROR_VAL ("failed to allocate wavetables", GSL_ENOMEM, 0);
+    }
+
+  if (FUNCTION(gsl_fft_complex_2d_workspace,set_threads) (w, 1))
+    {
+      FUNCTION(gsl_fft_complex_2d_workspace,free) (w);
+      GSL_ERROR_VAL ("failed to allocate workspaces", GSL_ENOMEM, 0);
+    }
+
+  return w;
+}
+
+void
+FUNCTION(gsl_fft_complex_2d_workspace,free) (TYPE(gsl_fft_complex_2d_workspace) * w)
+{
+  RETURN_IF_NULL (w);
+
+  FUNCTION(fft_complex,md_work_free) (w->work1, w->nthreads);
+  FUNCTION(fft_complex,md_work_free) (w->work2, w->nthreads);
+  free (w->block);
+  FUNCTION(gsl_fft_complex_wavetable,free) (w->wavetable1);
+  FUNCTION(gsl_fft_complex_wavetable,free) (w->wavetable2);
+  free (w);
+}
+
+int
+FUNCTION(gsl_fft_complex_2d_workspace,set_threads) (TYPE(gsl_fft_complex_2d_workspace) * w,
+                                                    const size_t nthreads)
+{
+  const size_t nt = (nthreads == 0) ? 1 : nthreads;
+
+  TYPE(gsl_fft_complex_workspace) ** work1 = FUNCTION(fft_complex,md_work_alloc) (w->n1, nt);
+  TYPE(gsl_fft_complex_workspace) ** work2 = FUNCTION(fft_complex,md_work_alloc) (w->n2, nt);
+  BASE * block = (BASE *) malloc (2 * FFT_BLOCK * w->n1 * nt * sizeof (BASE));
+
+  if (work1 == NULL || work2 == NULL || block == NULL)
+    {
+      FUNCTION(fft_complex,md_work_free) (work1, nt);
+      FUNCTION(fft_complex,md_work_free) (work2, nt);
+      free (block);
+      GSL_ERROR ("failed to allocate thread workspaces", GSL_ENOMEM);
+    }
+
+  FUNCTION(fft_complex,md_work_free) (w->work1, w->nthreads);
+  FUNCTION(fft_complex,md_work_free) (w->work2, w->nthreads);
+  free (w->block);
+
+  w->nthreads = nt;
+  w->work1 = work1;
+  w->work2 = work2;
+  w->block = block;
+
+  return GSL_SUCCESS;
+}
+
+int
+FUNCTION(gsl_fft_complex,2d_forward) (TYPE(gsl_complex_packed_array) data,
+                                      const size_t tda,
+                                      const size_t n1, const size_t n2,
+                                      TYPE(gsl_fft_complex_2d_workspace) * w)
+{
+  return FUNCTION(gsl_fft_complex,2d_transform) (data, tda, n1, n2, w,
+                                                 gsl_fft_forward);
+}
+
+int
+FUNCTION(gsl_fft_complex,2d_backward) (TYPE(gsl_complex_packed_array) data,
+                                       const size_t tda,
+                                       const size_t n1, const size_t n2,
+                                       TYPE(gsl_fft_complex_2d_workspace) * w)
+{
+  return FUNCTION(gsl_fft_complex,2d_transform) (data, tda, n1, n2, w,
+                                                 gsl_fft_backward);
+}
+
+int
+FUNCTION(gsl_fft_complex,2d_inverse) (TYPE(gsl_complex_packed_array) data,
+                                      const size_t tda,
+                                      const size_t n1, const size_t n2,
+                                      TYPE(gsl_fft_complex_2d_workspace) * w)
+{
+  int status = FUNCTION(gsl_fft_complex,2d_transform) (data, tda, n1, n2, w,
+                                                       gsl_fft_backward);
+
+  if (status)
+    {
+      return status;
+    }
+
+  /* normalize inverse fft with 1/(n1 n2) */
+
+  {
+    const ATOMIC norm = 1.0 / ((double) n1 * (double) n2);
+    size_t i, j;
+
+    for (i = 0; i < n1; i++)
+      {
+        for (j = 0; j < n2; j++)
+          {
+            REAL(data,1,i * tda + j) *= norm;
+            IMAG(data,1,i * tda + j) *= norm;
+          }
+      }
+  }
+
+  return status;
+}
+
+int
+FUNCTION(gsl_fft_complex,2d_transform) (TYPE(gsl_complex_packed_array) data,
+                                        const size_t tda,
+                                        const size_t n1, const size_t n2,
+                                        TYPE(gsl_fft_complex_2d_workspace) * w,
+                                        const gsl_fft_direction sign)
+{
+  int status;
+
+  if (n1 != w->n1 || n2 != w->n2)
+    {
+      GSL_ERROR ("workspace does not match dimensions of data", GSL_EBADLEN);
+    }
+
+  if (tda < n2)
+    {
+      GSL_ERROR ("tda must be at least n2", GSL_EINVAL);
+    }
+
+  status = FUNCTION(fft_complex,md_transform_rows) (data, tda, n1, n2,
+                                                    w->wavetable2, w->work2,
+                                                    w->nthreads, sign);
+  if (status)
+    {
+      return status;
+    }
+
+  status = FUNCTION(fft_complex,md_transform_columns) (data, tda, n1, n2,
+                                                       1, 0,
+                                                       w->wavetable1,
+                                                       w->work1, w->block,
+                                                       FFT_BLOCK * n1,
+                                                       w->nthreads, sign);
+  return status;
+}
+
+/* 3d transforms */
+
+TYPE(gsl_fft_complex_3d_workspace) *
+FUNCTION(gsl_fft_complex_3d_workspace,alloc) (const size_t n1, const size_t n2,
+                                              const size_t n3)
+{
+  TYPE(gsl_fft_complex_3d_workspace) * w;
+
+  if (n1 == 0 || n2 == 0 || n3 == 0)
+    {
+      GSL_ERROR_VAL ("dimensions must be positive integers", GSL_EDOM, 0);
+    }
+
+  w = (TYPE(gsl_fft_complex_3d_workspace) *)
+    calloc (1, sizeof (TYPE(gsl_fft_complex_3d_workspace)));
+
+  if (w == NULL)
+    {
+      GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
+    }
+
+  w->n1 = n1;
+  w->n2 = n2;
+  w->n3 = n3;
+
+  w->wavetable1 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n1);
+  w->wavetable2 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n2);
+  w->wavetable3 = FUNCTION(gsl_fft_complex_wavetable,alloc) (n3);
+
+  if (w->wavetable1 == NULL || w->wavetable2 == NULL || w->wavetable3 == NULL)
+    {
+      FUNCTION(gsl_fft_complex_3d_workspace,free) (w);
+      GSL_ERROR_VAL ("failed to allocate wavetables", GSL_ENOMEM, 0);
+    }
+
+  if (FUNCTION(gsl_fft_complex_3d_workspace,set_threads) (w, 1))
+    {
+      FUNCTION(gsl_fft_complex_3d_workspace,free) (w);
+      GSL_ERROR_VAL ("failed to allocate workspaces", GSL_ENOMEM, 0);
+    }
+
+  return w;
+}
+
+void
+FUNCTION(gsl_fft_complex_3d_workspace,free) (TYPE(gsl_fft_complex_3d_workspace) * w)
+{
+  RETURN_IF_NULL (w);
+
+  FUNCTION(fft_complex,md_work_free) (w->work1, w->nthreads);
+  FUNCTION(fft_complex,md_work_free) (w->work2, w->nthreads);
+  FUNCTION(fft_complex,md_work_free) (w->work3, w->nthreads);
+  free (w->block);
+  FUNCTION(gsl_fft_complex_wavetable,free) (w->wavetable1);
+  FUNCTION(gsl_fft_complex_wavetable,free) (w->wavetable2);
+  FUNCTION(gsl_fft_complex_wavetable,free) (w->wavetable3);
+  free (w);
+}
+
+int
+FUNCTION(gsl_fft_complex_3d_workspace,set_threads) (TYPE(gsl_fft_complex_3d_workspace) * w,
+                                                    const size_t nthreads)
+{
+  const size_t nt = (nthreads == 0) ? 1 : nthreads;
+  const size_t nmax = GSL_MAX (w->n1, w->n2);
+
+  TYPE(gsl_fft_complex_workspace) ** work1 = FUNCTION(fft_complex,md_work_alloc) (w->n1, nt);
+  TYPE(gsl_fft_complex_workspace) ** work2 = FUNCTION(fft_complex,md_work_alloc) (w->n2, nt);
+  TYPE(gsl_fft_complex_workspace) ** work3 = FUNCTION(fft_complex,md_work_alloc) (w->n3, nt);
+  BASE * block = (BASE *) malloc (2 * FFT_BLOCK * nmax * nt * sizeof (BASE));
+
+  if (work1 == NULL || work2 == NULL || work3 == NULL || block == NULL)
+    {
+      FUNCTION(fft_complex,md_work_free) (work1, nt);
+      FUNCTION(fft_complex,md_work_free) (work2, nt);
+      FUNCTION(fft_complex,md_work_free) (work3, nt);
+      free (block);
+      GSL_ERROR ("failed to allocate thread workspaces", GSL_ENOMEM);
+    }
+
+  FUNCTION(fft_complex,md_work_free) (w->work1, w->nthreads);
+  FUNCTION(fft_complex,md_work_free) (w->work2, w->nthreads);
+  FUNCTION(fft_complex,md_work_free) (w->work3, w->nthreads);
+  free (w->block);
+
+  w->nthreads = nt;
+  w->work1 = work1;
+  w->work2 = work2;
+  w->work3 = work3;
+  w->block = block;
+
+  return GSL_SUCCESS;
+}
+
+int
+FUNCTION(gsl_fft_complex,3d_forward) (TYPE(gsl_complex_packed_array) data,
+                                      const size_t n1, const size_t n2,
+                                      const size_t n3,
+                                      TYPE(gsl_fft_complex_3d_workspace) * w)
+{
+  return FUNCTION(gsl_fft_complex,3d_transform) (data, n1, n2, n3, w,
+                                                 gsl_fft_forward);
+}
+
+int
+FUNCTION(gsl_fft_complex,3d_backward) (TYPE(gsl_complex_packed_array) data,
+                                       const size_t n1, const size_t n2,
+                                       const size_t n3,
+                                       TYPE(gsl_fft_complex_3d_workspace) * w)
+{
+  return FUNCTION(gsl_fft_complex,3d_transform) (data, n1, n2, n3, w,
+                                                 gsl_fft_backward);
+}
+
+int
+FUNCTION(gsl_fft_complex,3d_inverse) (TYPE(gsl_complex_packed_array) data,
+                                      const size_t n1, const size_t n2,
+                                      const size_t n3,
+                                      TYPE(gsl_fft_complex_3d_workspace) * w)
+{
+  int status = FUNCTION(gsl_fft_complex,3d_transform) (data, n1, n2, n3, w,
+                                                       gsl_fft_backward);
+
+  if (status)
+    {
+      return status;
+    }
+
+  /* normalize inverse fft with 1/(n1 n2 n3) */
+
+  {
+    const size_t n = n1 * n2 * n3;
+    const ATOMIC norm = 1.0 / (double) n;
+    size_t i;
+
+    for (i = 0; i < n; i++)
+      {
+        REAL(data,1,i) *= norm;
+        IMAG(data,1,i) *= norm;
+      }
+  }
+
+  return status;
+}
+
+int
+FUNCTION(gsl_fft_complex,3d_transform) (TYPE(gsl_complex_packed_array) data,
+                                        const size_t n1, const size_t n2,
+                                        const size_t n3,
+                                        TYPE(gsl_fft_complex_3d_workspace) * w,
+                                        const gsl_fft_direction sign)
+{
+  const size_t nmax = GSL_MAX (n1, n2);
+  int status;
+
+  if (n1 != w->n1 || n2 != w->n2 || n3 != w->n3)
+    {
+      GSL_ERROR ("workspace does not match dimensions of data", GSL_EBADLEN);
+    }
+
+  /* the n1*n2 rows of length n3 */
+
+  status = FUNCTION(fft_complex,md_transform_rows) (data, n3, n1 * n2, n3,
+                                                    w->wavetable3, w->work3,
+                                                    w->nthreads, sign);
+  if (status)
+    {
+      return status;
+    }
+
+  /* the n3 columns of length n2 in each of the n1 planes */
+
+  status = FUNCTION(fft_complex,md_transform_columns) (data, n3, n2, n3,
+                                                       n1, n2 * n3,
+                                                       w->wavetable2,
+                                                       w->work2, w->block,
+                                                       FFT_BLOCK * nmax,
+                                                       w->nthreads, sign);
+  if (status)
+    {
+      return status;
+    }
+
+  /* the n2*n3 columns of length n1 */
+
+  status = FUNCTION(fft_complex,md_transform_columns) (data, n2 * n3, n1,
+                                                       n2 * n3, 1, 0,
+                                                       w->wavetable1,
+                                                       w->work1, w->block,
+                                                       FFT_BLOCK * nmax,
+                                                       w->nthreads, sign);
+  return status;
+}
@@ -17,6 +17,27 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+/* GSL_VECTORIZE marks the unit stride passes in c_pass_unit.c. */
+
+#include "vectorize.h"
+
+/* FFT_IVDEP tells the compiler that the iterations of the inner loop of
+   a unit stride pass are independent. The outputs of the radix-8 pass
+   go to eight streams whose distance is only known at run time, which
+   needs more alias checks than GCC will generate, so without it the
+   loop is only vectorized within each complex element, two floats at a
+   time. */
+
+#ifndef FFT_IVDEP
+#if defined(__clang__)
+#define FFT_IVDEP _Pragma ("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define FFT_IVDEP _Pragma ("GCC ivdep")
+#else
+#define FFT_IVDEP
+#endif
+#endif
+
 static int
 FUNCTION(fft_complex,pass_2) (const BASE in[],
                               const size_t istride,
@@ -93,6 +114,71 @@ FUNCTION(fft_complex,pass_7) (const BASE in[],
                               const TYPE(gsl_complex) twiddle6[]);
 
 
+static int
+FUNCTION(fft_complex,pass_8) (const BASE in[],
+                              const size_t istride,
+                              BASE out[],
+                              const size_t ostride,
+                              const gsl_fft_direction sign,
+                              const size_t product,
+                              const size_t n,
+                              const TYPE(gsl_complex) twiddle1[],
+                              const TYPE(gsl_complex) twiddle2[],
+                              const TYPE(gsl_complex) twiddle3[],
+                              const TYPE(gsl_complex) twiddle4[],
+                              const TYPE(gsl_complex) twiddle5[],
+                              const TYPE(gsl_complex) twiddle6[],
+                              const TYPE(gsl_complex) twiddle7[]);
+
+static int
+FUNCTION(fft_complex,pass_2_unit) (const BASE * restrict in,
+                                   BASE * restrict out,
+                                   const gsl_fft_direction sign,
+                                   const size_t product,
+                                   const size_t n,
+                                   const TYPE(gsl_complex) twiddle[])
+  GSL_VECTORIZE;
+
+static int
+FUNCTION(fft_complex,pass_4_unit) (const BASE * restrict in,
+                                   BASE * restrict out,
+                                   const gsl_fft_direction sign,
+                                   const size_t product,
+                                   const size_t n,
+                                   const TYPE(gsl_complex) twiddle1[],
+                                   const TYPE(gsl_complex) twiddle2[],
+                                   const TYPE(gsl_complex) twiddle3[])
+  GSL_VECTORIZE;
+
+static int
+FUNCTION(fft_complex,pass_8_unit) (const BASE * restrict in,
+                                   BASE * restrict out,
+                                   const gsl_fft_direction sign,
+                                   const size_t product,
+                                   const size_t n,
+                                   const TYPE(gsl_complex) twiddle1[],
+                                   const TYPE(gsl_complex) twiddle2[],
+                                   const TYPE(gsl_complex) twiddle3[],
+                                   const TYPE(gsl_complex) twiddle4[],
+                                   const TYPE(gsl_complex) twiddle5[],
+                                   const TYPE(gsl_complex) twiddle6[],
+                                   const TYPE(gsl_complex) twiddle7[])
+  GSL_VECTORIZE;
+
+static int
+FUNCTION(fft_complex,pass_8_unit_first) (const BASE * restrict in,
+                                         BASE * restrict out,
+                                         const gsl_fft_direction sign,
+                                         const size_t n,
+                                         const TYPE(gsl_complex) twiddle1[],
+                                         const TYPE(gsl_complex) twiddle2[],
+                                         const TYPE(gsl_complex) twiddle3[],
+                                         const TYPE(gsl_complex) twiddle4[],
+                                         const TYPE(gsl_complex) twiddle5[],
+                                         const TYPE(gsl_complex) twiddle6[],
+                                         const TYPE(gsl_complex) twiddle7[])
+  GSL_VECTORIZE;
+
 static int
 FUNCTION(fft_complex,pass_n) (BASE in[],
                               const size_t istride,
@@ -104,3 +190,34 @@ FUNCTION(fft_complex,pass_n) (BASE in[],
                               const size_t n,
                               const TYPE(gsl_complex) twiddle[]);
 
+static int
+FUNCTION(fft_complex,pass_bluestein) (const BASE in[],
+                                      const size_t istride,
+                                      BASE out[],
+                                      const size_t ostride,
+                                      const gsl_fft_direction sign,
+                                      const size_t factor,
+                                      const size_t product,
+                                      const size_t n,
+                                      const TYPE(gsl_complex) twiddle[],
+                                      const TYPE(fft_bluestein) * bluestein,
+                                      BASE work[]);
+
+
+static int
+FUNCTION(fft_complex,transform_scratch) (BASE data[],
+                                         const size_t stride,
+                                         const size_t n,
+                                         const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                         BASE scratch[],
+                                         const size_t nthreads,
+                                         const gsl_fft_direction sign);
+
+static int
+FUNCTION(fft_complex,transform_interleaved) (BASE data[],
+                                             const size_t stride,
+                                             const size_t n0,
+                                             const size_t b,
+                                             const TYPE(gsl_fft_complex_wavetable) * wavetable,
+                                             BASE scratch[],
+                                             const gsl_fft_direction sign);
@@ -0,0 +1,261 @@
+/* fft/c_pass_8.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+static int
+FUNCTION(fft_complex,pass_8) (const BASE in[],
+                              const size_t istride,
+                              BASE out[],
+                              const size_t ostride,
+                              const gsl_fft_direction sign,
+                              const size_t product,
+                              const size_t n,
+                              const TYPE(gsl_complex) twiddle1[],
+                              const TYPE(gsl_complex) twiddle2[],
+                              const TYPE(gsl_complex) twiddle3[],
+                              const TYPE(gsl_complex) twiddle4[],
+                              const TYPE(gsl_complex) twiddle5[],
+                              const TYPE(gsl_complex) twiddle6[],
+                              const TYPE(gsl_complex) twiddle7[])
+{
+  size_t i = 0, j = 0;
+  size_t k, k1;
+
+  const size_t factor = 8;
+  const size_t m = n / factor;
+  const size_t q = n / product;
+  const size_t p_1 = product / factor;
+  const size_t jump = (factor - 1) * p_1;
+
+  const ATOMIC c = M_SQRT1_2;
+
+  for (k = 0; k < q; k++)
+    {
+      ATOMIC w1_real, w1_imag, w2_real, w2_imag, w3_real, w3_imag,
+        w4_real, w4_imag, w5_real, w5_imag, w6_real, w6_imag,
+        w7_real, w7_imag;
+
+      if (k == 0)
+        {
+          w1_real = 1.0;
+          w1_imag = 0.0;
+          w2_real = 1.0;
+          w2_imag = 0.0;
+          w3_real = 1.0;
+          w3_imag = 0.0;
+          w4_real = 1.0;
+          w4_imag = 0.0;
+          w5_real = 1.0;
+          w5_imag = 0.0;
+          w6_real = 1.0;
+          w6_imag = 0.0;
+          w7_real = 1.0;
+          w7_imag = 0.0;
+        }
+      else
+        {
+          if (sign == gsl_fft_forward)
+            {
+              /* forward tranform */
+              w1_real = GSL_REAL(twiddle1[k - 1]);
+              w1_imag = GSL_IMAG(twiddle1[k - 1]);
+              w2_real = GSL_REAL(twiddle2[k - 1]);
+              w2_imag = GSL_IMAG(twiddle2[k - 1]);
+              w3_real = GSL_REAL(twiddle3[k - 1]);
+              w3_imag = GSL_IMAG(twiddle3[k - 1]);
+              w4_real = GSL_REAL(twiddle4[k - 1]);
+              w4_imag = GSL_IMAG(twiddle4[k - 1]);
+              w5_real = GSL_REAL(twiddle5[k - 1]);
+              w5_imag = GSL_IMAG(twiddle5[k - 1]);
+              w6_real = GSL_REAL(twiddle6[k - 1]);
+              w6_imag = GSL_IMAG(twiddle6[k - 1]);
+              w7_real = GSL_REAL(twiddle7[k - 1]);
+              w7_imag = GSL_IMAG(twiddle7[k - 1]);
+            }
+          else
+            {
+              /* backward tranform: w -> conjugate(w) */
+              w1_real = GSL_REAL(twiddle1[k - 1]);
+              w1_imag = -GSL_IMAG(twiddle1[k - 1]);
+              w2_real = GSL_REAL(twiddle2[k - 1]);
+              w2_imag = -GSL_IMAG(twiddle2[k - 1]);
+              w3_real = GSL_REAL(twiddle3[k - 1]);
+              w3_imag = -GSL_IMAG(twiddle3[k - 1]);
+              w4_real = GSL_REAL(twiddle4[k - 1]);
+              w4_imag = -GSL_IMAG(twiddle4[k - 1]);
+              w5_real = GSL_REAL(twiddle5[k - 1]);
+              w5_imag = -GSL_IMAG(twiddle5[k - 1]);
+              w6_real = GSL_REAL(twiddle6[k - 1]);
+              w6_imag = -GSL_IMAG(twiddle6[k - 1]);
+              w7_real = GSL_REAL(twiddle7[k - 1]);
+              w7_imag = -GSL_IMAG(twiddle7[k - 1]);
+            }
+        }
+
+      for (k1 = 0; k1 < p_1; k1++)
+        {
+          const ATOMIC z0_real = REAL(in,istride,i);
+          const ATOMIC z0_imag = IMAG(in,istride,i);
+          const ATOMIC z1_real = REAL(in,istride,i+m);
+          const ATOMIC z1_imag = IMAG(in,istride,i+m);
+          const ATOMIC z2_real = REAL(in,istride,i+2*m);
+          const ATOMIC z2_imag = IMAG(in,istride,i+2*m);
+          const ATOMIC z3_real = REAL(in,istride,i+3*m);
+          const ATOMIC z3_imag = IMAG(in,istride,i+3*m);
+          const ATOMIC z4_real = REAL(in,istride,i+4*m);
+          const ATOMIC z4_imag = IMAG(in,istride,i+4*m);
+          const ATOMIC z5_real = REAL(in,istride,i+5*m);
+          const ATOMIC z5_imag = IMAG(in,istride,i+5*m);
+          const ATOMIC z6_real = REAL(in,istride,i+6*m);
+          const ATOMIC z6_imag = IMAG(in,istride,i+6*m);
+          const ATOMIC z7_real = REAL(in,istride,i+7*m);
+          const ATOMIC z7_imag = IMAG(in,istride,i+7*m);
+
+          /* compute x = W(8) z as two W(4) transforms of the even and
+             odd elements, combined with the factors w8^k */
+
+          /* W(4) of the even elements z0, z2, z4, z6 */
+
+          /* t1 = z0 + z4 */
+          const ATOMIC t1_real = z0_real + z4_real;
+          const ATOMIC t1_imag = z0_imag + z4_imag;
+
+          /* t2 = z2 + z6 */
+          const ATOMIC t2_real = z2_real + z6_real;
+          const ATOMIC t2_imag = z2_imag + z6_imag;
+
+          /* t3 = z0 - z4 */
+          const ATOMIC t3_real = z0_real - z4_real;
+          const ATOMIC t3_imag = z0_imag - z4_imag;
+
+          /* t4 = (+/-) (z2 - z6) */
+          const ATOMIC t4_real = ((int) sign) * (z2_real - z6_real);
+          const ATOMIC t4_imag = ((int) sign) * (z2_imag - z6_imag);
+
+          /* a0 = t1 + t2 */
+          const ATOMIC a0_real = t1_real + t2_real;
+          const ATOMIC a0_imag = t1_imag + t2_imag;
+
+          /* a1 = t3 + i t4 */
+          const ATOMIC a1_real = t3_real - t4_imag;
+          const ATOMIC a1_imag = t3_imag + t4_real;
+
+          /* a2 = t1 - t2 */
+          const ATOMIC a2_real = t1_real - t2_real;
+          const ATOMIC a2_imag = t1_imag - t2_imag;
+
+          /* a3 = t3 - i t4 */
+          const ATOMIC a3_real = t3_real + t4_imag;
+          const ATOMIC a3_imag = t3_imag - t4_real;
+
+          /* W(4) of the odd elements z1, z3, z5, z7 */
+
+          /* u1 = z1 + z5 */
+          const ATOMIC u1_real = z1_real + z5_real;
+          const ATOMIC u1_imag = z1_imag + z5_imag;
+
+          /* u2 = z3 + z7 */
+          const ATOMIC u2_real = z3_real + z7_real;
+          const ATOMIC u2_imag = z3_imag + z7_imag;
+
+          /* u3 = z1 - z5 */
+          const ATOMIC u3_real = z1_real - z5_real;
+          const ATOMIC u3_imag = z1_imag - z5_imag;
+
+          /* u4 = (+/-) (z3 - z7) */
+          const ATOMIC u4_real = ((int) sign) * (z3_real - z7_real);
+          const ATOMIC u4_imag = ((int) sign) * (z3_imag - z7_imag);
+
+          /* b0 = u1 + u2 */
+          const ATOMIC b0_real = u1_real + u2_real;
+          const ATOMIC b0_imag = u1_imag + u2_imag;
+
+          /* b1 = (u3 + i u4) * sqrt(1/2) (1 (+/-) i) */
+          const ATOMIC v1_real = u3_real - u4_imag;
+          const ATOMIC v1_imag = u3_imag + u4_real;
+          const ATOMIC b1_real = c * (v1_real - ((int) sign) * v1_imag);
+          const ATOMIC b1_imag = c * (v1_imag + ((int) sign) * v1_real);
+
+          /* b2 = (u1 - u2) * (+/-) i */
+          const ATOMIC b2_real = -((int) sign) * (u1_imag - u2_imag);
+          const ATOMIC b2_imag = ((int) sign) * (u1_real - u2_real);
+
+          /* b3 = (u3 - i u4) * sqrt(1/2) (-1 (+/-) i) */
+          const ATOMIC v3_real = u3_real + u4_imag;
+          const ATOMIC v3_imag = u3_imag - u4_real;
+          const ATOMIC b3_real = -c * (v3_real + ((int) sign) * v3_imag);
+          const ATOMIC b3_imag = -c * (v3_imag - ((int) sign) * v3_real);
+
+          /* x(k) = a(k) + b(k),  x(k+4) = a(k) - b(k) */
+
+          const ATOMIC x0_real = a0_real + b0_real;
+          const ATOMIC x0_imag = a0_imag + b0_imag;
+          const ATOMIC x1_real = a1_real + b1_real;
+          const ATOMIC x1_imag = a1_imag + b1_imag;
+          const ATOMIC x2_real = a2_real + b2_real;
+          const ATOMIC x2_imag = a2_imag + b2_imag;
+          const ATOMIC x3_real = a3_real + b3_real;
+          const ATOMIC x3_imag = a3_imag + b3_imag;
+          const ATOMIC x4_real = a0_real - b0_real;
+          const ATOMIC x4_imag = a0_imag - b0_imag;
+          const ATOMIC x5_real = a1_real - b1_real;
+          const ATOMIC x5_imag = a1_imag - b1_imag;
+          const ATOMIC x6_real = a2_real - b2_real;
+          const ATOMIC x6_imag = a2_imag - b2_imag;
+          const ATOMIC x7_real = a3_real - b3_real;
+          const ATOMIC x7_imag = a3_imag - b3_imag;
+
+          /* apply twiddle factors */
+
+          /* to0 = 1 * x0 */
+          REAL(out,ostride,j) = x0_real;
+          IMAG(out,ostride,j) = x0_imag;
+
+          /* to1 = w1 * x1 */
+          REAL(out,ostride,j+p_1) = w1_real * x1_real - w1_imag * x1_imag;
+          IMAG(out,ostride,j+p_1) = w1_real * x1_imag + w1_imag * x1_real;
+
+          /* to2 = w2 * x2 */
+          REAL(out,ostride,j+2*p_1) = w2_real * x2_real - w2_imag * x2_imag;
+          IMAG(out,ostride,j+2*p_1) = w2_real * x2_imag + w2_imag * x2_real;
+
+          /* to3 = w3 * x3 */
+          REAL(out,ostride,j+3*p_1) = w3_real * x3_real - w3_imag * x3_imag;
+          IMAG(out,ostride,j+3*p_1) = w3_real * x3_imag + w3_imag * x3_real;
+
+          /* to4 = w4 * x4 */
+          REAL(out,ostride,j+4*p_1) = w4_real * x4_real - w4_imag * x4_imag;
+          IMAG(out,ostride,j+4*p_1) = w4_real * x4_imag + w4_imag * x4_real;
+
+          /* to5 = w5 * x5 */
+          REAL(out,ostride,j+5*p_1) = w5_real * x5_real - w5_imag * x5_imag;
+          IMAG(out,ostride,j+5*p_1) = w5_real * x5_imag + w5_imag * x5_real;
+
+          /* to6 = w6 * x6 */
+          REAL(out,ostride,j+6*p_1) = w6_real * x6_real - w6_imag * x6_imag;
+          IMAG(out,ostride,j+6*p_1) = w6_real * x6_imag + w6_imag * x6_real;
+
+          /* to7 = w7 * x7 */
+          REAL(out,ostride,j+7*p_1) = w7_real * x7_real - w7_imag * x7_imag;
+          IMAG(out,ostride,j+7*p_1) = w7_real * x7_imag + w7_imag * x7_real;
+
+          i++;
+          j++;
+        }
+      j += jump;
+    }
+  return 0;
+}
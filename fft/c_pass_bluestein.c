@@ -0,0 +1,88 @@
+/* fft/c_pass_bluestein.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* pass for a large prime factor, with the factor-point subtransforms
+   computed by Bluestein's algorithm (see c_bluestein.c) */
+
+static int
+FUNCTION(fft_complex,pass_bluestein) (const BASE in[],
+                                      const size_t istride,
+                                      BASE out[],
+                                      const size_t ostride,
+                                      const gsl_fft_direction sign,
+                                      const size_t factor,
+                                      const size_t product,
+                                      const size_t n,
+                                      const TYPE(gsl_complex) twiddle[],
+                                      const TYPE(fft_bluestein) * bluestein,
+                                      BASE work[])
+{
+  size_t i, j, k, k1, e;
+
+  const size_t m = n / factor;
+  const size_t q = n / product;
+  const size_t p_1 = product / factor;
+
+  BASE * const z = work;
+  BASE * const cwork = work + 4 * factor;
+
+  for (k = 0; k < q; k++)
+    {
+      ATOMIC w_real, w_imag;
+
+      for (k1 = 0; k1 < p_1; k1++)
+        {
+          i = k * p_1 + k1;
+          j = k * product + k1;
+
+          for (e = 0; e < factor; e++)
+            {
+              REAL(z,1,e) = REAL(in,istride,i + e * m);
+              IMAG(z,1,e) = IMAG(in,istride,i + e * m);
+            }
+
+          FUNCTION(fft_bluestein,dft) (bluestein, sign, z, cwork);
+
+          /* apply twiddle factors */
+
+          REAL(out,ostride,j) = REAL(z,1,0);
+          IMAG(out,ostride,j) = IMAG(z,1,0);
+
+          for (e = 1; e < factor; e++)
+            {
+              const ATOMIC x_real = REAL(z,1,e);
+              const ATOMIC x_imag = IMAG(z,1,e);
+
+              if (k == 0)
+                {
+                  w_real = 1.0;
+                  w_imag = 0.0;
+                }
+              else
+                {
+                  w_real = GSL_REAL(twiddle[(e - 1) * q + k - 1]);
+                  w_imag = ((int) sign) * (-GSL_IMAG(twiddle[(e - 1) * q + k - 1]));
+                }
+
+              REAL(out,ostride,j + e * p_1) = w_real * x_real - w_imag * x_imag;
+              IMAG(out,ostride,j + e * p_1) = w_real * x_imag + w_imag * x_real;
+            }
+        }
+    }
+
+  return 0;
+}
@@ -0,0 +1,483 @@
+/* fft/c_pass_unit.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Unit stride versions of the radix-2, 4 and 8 passes.
+
+   These compute exactly the same butterflies as pass_2, pass_4 and
+   pass_8, but with istride = ostride = 1, non-aliasing input and
+   output, and the twiddle factors for each k loaded before the inner
+   loop.  The inner loop over k1 then runs over contiguous complex
+   elements and is vectorized by the compiler.  Where the compiler
+   supports it (see GSL_VECTORIZE in vectorize.h) each function is built
+   in SSE2, AVX2 and AVX-512 variants and the best one for the running
+   processor is selected at load time. */
+
+static int
+FUNCTION(fft_complex,pass_2_unit) (const BASE * restrict in,
+                                   BASE * restrict out,
+                                   const gsl_fft_direction sign,
+                                   const size_t product,
+                                   const size_t n,
+                                   const TYPE(gsl_complex) twiddle[])
+{
+  size_t k, k1;
+
+  const size_t factor = 2;
+  const size_t m = n / factor;
+  const size_t q = n / product;
+  const size_t p_1 = product / factor;
+
+  /* conjugate the twiddle factors for the backward transform */
+  const ATOMIC s = -((int) sign);
+
+  for (k = 0; k < q; k++)
+    {
+      const ATOMIC w_real = (k == 0) ? 1.0 : GSL_REAL(twiddle[k - 1]);
+      const ATOMIC w_imag = (k == 0) ? 0.0 : s * GSL_IMAG(twiddle[k - 1]);
+
+      const BASE * restrict x = in + 2 * k * p_1;
+      BASE * restrict y = out + 2 * k * product;
+
+      FFT_IVDEP
+      for (k1 = 0; k1 < p_1; k1++)
+        {
+          const ATOMIC z0_real = x[2 * k1];
+          const ATOMIC z0_imag = x[2 * k1 + 1];
+          const ATOMIC z1_real = x[2 * (k1 + m)];
+          const ATOMIC z1_imag = x[2 * (k1 + m) + 1];
+
+          /* x0 = z0 + z1 */
+          const ATOMIC x0_real = z0_real + z1_real;
+          const ATOMIC x0_imag = z0_imag + z1_imag;
+
+          /* x1 = z0 - z1 */
+          const ATOMIC x1_real = z0_real - z1_real;
+          const ATOMIC x1_imag = z0_imag - z1_imag;
+
+          y[2 * k1] = x0_real;
+          y[2 * k1 + 1] = x0_imag;
+
+          y[2 * (k1 + p_1)] = w_real * x1_real - w_imag * x1_imag;
+          y[2 * (k1 + p_1) + 1] = w_real * x1_imag + w_imag * x1_real;
+        }
+    }
+  return 0;
+}
+
+static int
+FUNCTION(fft_complex,pass_4_unit) (const BASE * restrict in,
+                                   BASE * restrict out,
+                                   const gsl_fft_direction sign,
+                                   const size_t product,
+                                   const size_t n,
+                                   const TYPE(gsl_complex) twiddle1[],
+                                   const TYPE(gsl_complex) twiddle2[],
+                                   const TYPE(gsl_complex) twiddle3[])
+{
+  size_t k, k1;
+
+  const size_t factor = 4;
+  const size_t m = n / factor;
+  const size_t q = n / product;
+  const size_t p_1 = product / factor;
+
+  const ATOMIC sgn = (int) sign;
+
+  /* conjugate the twiddle factors for the backward transform */
+  const ATOMIC s = -sgn;
+
+  for (k = 0; k < q; k++)
+    {
+      const ATOMIC w1_real = (k == 0) ? 1.0 : GSL_REAL(twiddle1[k - 1]);
+      const ATOMIC w1_imag = (k == 0) ? 0.0 : s * GSL_IMAG(twiddle1[k - 1]);
+      const ATOMIC w2_real = (k == 0) ? 1.0 : GSL_REAL(twiddle2[k - 1]);
+      const ATOMIC w2_imag = (k == 0) ? 0.0 : s * GSL_IMAG(twiddle2[k - 1]);
+      const ATOMIC w3_real = (k == 0) ? 1.0 : GSL_REAL(twiddle3[k - 1]);
+      const ATOMIC w3_imag = (k == 0) ? 0.0 : s * GSL_IMAG(twiddle3[k - 1]);
+
+      const BASE * restrict x = in + 2 * k * p_1;
+      BASE * restrict y = out + 2 * k * product;
+
+      FFT_IVDEP
+      for (k1 = 0; k1 < p_1; k1++)
+        {
+          const ATOMIC z0_real = x[2 * k1];
+          const ATOMIC z0_imag = x[2 * k1 + 1];
+          const ATOMIC z1_real = x[2 * (k1 + m)];
+          const ATOMIC z1_imag = x[2 * (k1 + m) + 1];
+          const ATOMIC z2_real = x[2 * (k1 + 2 * m)];
+          const ATOMIC z2_imag = x[2 * (k1 + 2 * m) + 1];
+          const ATOMIC z3_real = x[2 * (k1 + 3 * m)];
+          const ATOMIC z3_imag = x[2 * (k1 + 3 * m) + 1];
+
+          /* t1 = z0 + z2, t2 = z1 + z3, t3 = z0 - z2, t4 = (+/-) (z1 - z3) */
+          const ATOMIC t1_real = z0_real + z2_real;
+          const ATOMIC t1_imag = z0_imag + z2_imag;
+          const ATOMIC t2_real = z1_real + z3_real;
+          const ATOMIC t2_imag = z1_imag + z3_imag;
+          const ATOMIC t3_real = z0_real - z2_real;
+          const ATOMIC t3_imag = z0_imag - z2_imag;
+          const ATOMIC t4_real = sgn * (z1_real - z3_real);
+          const ATOMIC t4_imag = sgn * (z1_imag - z3_imag);
+
+          /* x0 = t1 + t2, x1 = t3 + i t4, x2 = t1 - t2, x3 = t3 - i t4 */
+          const ATOMIC x0_real = t1_real + t2_real;
+          const ATOMIC x0_imag = t1_imag + t2_imag;
+          const ATOMIC x1_real = t3_real - t4_imag;
+          const ATOMIC x1_imag = t3_imag + t4_real;
+          const ATOMIC x2_real = t1_real - t2_real;
+          const ATOMIC x2_imag = t1_imag - t2_imag;
+          const ATOMIC x3_real = t3_real + t4_imag;
+          const ATOMIC x3_imag = t3_imag - t4_real;
+
+          y[2 * k1] = x0_real;
+          y[2 * k1 + 1] = x0_imag;
+
+          y[2 * (k1 + p_1)] = w1_real * x1_real - w1_imag * x1_imag;
+          y[2 * (k1 + p_1) + 1] = w1_real * x1_imag + w1_imag * x1_real;
+
+          y[2 * (k1 + 2 * p_1)] = w2_real * x2_real - w2_imag * x2_imag;
+          y[2 * (k1 + 2 * p_1) + 1] = w2_real * x2_imag + w2_imag * x2_real;
+
+          y[2 * (k1 + 3 * p_1)] = w3_real * x3_real - w3_imag * x3_imag;
+          y[2 * (k1 + 3 * p_1) + 1] = w3_real * x3_imag + w3_imag * x3_real;
+        }
+    }
+  return 0;
+}
+
+static int
+FUNCTION(fft_complex,pass_8_unit) (const BASE * restrict in,
+                                   BASE * restrict out,
+                                   const gsl_fft_direction sign,
+                                   const size_t product,
+                                   const size_t n,
+                                   const TYPE(gsl_complex) twiddle1[],
+                                   const TYPE(gsl_complex) twiddle2[],
+                                   const TYPE(gsl_complex) twiddle3[],
+                                   const TYPE(gsl_complex) twiddle4[],
+                                   const TYPE(gsl_complex) twiddle5[],
+                                   const TYPE(gsl_complex) twiddle6[],
+                                   const TYPE(gsl_complex) twiddle7[])
+{
+  size_t k, k1;
+
+  const size_t factor = 8;
+  const size_t m = n / factor;
+  const size_t q = n / product;
+  const size_t p_1 = product / factor;
+
+  const ATOMIC sgn = (int) sign;
+  const ATOMIC c = M_SQRT1_2;
+
+  /* conjugate the twiddle factors for the backward transform */
+  const ATOMIC s = -sgn;
+
+  for (k = 0; k < q; k++)
+    {
+      const ATOMIC w1_real = (k == 0) ? 1.0 : GSL_REAL(twiddle1[k - 1]);
+      const ATOMIC w1_imag = (k == 0) ? 0.0 : s * GSL_IMAG(twiddle1[k - 1]);
+      const ATOMIC w2_real = (k == 0) ? 1.0 : GSL_REAL(twiddle2[k - 1]);
+      const ATOMIC w2_imag = (k == 0) ? 0.0 : s * GSL_IMAG(twiddle2[k - 1]);
+      const ATOMIC w3_real = (k == 0) ? 1.0 : GSL_REAL(twiddle3[k - 1]);
+      const ATOMIC w3_imag = (k == 0) ? 0.0 : s * GSL_IMAG(twiddle3[k - 1]);
+      const ATOMIC w4_real = (k == 0) ? 1.0 : GSL_REAL(twiddle4[k - 1]);
+      const ATOMIC w4_imag = (k == 0) ? 0.0 : s * GSL_IMAG(twiddle4[k - 1]);
+      const ATOMIC w5_real = (k == 0) ? 1.0 : GSL_REAL(twiddle5[k - 1]);
+      const ATOMIC w5_imag = (k == 0) ? 0.0 : s * GSL_IMAG(twiddle5[k - 1]);
+      const ATOMIC w6_real = (k == 0) ? 1.0 : GSL_REAL(twiddle6[k - 1]);
+      const ATOMIC w6_imag = (k == 0) ? 0.0 : s * GSL_IMAG(twiddle6[k - 1]);
+      const ATOMIC w7_real = (k == 0) ? 1.0 : GSL_REAL(twiddle7[k - 1]);
+      const ATOMIC w7_imag = (k == 0) ? 0.0 : s * GSL_IMAG(twiddle7[k - 1]);
+
+      const BASE * restrict x = in + 2 * k * p_1;
+      BASE * restrict y = out + 2 * k * product;
+
+      FFT_IVDEP
+      for (k1 = 0; k1 < p_1; k1++)
+        {
+          const ATOMIC z0_real = x[2 * k1];
+          const ATOMIC z0_imag = x[2 * k1 + 1];
+          const ATOMIC z1_real = x[2 * (k1 + m)];
+          const ATOMIC z1_imag = x[2 * (k1 + m) + 1];
+          const ATOMIC z2_real = x[2 * (k1 + 2 * m)];
+          const ATOMIC z2_imag = x[2 * (k1 + 2 * m) + 1];
+          const ATOMIC z3_real = x[2 * (k1 + 3 * m)];
+          const ATOMIC z3_imag = x[2 * (k1 + 3 * m) + 1];
+          const ATOMIC z4_real = x[2 * (k1 + 4 * m)];
+          const ATOMIC z4_imag = x[2 * (k1 + 4 * m) + 1];
+          const ATOMIC z5_real = x[2 * (k1 + 5 * m)];
+          const ATOMIC z5_imag = x[2 * (k1 + 5 * m) + 1];
+          const ATOMIC z6_real = x[2 * (k1 + 6 * m)];
+          const ATOMIC z6_imag = x[2 * (k1 + 6 * m) + 1];
+          const ATOMIC z7_real = x[2 * (k1 + 7 * m)];
+          const ATOMIC z7_imag = x[2 * (k1 + 7 * m) + 1];
+
+          /* W(4) of the even elements, see pass_8 */
+          const ATOMIC t1_real = z0_real + z4_real;
+          const ATOMIC t1_imag = z0_imag + z4_imag;
+          const ATOMIC t2_real = z2_real + z6_real;
+          const ATOMIC t2_imag = z2_imag + z6_imag;
+          const ATOMIC t3_real = z0_real - z4_real;
+          const ATOMIC t3_imag = z0_imag - z4_imag;
+          const ATOMIC t4_real = sgn * (z2_real - z6_real);
+          const ATOMIC t4_imag = sgn * (z2_imag - z6_imag);
+
+          const ATOMIC a0_real = t1_real + t2_real;
+          const ATOMIC a0_imag = t1_imag + t2_imag;
+          const ATOMIC a1_real = t3_real - t4_imag;
+          const ATOMIC a1_imag = t3_imag + t4_real;
+          const ATOMIC a2_real = t1_real - t2_real;
+          const ATOMIC a2_imag = t1_imag - t2_imag;
+          const ATOMIC a3_real = t3_real + t4_imag;
+          const ATOMIC a3_imag = t3_imag - t4_real;
+
+          /* W(4) of the odd elements, multiplied by w8^k */
+          const ATOMIC u1_real = z1_real + z5_real;
+          const ATOMIC u1_imag = z1_imag + z5_imag;
+          const ATOMIC u2_real = z3_real + z7_real;
+          const ATOMIC u2_imag = z3_imag + z7_imag;
+          const ATOMIC u3_real = z1_real - z5_real;
+          const ATOMIC u3_imag = z1_imag - z5_imag;
+          const ATOMIC u4_real = sgn * (z3_real - z7_real);
+          const ATOMIC u4_imag = sgn * (z3_imag - z7_imag);
+
+          const ATOMIC v1_real = u3_real - u4_imag;
+          const ATOMIC v1_imag = u3_imag + u4_real;
+          const ATOMIC v3_real = u3_real + u4_imag;
+          const ATOMIC v3_imag = u3_imag - u4_real;
+
+          const ATOMIC b0_real = u1_real + u2_real;
+          const ATOMIC b0_imag = u1_imag + u2_imag;
+          const ATOMIC b1_real = c * (v1_real - sgn * v1_imag);
+          const ATOMIC b1_imag = c * (v1_imag + sgn * v1_real);
+          const ATOMIC b2_real = -sgn * (u1_imag - u2_imag);
+          const ATOMIC b2_imag = sgn * (u1_real - u2_real);
+          const ATOMIC b3_real = -c * (v3_real + sgn * v3_imag);
+          const ATOMIC b3_imag = -c * (v3_imag - sgn * v3_real);
+
+          const ATOMIC x1_real = a1_real + b1_real;
+          const ATOMIC x1_imag = a1_imag + b1_imag;
+          const ATOMIC x2_real = a2_real + b2_real;
+          const ATOMIC x2_imag = a2_imag + b2_imag;
+          const ATOMIC x3_real = a3_real + b3_real;
+          const ATOMIC x3_imag = a3_imag + b3_imag;
+          const ATOMIC x4_real = a0_real - b0_real;
+          const ATOMIC x4_imag = a0_imag - b0_imag;
+          const ATOMIC x5_real = a1_real - b1_real;
+          const ATOMIC x5_imag = a1_imag - b1_imag;
+          const ATOMIC x6_real = a2_real - b2_real;
+          const ATOMIC x6_imag = a2_imag - b2_imag;
+          const ATOMIC x7_real = a3_real - b3_real;
+          const ATOMIC x7_imag = a3_imag - b3_imag;
+
+          y[2 * k1] = a0_real + b0_real;
+          y[2 * k1 + 1] = a0_imag + b0_imag;
+
+          y[2 * (k1 + p_1)] = w1_real * x1_real - w1_imag * x1_imag;
+          y[2 * (k1 + p_1) + 1] = w1_real * x1_imag + w1_imag * x1_real;
+
+          y[2 * (k1 + 2 * p_1)] = w2_real * x2_real - w2_imag * x2_imag;
+          y[2 * (k1 + 2 * p_1) + 1] = w2_real * x2_imag + w2_imag * x2_real;
+
+          y[2 * (k1 + 3 * p_1)] = w3_real * x3_real - w3_imag * x3_imag;
+          y[2 * (k1 + 3 * p_1) + 1] = w3_real * x3_imag + w3_imag * x3_real;
+
+          y[2 * (k1 + 4 * p_1)] = w4_real * x4_real - w4_imag * x4_imag;
+          y[2 * (k1 + 4 * p_1) + 1] = w4_real * x4_imag + w4_imag * x4_real;
+
+          y[2 * (k1 + 5 * p_1)] = w5_real * x5_real - w5_imag * x5_imag;
+          y[2 * (k1 + 5 * p_1) + 1] = w5_real * x5_imag + w5_imag * x5_real;
+
+          y[2 * (k1 + 6 * p_1)] = w6_real * x6_real - w6_imag * x6_imag;
+          y[2 * (k1 + 6 * p_1) + 1] = w6_real * x6_imag + w6_imag * x6_real;
+
+          y[2 * (k1 + 7 * p_1)] = w7_real * x7_real - w7_imag * x7_imag;
+          y[2 * (k1 + 7 * p_1) + 1] = w7_real * x7_imag + w7_imag * x7_real;
+        }
+    }
+  return 0;
+}
+
+/* The first radix-8 pass, with product = 8. Here p_1 = 1, so the inner
+   loop of pass_8_unit has a single iteration and is not vectorized.
+   This version vectorizes the loop over k instead, which reads the
+   input contiguously and loads the twiddle factors from consecutive
+   elements. With single precision, where a vector holds twice as many
+   elements, this pass would otherwise be the slowest. The k = 0
+   butterfly, which has no twiddle factors, is computed by pass_8_unit
+   on a copy of its inputs. */
+
+static int
+FUNCTION(fft_complex,pass_8_unit_first) (const BASE * restrict in,
+                                         BASE * restrict out,
+                                         const gsl_fft_direction sign,
+                                         const size_t n,
+                                         const TYPE(gsl_complex) twiddle1[],
+                                         const TYPE(gsl_complex) twiddle2[],
+                                         const TYPE(gsl_complex) twiddle3[],
+                                         const TYPE(gsl_complex) twiddle4[],
+                                         const TYPE(gsl_complex) twiddle5[],
+                                         const TYPE(gsl_complex) twiddle6[],
+                                         const TYPE(gsl_complex) twiddle7[])
+{
+  size_t j, k;
+
+  const size_t factor = 8;
+  const size_t m = n / factor;
+
+  const ATOMIC sgn = (int) sign;
+  const ATOMIC c = M_SQRT1_2;
+
+  /* conjugate the twiddle factors for the backward transform */
+  const ATOMIC s = -sgn;
+
+  {
+    BASE z[2 * 8];
+
+    for (j = 0; j < factor; j++)
+      {
+        z[2 * j] = in[2 * j * m];
+        z[2 * j + 1] = in[2 * j * m + 1];
+      }
+
+    FUNCTION(fft_complex,pass_8_unit) (z, out, sign, factor, factor,
+                                       twiddle1, twiddle2, twiddle3, twiddle4,
+                                       twiddle5, twiddle6, twiddle7);
+  }
+
+  FFT_IVDEP
+  for (k = 1; k < m; k++)
+    {
+      const ATOMIC w1_real = GSL_REAL(twiddle1[k - 1]);
+      const ATOMIC w1_imag = s * GSL_IMAG(twiddle1[k - 1]);
+      const ATOMIC w2_real = GSL_REAL(twiddle2[k - 1]);
+      const ATOMIC w2_imag = s * GSL_IMAG(twiddle2[k - 1]);
+      const ATOMIC w3_real = GSL_REAL(twiddle3[k - 1]);
+      const ATOMIC w3_imag = s * GSL_IMAG(twiddle3[k - 1]);
+      const ATOMIC w4_real = GSL_REAL(twiddle4[k - 1]);
+      const ATOMIC w4_imag = s * GSL_IMAG(twiddle4[k - 1]);
+      const ATOMIC w5_real = GSL_REAL(twiddle5[k - 1]);
+      const ATOMIC w5_imag = s * GSL_IMAG(twiddle5[k - 1]);
+      const ATOMIC w6_real = GSL_REAL(twiddle6[k - 1]);
+      const ATOMIC w6_imag = s * GSL_IMAG(twiddle6[k - 1]);
+      const ATOMIC w7_real = GSL_REAL(twiddle7[k - 1]);
+      const ATOMIC w7_imag = s * GSL_IMAG(twiddle7[k - 1]);
+
+      BASE * restrict y = out + 2 * factor * k;
+
+      const ATOMIC z0_real = in[2 * k];
+      const ATOMIC z0_imag = in[2 * k + 1];
+      const ATOMIC z1_real = in[2 * (k + m)];
+      const ATOMIC z1_imag = in[2 * (k + m) + 1];
+      const ATOMIC z2_real = in[2 * (k + 2 * m)];
+      const ATOMIC z2_imag = in[2 * (k + 2 * m) + 1];
+      const ATOMIC z3_real = in[2 * (k + 3 * m)];
+      const ATOMIC z3_imag = in[2 * (k + 3 * m) + 1];
+      const ATOMIC z4_real = in[2 * (k + 4 * m)];
+      const ATOMIC z4_imag = in[2 * (k + 4 * m) + 1];
+      const ATOMIC z5_real = in[2 * (k + 5 * m)];
+      const ATOMIC z5_imag = in[2 * (k + 5 * m) + 1];
+      const ATOMIC z6_real = in[2 * (k + 6 * m)];
+      const ATOMIC z6_imag = in[2 * (k + 6 * m) + 1];
+      const ATOMIC z7_real = in[2 * (k + 7 * m)];
+      const ATOMIC z7_imag = in[2 * (k + 7 * m) + 1];
+
+      /* W(4) of the even elements, see pass_8 */
+      const ATOMIC t1_real = z0_real + z4_real;
+      const ATOMIC t1_imag = z0_imag + z4_imag;
+      const ATOMIC t2_real = z2_real + z6_real;
+      const ATOMIC t2_imag = z2_imag + z6_imag;
+      const ATOMIC t3_real = z0_real - z4_real;
+      const ATOMIC t3_imag = z0_imag - z4_imag;
+      const ATOMIC t4_real = sgn * (z2_real - z6_real);
+      const ATOMIC t4_imag = sgn * (z2_imag - z6_imag);
+
+      const ATOMIC a0_real = t1_real + t2_real;
+      const ATOMIC a0_imag = t1_imag + t2_imag;
+      const ATOMIC a1_real = t3_real - t4_imag;
+      const ATOMIC a1_imag = t3_imag + t4_real;
+      const ATOMIC a2_real = t1_real - t2_real;
+      const ATOMIC a2_imag = t1_imag - t2_imag;
+      const ATOMIC a3_real = t3_real + t4_imag;
+      const ATOMIC a3_imag = t3_imag - t4_real;
+
+      /* W(4) of the odd elements, multiplied by w8^k */
+      const ATOMIC u1_real = z1_real + z5_real;
+      const ATOMIC u1_imag = z1_imag + z5_imag;
+      const ATOMIC u2_real = z3_real + z7_real;
+      const ATOMIC u2_imag = z3_imag + z7_imag;
+      const ATOMIC u3_real = z1_real - z5_real;
+      const ATOMIC u3_imag = z1_imag - z5_imag;
+      const ATOMIC u4_real = sgn * (z3_real - z7_real);
+      const ATOMIC u4_imag = sgn * (z3_imag - z7_imag);
+
+      const ATOMIC v1_real = u3_real - u4_imag;
+      const ATOMIC v1_imag = u3_imag + u4_real;
+      const ATOMIC v3_real = u3_real + u4_imag;
+      const ATOMIC v3_imag = u3_imag - u4_real;
+
+      const ATOMIC b0_real = u1_real + u2_real;
+      const ATOMIC b0_imag = u1_imag + u2_imag;
+      const ATOMIC b1_real = c * (v1_real - sgn * v1_imag);
+      const ATOMIC b1_imag = c * (v1_imag + sgn * v1_real);
+      const ATOMIC b2_real = -sgn * (u1_imag - u2_imag);
+      const ATOMIC b2_imag = sgn * (u1_real - u2_real);
+      const ATOMIC b3_real = -c * (v3_real + sgn * v3_imag);
+      const ATOMIC b3_imag = -c * (v3_imag - sgn * v3_real);
+
+      const ATOMIC x1_real = a1_real + b1_real;
+      const ATOMIC x1_imag = a1_imag + b1_imag;
+      const ATOMIC x2_real = a2_real + b2_real;
+      const ATOMIC x2_imag = a2_imag + b2_imag;
+      const ATOMIC x3_real = a3_real + b3_real;
+      const ATOMIC x3_imag = a3_imag + b3_imag;
+      const ATOMIC x4_real = a0_real - b0_real;
+      const ATOMIC x4_imag = a0_imag - b0_imag;
+      const ATOMIC x5_real = a1_real - b1_real;
+      const ATOMIC x5_imag = a1_imag - b1_imag;
+      const ATOMIC x6_real = a2_real - b2_real;
+      const ATOMIC x6_imag = a2_imag - b2_imag;
+      const ATOMIC x7_real = a3_real - b3_real;
+      const ATOMIC x7_imag = a3_imag - b3_imag;
+
+      y[0] = a0_real + b0_real;
+      y[1] = a0_imag + b0_imag;
+
+      y[2] = w1_real * x1_real - w1_imag * x1_imag;
+      y[3] = w1_real * x1_imag + w1_imag * x1_real;
+
+      y[4] = w2_real * x2_real - w2_imag * x2_imag;
+      y[5] = w2_real * x2_imag + w2_imag * x2_real;
+
+      y[6] = w3_real * x3_real - w3_imag * x3_imag;
+      y[7] = w3_real * x3_imag + w3_imag * x3_real;
+
+      y[8] = w4_real * x4_real - w4_imag * x4_imag;
+      y[9] = w4_real * x4_imag + w4_imag * x4_real;
+
+      y[10] = w5_real * x5_real - w5_imag * x5_imag;
+      y[11] = w5_real * x5_imag + w5_imag * x5_real;
+
+      y[12] = w6_real * x6_real - w6_imag * x6_imag;
+      y[13] = w6_real * x6_imag + w6_imag * x6_real;
+
+      y[14] = w7_real * x7_real - w7_imag * x7_imag;
+      y[15] = w7_real * x7_imag + w7_imag * x7_real;
+    }
+  return 0;
+}
@@ -0,0 +1,557 @@
+/* fft/dct.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Discrete cosine and sine transforms.
+
+   DCT-II uses Makhoul's method: the even elements of x followed by the
+   odd elements in reverse order are transformed with a real FFT of
+   length n, and X_k = 2 Re(exp(-i pi k/2n) V_k). Since V is hermitian
+   one complex product gives both X_k and X_(n-k). DCT-III is the
+   transpose, computed with the same tables by running the steps
+   backwards through a halfcomplex transform.
+
+   DCT-IV for even n pairs x_2p with x_(n-1-2p) as one complex number
+   and uses a complex FFT of length n/2 between two twiddle steps. For
+   odd n the twiddled input is transformed with a complex FFT of length
+   2n, which is about four times slower.
+
+   DCT-I and DST-I are the transforms of the even and odd extensions of
+   x, with real FFTs of length 2(n-1) and 2(n+1).
+
+   The other sine transforms reduce to cosine transforms,
+
+     DST-II(x)_k  = DCT-II(x')_(n-1-k),     x'_j = (-1)^j x_j
+     DST-III(x)_k = (-1)^k DCT-III(x'')_k,  x''_j = x_(n-1-j)
+     DST-IV(x)_k  = (-1)^k DCT-IV(x'')_k */
+
+/* the transform used for the inverse of each type */
+
+static gsl_fft_dct_type
+FUNCTION(fft_dct,inverse_type) (const gsl_fft_dct_type type)
+{
+  switch (type)
+    {
+    case GSL_FFT_DCT_II:
+      return GSL_FFT_DCT_III;
+    case GSL_FFT_DCT_III:
+      return GSL_FFT_DCT_II;
+    case GSL_FFT_DST_II:
+      return GSL_FFT_DST_III;
+    case GSL_FFT_DST_III:
+      return GSL_FFT_DST_II;
+    default:
+      return type;
+    }
+}
+
+TYPE(gsl_fft_dct_workspace) *
+FUNCTION(gsl_fft_dct_workspace,alloc) (const gsl_fft_dct_type type,
+                                       const size_t n)
+{
+  TYPE(gsl_fft_dct_workspace) * w;
+  size_t k, ntwiddle = 0, nscratch = 0;
+
+  if (n == 0)
+    {
+      GSL_ERROR_VAL ("length n must be positive integer", GSL_EDOM, 0);
+    }
+
+  if (type == GSL_FFT_DCT_I && n < 2)
+    {
+      GSL_ERROR_VAL ("length n must be at least 2 for DCT-I", GSL_EDOM, 0);
+    }
+
+  w = (TYPE(gsl_fft_dct_workspace) *) calloc (1, sizeof (TYPE(gsl_fft_dct_workspace)));
+
+  if (w == NULL)
+    {
+      GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
+    }
+
+  w->type = type;
+  w->n = n;
+
+  switch (type)
+    {
+    case GSL_FFT_DCT_I:
+    case GSL_FFT_DST_I:
+      w->nfft = (type == GSL_FFT_DCT_I) ? 2 * (n - 1) : 2 * (n + 1);
+      nscratch = w->nfft;
+      w->real_wavetable = FUNCTION(gsl_fft_real_wavetable,alloc) (w->nfft);
+      w->real_work = FUNCTION(gsl_fft_real_workspace,alloc) (w->nfft);
+      break;
+    case GSL_FFT_DCT_II:
+    case GSL_FFT_DCT_III:
+    case GSL_FFT_DST_II:
+    case GSL_FFT_DST_III:
+      w->nfft = n;
+      nscratch = n;
+      ntwiddle = n / 2 + 1;
+      w->real_wavetable = FUNCTION(gsl_fft_real_wavetable,alloc) (n);
+      w->hc_wavetable = FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (n);
+      w->real_work = FUNCTION(gsl_fft_real_workspace,alloc) (n);
+      break;
+    case GSL_FFT_DCT_IV:
+    case GSL_FFT_DST_IV:
+      w->nfft = (n % 2 == 0) ? n / 2 : 2 * n;
+      nscratch = 2 * w->nfft;
+      ntwiddle = (n % 2 == 0) ? n : 2 * n;
+      w->wavetable = FUNCTION(gsl_fft_complex_wavetable,alloc) (w->nfft);
+      w->work = FUNCTION(gsl_fft_complex_workspace,alloc) (w->nfft);
+      break;
+    default:
+      free (w);
+      GSL_ERROR_VAL ("unknown transform type", GSL_EINVAL, 0);
+    }
+
+  w->scratch = (BASE *) malloc (nscratch * sizeof (BASE));
+  w->buf = (BASE *) malloc (n * sizeof (BASE));
+
+  if (ntwiddle > 0)
+    {
+      w->twiddle = (TYPE(gsl_complex) *) malloc (ntwiddle * sizeof (TYPE(gsl_complex)));
+    }
+
+  if (w->scratch == NULL || w->buf == NULL
+      || (ntwiddle > 0 && w->twiddle == NULL)
+      || (w->nfft > 0 && w->real_wavetable == NULL && w->wavetable == NULL)
+      || (w->real_wavetable != NULL && w->real_work == NULL)
+      || (w->wavetable != NULL && w->work == NULL)
+      || (w->real_wavetable != NULL && ntwiddle > 0 && w->hc_wavetable == NULL))
+    {
+      FUNCTION(gsl_fft_dct_workspace,free) (w);
+      GSL_ERROR_VAL ("failed to allocate space for transform", GSL_ENOMEM, 0);
+    }
+
+  if (type == GSL_FFT_DCT_IV || type == GSL_FFT_DST_IV)
+    {
+      /* pre-twiddle factors, then the post-twiddle factors */
+
+      const size_t m = ntwiddle / 2;
+      const double d = (n % 2 == 0) ? 1.0 : 0.5;
+
+      for (k = 0; k < m; k++)
+        {
+          const double theta1 = -M_PI * d * (double) k / (double) n;
+          const double theta2 = -M_PI * (4.0 * d * k + 1.0) / (4.0 * n);
+          GSL_REAL(w->twiddle[k]) = cos (theta1);
+          GSL_IMAG(w->twiddle[k]) = sin (theta1);
+          GSL_REAL(w->twiddle[m + k]) = cos (theta2);
+          GSL_IMAG(w->twiddle[m + k]) = sin (theta2);
+        }
+    }
+  else
+    {
+      for (k = 0; k < ntwiddle; k++)
+        {
+          const double theta = -M_PI * (double) k / (2.0 * n);
+          GSL_REAL(w->twiddle[k]) = cos (theta);
+          GSL_IMAG(w->twiddle[k]) = sin (theta);
+        }
+    }
+
+  return w;
+}
+
+void
+FUNCTION(gsl_fft_dct_workspace,free) (TYPE(gsl_fft_dct_workspace) * w)
+{
+  RETURN_IF_NULL (w);
+
+  FUNCTION(gsl_fft_real_wavetable,free) (w->real_wavetable);
+  FUNCTION(gsl_fft_halfcomplex_wavetable,free) (w->hc_wavetable);
+  FUNCTION(gsl_fft_real_workspace,free) (w->real_work);
+  FUNCTION(gsl_fft_complex_wavetable,free) (w->wavetable);
+  FUNCTION(gsl_fft_complex_workspace,free) (w->work);
+  free (w->twiddle);
+  free (w->scratch);
+  free (w->buf);
+  free (w);
+}
+
+static int
+FUNCTION(fft_dct,type_1) (const BASE x[], const size_t xstride,
+                          BASE y[], const size_t ystride,
+                          TYPE(gsl_fft_dct_workspace) * w)
+{
+  const size_t n = w->n;
+  const size_t m = n - 1;
+  BASE * const s = w->scratch;
+  size_t j;
+  int status;
+
+  /* even extension x_0 .. x_m, x_(m-1) .. x_1 */
+
+  for (j = 0; j < n; j++)
+    {
+      s[j] = x[j * xstride];
+    }
+
+  for (j = 1; j < m; j++)
+    {
+      s[2 * m - j] = s[j];
+    }
+
+  status = FUNCTION(gsl_fft_real,transform) (s, 1, 2 * m, w->real_wavetable,
+                                             w->real_work);
+  if (status)
+    {
+      return status;
+    }
+
+  y[0] = s[0];
+
+  for (j = 1; j < m; j++)
+    {
+      y[j * ystride] = s[2 * j - 1];
+    }
+
+  y[m * ystride] = s[2 * m - 1];
+
+  return GSL_SUCCESS;
+}
+
+static int
+FUNCTION(fft_dst,type_1) (const BASE x[], const size_t xstride,
+                          BASE y[], const size_t ystride,
+                          TYPE(gsl_fft_dct_workspace) * w)
+{
+  const size_t n = w->n;
+  const size_t m = n + 1;
+  BASE * const s = w->scratch;
+  size_t j;
+  int status;
+
+  /* odd extension 0, x_0 .. x_(n-1), 0, -x_(n-1) .. -x_0 */
+
+  s[0] = 0.0;
+  s[m] = 0.0;
+
+  for (j = 0; j < n; j++)
+    {
+      s[j + 1] = x[j * xstride];
+      s[2 * m - 1 - j] = -s[j + 1];
+    }
+
+  status = FUNCTION(gsl_fft_real,transform) (s, 1, 2 * m, w->real_wavetable,
+                                             w->real_work);
+  if (status)
+    {
+      return status;
+    }
+
+  for (j = 0; j < n; j++)
+    {
+      y[j * ystride] = -s[2 * (j + 1)];
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+FUNCTION(fft_dct,type_2) (const BASE x[], const size_t xstride,
+                          BASE y[], const size_t ystride,
+                          TYPE(gsl_fft_dct_workspace) * w)
+{
+  const size_t n = w->n;
+  const TYPE(gsl_complex) * const twiddle = w->twiddle;
+  BASE * const v = w->scratch;
+  size_t j, k;
+  int status;
+
+  for (j = 0; 2 * j < n; j++)
+    {
+      v[j] = x[2 * j * xstride];
+    }
+
+  for (j = 0; 2 * j + 1 < n; j++)
+    {
+      v[n - 1 - j] = x[(2 * j + 1) * xstride];
+    }
+
+  status = FUNCTION(gsl_fft_real,transform) (v, 1, n, w->real_wavetable,
+                                             w->real_work);
+  if (status)
+    {
+      return status;
+    }
+
+  y[0] = 2 * v[0];
+
+  for (k = 1; 2 * k < n; k++)
+    {
+      const ATOMIC v_real = v[2 * k - 1];
+      const ATOMIC v_imag = v[2 * k];
+      const ATOMIC w_real = GSL_REAL(twiddle[k]);
+      const ATOMIC w_imag = GSL_IMAG(twiddle[k]);
+
+      y[k * ystride] = 2 * (w_real * v_real - w_imag * v_imag);
+      y[(n - k) * ystride] = -2 * (w_real * v_imag + w_imag * v_real);
+    }
+
+  if (n % 2 == 0)
+    {
+      y[(n / 2) * ystride] = M_SQRT2 * v[n - 1];
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+FUNCTION(fft_dct,type_3) (const BASE x[], const size_t xstride,
+                          BASE y[], const size_t ystride,
+                          TYPE(gsl_fft_dct_workspace) * w)
+{
+  const size_t n = w->n;
+  const TYPE(gsl_complex) * const twiddle = w->twiddle;
+  BASE * const v = w->scratch;
+  size_t j, k;
+  int status;
+
+  /* V_k = conj(w_k) (x_k - i x_(n-k)) in halfcomplex order */
+
+  v[0] = x[0];
+
+  for (k = 1; 2 * k < n; k++)
+    {
+      const ATOMIC a = x[k * xstride];
+      const ATOMIC b = x[(n - k) * xstride];
+      const ATOMIC w_real = GSL_REAL(twiddle[k]);
+      const ATOMIC w_imag = GSL_IMAG(twiddle[k]);
+
+      v[2 * k - 1] = w_real * a - w_imag * b;
+      v[2 * k] = -w_imag * a - w_real * b;
+    }
+
+  if (n % 2 == 0)
+    {
+      v[n - 1] = M_SQRT2 * x[(n / 2) * xstride];
+    }
+
+  status = FUNCTION(gsl_fft_halfcomplex,transform) (v, 1, n, w->hc_wavetable,
+                                                    w->real_work);
+  if (status)
+    {
+      return status;
+    }
+
+  for (j = 0; 2 * j < n; j++)
+    {
+      y[2 * j * ystride] = v[j];
+    }
+
+  for (j = 0; 2 * j + 1 < n; j++)
+    {
+      y[(2 * j + 1) * ystride] = v[n - 1 - j];
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+FUNCTION(fft_dct,type_4) (const BASE x[], const size_t xstride,
+                          BASE y[], const size_t ystride,
+                          TYPE(gsl_fft_dct_workspace) * w)
+{
+  const size_t n = w->n;
+  const size_t m = w->nfft;
+  const TYPE(gsl_complex) * const pre = w->twiddle;
+  BASE * const z = w->scratch;
+  size_t j, k;
+  int status;
+
+  if (n % 2 == 0)
+    {
+      const TYPE(gsl_complex) * const post = w->twiddle + m;
+
+      for (j = 0; j < m; j++)
+        {
+          const ATOMIC a = x[2 * j * xstride];
+          const ATOMIC b = x[(n - 1 - 2 * j) * xstride];
+          const ATOMIC w_real = GSL_REAL(pre[j]);
+          const ATOMIC w_imag = GSL_IMAG(pre[j]);
+
+          REAL(z,1,j) = w_real * a - w_imag * b;
+          IMAG(z,1,j) = w_real * b + w_imag * a;
+        }
+
+      status = FUNCTION(gsl_fft_complex,forward) (z, 1, m, w->wavetable,
+                                                  w->work);
+      if (status)
+        {
+          return status;
+        }
+
+      for (k = 0; k < m; k++)
+        {
+          const ATOMIC z_real = REAL(z,1,k);
+          const ATOMIC z_imag = IMAG(z,1,k);
+          const ATOMIC w_real = GSL_REAL(post[k]);
+          const ATOMIC w_imag = GSL_IMAG(post[k]);
+
+          y[2 * k * ystride] = 2 * (w_real * z_real - w_imag * z_imag);
+          y[(n - 1 - 2 * k) * ystride] = -2 * (w_real * z_imag + w_imag * z_real);
+        }
+    }
+  else
+    {
+      const TYPE(gsl_complex) * const post = w->twiddle + n;
+
+      for (j = 0; j < n; j++)
+        {
+          const ATOMIC a = x[j * xstride];
+          REAL(z,1,j) = GSL_REAL(pre[j]) * a;
+          IMAG(z,1,j) = GSL_IMAG(pre[j]) * a;
+        }
+
+      for (j = n; j < m; j++)
+        {
+          REAL(z,1,j) = 0.0;
+          IMAG(z,1,j) = 0.0;
+        }
+
+      status = FUNCTION(gsl_fft_complex,forward) (z, 1, m, w->wavetable,
+                                                  w->work);
+      if (status)
+        {
+          return status;
+        }
+
+      for (k = 0; k < n; k++)
+        {
+          y[k * ystride] = 2 * (GSL_REAL(post[k]) * REAL(z,1,k)
+                                - GSL_IMAG(post[k]) * IMAG(z,1,k));
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+FUNCTION(fft_dct,apply) (BASE data[], const size_t stride,
+                         const gsl_fft_dct_type type,
+                         TYPE(gsl_fft_dct_workspace) * w)
+{
+  const size_t n = w->n;
+  BASE * const buf = w->buf;
+  size_t j;
+  int status;
+
+  switch (type)
+    {
+    case GSL_FFT_DCT_I:
+      return FUNCTION(fft_dct,type_1) (data, stride, data, stride, w);
+    case GSL_FFT_DCT_II:
+      return FUNCTION(fft_dct,type_2) (data, stride, data, stride, w);
+    case GSL_FFT_DCT_III:
+      return FUNCTION(fft_dct,type_3) (data, stride, data, stride, w);
+    case GSL_FFT_DCT_IV:
+      return FUNCTION(fft_dct,type_4) (data, stride, data, stride, w);
+    case GSL_FFT_DST_I:
+      return FUNCTION(fft_dst,type_1) (data, stride, data, stride, w);
+    case GSL_FFT_DST_II:
+      for (j = 0; j < n; j++)
+        {
+          buf[j] = (j % 2) ? -data[j * stride] : data[j * stride];
+        }
+
+      status = FUNCTION(fft_dct,type_2) (buf, 1, buf, 1, w);
+
+      for (j = 0; j < n; j++)
+        {
+          data[j * stride] = buf[n - 1 - j];
+        }
+
+      return status;
+    case GSL_FFT_DST_III:
+    case GSL_FFT_DST_IV:
+      for (j = 0; j < n; j++)
+        {
+          buf[j] = data[(n - 1 - j) * stride];
+        }
+
+      if (type == GSL_FFT_DST_III)
+        status = FUNCTION(fft_dct,type_3) (buf, 1, data, stride, w);
+      else
+        status = FUNCTION(fft_dct,type_4) (buf, 1, data, stride, w);
+
+      for (j = 1; j < n; j += 2)
+        {
+          data[j * stride] = -data[j * stride];
+        }
+
+      return status;
+    default:
+      GSL_ERROR ("unknown transform type", GSL_EINVAL);
+    }
+}
+
+int
+FUNCTION(gsl_fft_dct,transform) (BASE data[], const size_t stride,
+                                 const size_t n,
+                                 TYPE(gsl_fft_dct_workspace) * w)
+{
+  if (n != w->n)
+    {
+      GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
+    }
+
+  return FUNCTION(fft_dct,apply) (data, stride, w->type, w);
+}
+
+int
+FUNCTION(gsl_fft_dct,inverse) (BASE data[], const size_t stride,
+                               const size_t n,
+                               TYPE(gsl_fft_dct_workspace) * w)
+{
+  int status;
+
+  if (n != w->n)
+    {
+      GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
+    }
+
+  status = FUNCTION(fft_dct,apply) (data, stride,
+                                    FUNCTION(fft_dct,inverse_type) (w->type),
+                                    w);
+  if (status)
+    {
+      return status;
+    }
+
+  /* normalize with the logical length 2(n-1), 2(n+1) or 2n */
+
+  {
+    size_t norm_n = 2 * n;
+    ATOMIC norm;
+    size_t i;
+
+    if (w->type == GSL_FFT_DCT_I)
+      norm_n = 2 * (n - 1);
+    else if (w->type == GSL_FFT_DST_I)
+      norm_n = 2 * (n + 1);
+
+    norm = 1.0 / (double) norm_n;
+
+    for (i = 0; i < n; i++)
+      {
+        data[i * stride] *= norm;
+      }
+  }
+
+  return status;
+}
@@ -29,10 +29,13 @@ fft_complex_factorize (const size_t n,
                            size_t factors[])
 {
   const size_t complex_subtransforms[] =
-  {7, 6, 5, 4, 3, 2, 0};
+  {8, 7, 6, 5, 4, 3, 2, 0};
 
   /* other factors can be added here if their transform modules are
-     implemented. The end of the list is marked by 0. */
+     implemented. The end of the list is marked by 0. Factors of 8 are
+     taken first since the radix-8 pass needs the fewest passes over
+     the data, and together with 4 and 2 has a vectorized unit stride
+     version. */
 
   int status = fft_factorize (n, complex_subtransforms, nf, factors);
   return status;
@@ -174,3 +177,30 @@ fft_binary_logn (const size_t n)
 
 
 
+
+/* fft_good_length() returns the smallest length m >= n of the form
+   2^a 3^b 5^c, which the mixed-radix real and complex transforms
+   handle with their efficient modules only. */
+
+static size_t
+fft_good_length (const size_t n)
+{
+  size_t m = (n == 0) ? 1 : n;
+
+  for (;; m++)
+    {
+      size_t r = m;
+
+      while (r % 2 == 0)
+        r /= 2;
+      while (r % 3 == 0)
+        r /= 3;
+      while (r % 5 == 0)
+        r /= 5;
+
+      if (r == 1)
+        {
+          return m;
+        }
+    }
+}
@@ -27,3 +27,5 @@ static int fft_factorize (const size_t n, const size_t implemented_subtransforms
 
 static int fft_binary_logn (const size_t n) ;
 
+static size_t fft_good_length (const size_t n);
+
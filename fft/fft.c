@@ -5,10 +5,17 @@
 #include <math.h>
 
 #include <gsl/gsl_errno.h>
+#include <gsl/gsl_minmax.h>
 #include <gsl/gsl_complex.h>
 
 #include <gsl/gsl_fft_complex.h>
 #include <gsl/gsl_fft_complex_float.h>
+#include <gsl/gsl_fft_multidim.h>
+#include <gsl/gsl_fft_multidim_float.h>
+#include <gsl/gsl_fft_convolve.h>
+#include <gsl/gsl_fft_convolve_float.h>
+#include <gsl/gsl_fft_dct.h>
+#include <gsl/gsl_fft_dct_float.h>
 
 #define BASE_DOUBLE
 #include "templates_on.h"
@@ -23,9 +30,13 @@
 #undef  BASE_FLOAT
 
 #include "factorize.c"
+#include "parallel.h"
+#include "bytes.h"
 
 #define BASE_DOUBLE
 #include "templates_on.h"
+#include "c_bluestein.c"
+#include "c_fourstep.c"
 #include "c_init.c"
 #include "c_main.c"
 #include "c_pass_2.c"
@@ -34,13 +45,22 @@
 #include "c_pass_5.c"
 #include "c_pass_6.c"
 #include "c_pass_7.c"
+#include "c_pass_8.c"
+#include "c_pass_unit.c"
 #include "c_pass_n.c"
+#include "c_pass_bluestein.c"
 #include "c_radix2.c"
+#include "c_md.c"
+#include "c_batch.c"
+#include "c_conv.c"
+#include "real_half.c"
 #include "templates_off.h"
 #undef  BASE_DOUBLE
 
 #define BASE_FLOAT
 #include "templates_on.h"
+#include "c_bluestein.c"
+#include "c_fourstep.c"
 #include "c_init.c"
 #include "c_main.c"
 #include "c_pass_2.c"
@@ -49,8 +69,15 @@
 #include "c_pass_5.c"
 #include "c_pass_6.c"
 #include "c_pass_7.c"
+#include "c_pass_8.c"
+#include "c_pass_unit.c"
 #include "c_pass_n.c"
+#include "c_pass_bluestein.c"
 #include "c_radix2.c"
+#include "c_md.c"
+#include "c_batch.c"
+#include "c_conv.c"
+#include "real_half.c"
 #include "templates_off.h"
 #undef  BASE_FLOAT
 
@@ -66,6 +93,7 @@
 #include "hc_pass_4.c"
 #include "hc_pass_5.c"
 #include "hc_pass_n.c"
+#include "hc_pass_bluestein.c"
 #include "hc_radix2.c"
 #include "hc_unpack.c"
 #include "templates_off.h"
@@ -80,6 +108,7 @@
 #include "hc_pass_4.c"
 #include "hc_pass_5.c"
 #include "hc_pass_n.c"
+#include "hc_pass_bluestein.c"
 #include "hc_radix2.c"
 #include "hc_unpack.c"
 #include "templates_off.h"
@@ -97,8 +126,12 @@
 #include "real_pass_4.c"
 #include "real_pass_5.c"
 #include "real_pass_n.c"
+#include "real_pass_bluestein.c"
 #include "real_radix2.c"
 #include "real_unpack.c"
+#include "real_md.c"
+#include "real_conv.c"
+#include "dct.c"
 #include "templates_off.h"
 #undef  BASE_DOUBLE
 
@@ -111,7 +144,11 @@
 #include "real_pass_4.c"
 #include "real_pass_5.c"
 #include "real_pass_n.c"
+#include "real_pass_bluestein.c"
 #include "real_radix2.c"
 #include "real_unpack.c"
+#include "real_md.c"
+#include "real_conv.c"
+#include "dct.c"
 #include "templates_off.h"
 #undef  BASE_FLOAT
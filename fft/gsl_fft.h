@@ -46,6 +46,15 @@ gsl_fft_direction;
        
    where - is the forward transform direction and + the inverse direction */
 
+/* the real-to-real cosine and sine transforms, see gsl_fft_dct.h */
+
+typedef enum
+  {
+    GSL_FFT_DCT_I, GSL_FFT_DCT_II, GSL_FFT_DCT_III, GSL_FFT_DCT_IV,
+    GSL_FFT_DST_I, GSL_FFT_DST_II, GSL_FFT_DST_III, GSL_FFT_DST_IV
+  }
+gsl_fft_dct_type;
+
 __END_DECLS
 
 #endif /* __GSL_FFT_H__ */
@@ -84,6 +84,8 @@ typedef struct
     size_t factor[64];
     gsl_complex *twiddle[64];
     gsl_complex *trig;
+    void *bluestein[64];   /* private, for prime factors above 90 */
+    void *fourstep;        /* private, for lengths from 2^22 */
   }
 gsl_fft_complex_wavetable;
 
@@ -91,6 +93,7 @@ typedef struct
 {
   size_t n;
   double *scratch;
+  size_t nthreads;
 }
 gsl_fft_complex_workspace;
 
@@ -103,6 +106,9 @@ gsl_fft_complex_workspace *gsl_fft_complex_workspace_alloc (size_t n);
 
 void gsl_fft_complex_workspace_free (gsl_fft_complex_workspace * workspace);
 
+int gsl_fft_complex_workspace_set_threads (gsl_fft_complex_workspace * workspace,
+                                           const size_t nthreads);
+
 int gsl_fft_complex_memcpy (gsl_fft_complex_wavetable * dest,
                             gsl_fft_complex_wavetable * src);
 
@@ -131,6 +137,50 @@ int gsl_fft_complex_transform (gsl_complex_packed_array data,
                                gsl_fft_complex_workspace * work,
                                const gsl_fft_direction sign);
 
+/* Batches of howmany transforms of length n, with element j of
+   sequence t at data[t*dist + j*stride] */
+
+typedef struct
+{
+  size_t n;
+  size_t block;
+  double *scratch;
+  size_t nthreads;
+}
+gsl_fft_complex_batch_workspace;
+
+gsl_fft_complex_batch_workspace *gsl_fft_complex_batch_workspace_alloc (size_t n);
+
+void gsl_fft_complex_batch_workspace_free (gsl_fft_complex_batch_workspace * work);
+
+int gsl_fft_complex_batch_workspace_set_threads (gsl_fft_complex_batch_workspace * work,
+                                                const size_t nthreads);
+
+int gsl_fft_complex_batch_forward (gsl_complex_packed_array data,
+                                   const size_t stride, const size_t dist,
+                                   const size_t n, const size_t howmany,
+                                   const gsl_fft_complex_wavetable * wavetable,
+                                   gsl_fft_complex_batch_workspace * work);
+
+int gsl_fft_complex_batch_backward (gsl_complex_packed_array data,
+                                    const size_t stride, const size_t dist,
+                                    const size_t n, const size_t howmany,
+                                    const gsl_fft_complex_wavetable * wavetable,
+                                    gsl_fft_complex_batch_workspace * work);
+
+int gsl_fft_complex_batch_inverse (gsl_complex_packed_array data,
+                                   const size_t stride, const size_t dist,
+                                   const size_t n, const size_t howmany,
+                                   const gsl_fft_complex_wavetable * wavetable,
+                                   gsl_fft_complex_batch_workspace * work);
+
+int gsl_fft_complex_batch_transform (gsl_complex_packed_array data,
+                                     const size_t stride, const size_t dist,
+                                     const size_t n, const size_t howmany,
+                                     const gsl_fft_complex_wavetable * wavetable,
+                                     gsl_fft_complex_batch_workspace * work,
+                                     const gsl_fft_direction sign);
+
 __END_DECLS
 
 #endif /* __GSL_FFT_COMPLEX_H__ */
@@ -84,6 +84,8 @@ typedef struct
     size_t factor[64];
     gsl_complex_float *twiddle[64];
     gsl_complex_float *trig;
+    void *bluestein[64];   /* private, for prime factors above 90 */
+    void *fourstep;        /* private, for lengths from 2^22 */
   }
 gsl_fft_complex_wavetable_float;
 
@@ -91,6 +93,7 @@ typedef struct
 {
     size_t n;
     float *scratch;
+    size_t nthreads;
 }
 gsl_fft_complex_workspace_float;
 
@@ -103,6 +106,9 @@ gsl_fft_complex_workspace_float *gsl_fft_complex_workspace_float_alloc (size_t n
 
 void gsl_fft_complex_workspace_float_free (gsl_fft_complex_workspace_float * workspace);
 
+int gsl_fft_complex_workspace_float_set_threads (gsl_fft_complex_workspace_float * workspace,
+                                                 const size_t nthreads);
+
 
 int gsl_fft_complex_float_memcpy (gsl_fft_complex_wavetable_float * dest,
                                gsl_fft_complex_wavetable_float * src);
@@ -132,6 +138,50 @@ int gsl_fft_complex_float_transform (gsl_complex_packed_array_float data,
                                      gsl_fft_complex_workspace_float * work,
                                      const gsl_fft_direction sign);
 
+/* Batches of howmany transforms of length n, with element j of
+   sequence t at data[t*dist + j*stride] */
+
+typedef struct
+{
+  size_t n;
+  size_t block;
+  float *scratch;
+  size_t nthreads;
+}
+gsl_fft_complex_batch_workspace_float;
+
+gsl_fft_complex_batch_workspace_float *gsl_fft_complex_batch_workspace_float_alloc (size_t n);
+
+void gsl_fft_complex_batch_workspace_float_free (gsl_fft_complex_batch_workspace_float * work);
+
+int gsl_fft_complex_batch_workspace_float_set_threads (gsl_fft_complex_batch_workspace_float * work,
+                                                      const size_t nthreads);
+
+int gsl_fft_complex_float_batch_forward (gsl_complex_packed_array_float data,
+                                         const size_t stride, const size_t dist,
+                                         const size_t n, const size_t howmany,
+                                         const gsl_fft_complex_wavetable_float * wavetable,
+                                         gsl_fft_complex_batch_workspace_float * work);
+
+int gsl_fft_complex_float_batch_backward (gsl_complex_packed_array_float data,
+                                          const size_t stride, const size_t dist,
+                                          const size_t n, const size_t howmany,
+                                          const gsl_fft_complex_wavetable_float * wavetable,
+                                          gsl_fft_complex_batch_workspace_float * work);
+
+int gsl_fft_complex_float_batch_inverse (gsl_complex_packed_array_float data,
+                                         const size_t stride, const size_t dist,
+                                         const size_t n, const size_t howmany,
+                                         const gsl_fft_complex_wavetable_float * wavetable,
+                                         gsl_fft_complex_batch_workspace_float * work);
+
+int gsl_fft_complex_float_batch_transform (gsl_complex_packed_array_float data,
+                                           const size_t stride, const size_t dist,
+                                           const size_t n, const size_t howmany,
+                                           const gsl_fft_complex_wavetable_float * wavetable,
+                                           gsl_fft_complex_batch_workspace_float * work,
+                                           const gsl_fft_direction sign);
+
 __END_DECLS
 
 #endif /* __GSL_FFT_COMPLEX_FLOAT_H__ */
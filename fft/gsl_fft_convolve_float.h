@@ -0,0 +1,148 @@
+/* fft/gsl_fft_convolve_float.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_FFT_CONVOLVE_FLOAT_H__
+#define __GSL_FFT_CONVOLVE_FLOAT_H__
+
+#include <stddef.h>
+
+#include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex_float.h>
+#include <gsl/gsl_fft_real_float.h>
+#include <gsl/gsl_fft_halfcomplex_float.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* Linear convolution and correlation of a signal of up to nx elements
+   with a kernel of nk elements. The transform of the kernel is
+   computed once, for a transform length n >= nx + nk - 1. */
+
+typedef struct
+  {
+    size_t nk;
+    size_t nx;
+    size_t n;
+    gsl_fft_real_wavetable_float * real_wavetable;
+    gsl_fft_halfcomplex_wavetable_float * hc_wavetable;
+    gsl_fft_real_workspace_float * work;
+    float * kernel;
+    float * data;
+  }
+gsl_fft_real_convolution_float;
+
+typedef struct
+  {
+    size_t nk;
+    size_t nx;
+    size_t n;
+    gsl_fft_complex_wavetable_float * wavetable;
+    gsl_fft_complex_workspace_float * work;
+    float * kernel;
+    float * data;
+  }
+gsl_fft_complex_convolution_float;
+
+/* Streaming convolution of a real signal by the overlap-save method.
+   Each transform of length n filters step = n - nk + 1 new samples,
+   and the output is delayed by step samples. */
+
+typedef struct
+  {
+    size_t nk;
+    size_t n;
+    size_t step;
+    size_t fill;
+    gsl_fft_real_wavetable_float * real_wavetable;
+    gsl_fft_halfcomplex_wavetable_float * hc_wavetable;
+    gsl_fft_real_workspace_float * work;
+    float * kernel;
+    float * in;
+    float * out;
+    float * data;
+  }
+gsl_fft_real_overlap_save_float;
+
+gsl_fft_real_convolution_float * gsl_fft_real_convolution_float_alloc (const float kernel[],
+                                                                       const size_t stride,
+                                                                       const size_t nk,
+                                                                       const size_t nx);
+
+void gsl_fft_real_convolution_float_free (gsl_fft_real_convolution_float * c);
+
+int gsl_fft_real_float_convolve (gsl_fft_real_convolution_float * c,
+                                 const float x[],
+                                 const size_t xstride,
+                                 const size_t nx,
+                                 float y[],
+                                 const size_t ystride);
+
+int gsl_fft_real_float_correlate (gsl_fft_real_convolution_float * c,
+                                  const float x[],
+                                  const size_t xstride,
+                                  const size_t nx,
+                                  float y[],
+                                  const size_t ystride);
+
+gsl_fft_complex_convolution_float * gsl_fft_complex_convolution_float_alloc (gsl_const_complex_packed_array_float kernel,
+                                                                             const size_t stride,
+                                                                             const size_t nk,
+                                                                             const size_t nx);
+
+void gsl_fft_complex_convolution_float_free (gsl_fft_complex_convolution_float * c);
+
+int gsl_fft_complex_float_convolve (gsl_fft_complex_convolution_float * c,
+                                    gsl_const_complex_packed_array_float x,
+                                    const size_t xstride,
+                                    const size_t nx,
+                                    gsl_complex_packed_array_float y,
+                                    const size_t ystride);
+
+int gsl_fft_complex_float_correlate (gsl_fft_complex_convolution_float * c,
+                                     gsl_const_complex_packed_array_float x,
+                                     const size_t xstride,
+                                     const size_t nx,
+                                     gsl_complex_packed_array_float y,
+                                     const size_t ystride);
+
+gsl_fft_real_overlap_save_float * gsl_fft_real_overlap_save_float_alloc (const float kernel[],
+                                                                         const size_t stride,
+                                                                         const size_t nk);
+
+void gsl_fft_real_overlap_save_float_free (gsl_fft_real_overlap_save_float * s);
+
+void gsl_fft_real_overlap_save_float_reset (gsl_fft_real_overlap_save_float * s);
+
+int gsl_fft_real_overlap_save_float_process (gsl_fft_real_overlap_save_float * s,
+                                             const float x[],
+                                             const size_t xstride,
+                                             const size_t nx,
+                                             float y[],
+                                             const size_t ystride);
+
+__END_DECLS
+
+#endif /* __GSL_FFT_CONVOLVE_FLOAT_H__ */
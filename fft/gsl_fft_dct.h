@@ -0,0 +1,78 @@
+/* fft/gsl_fft_dct.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_FFT_DCT_H__
+#define __GSL_FFT_DCT_H__
+
+#include <stddef.h>
+
+#include <gsl/gsl_complex.h>
+#include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* Discrete cosine and sine transforms of types I-IV, computed with
+   real or complex FFTs. A workspace is for one type and length, and
+   also computes the inverse transform. */
+
+typedef struct
+  {
+    gsl_fft_dct_type type;
+    size_t n;
+    size_t nfft;
+    gsl_fft_real_wavetable * real_wavetable;
+    gsl_fft_halfcomplex_wavetable * hc_wavetable;
+    gsl_fft_real_workspace * real_work;
+    gsl_fft_complex_wavetable * wavetable;
+    gsl_fft_complex_workspace * work;
+    gsl_complex * twiddle;
+    double * scratch;
+    double * buf;
+  }
+gsl_fft_dct_workspace;
+
+gsl_fft_dct_workspace * gsl_fft_dct_workspace_alloc (const gsl_fft_dct_type type,
+                                                     const size_t n);
+
+void gsl_fft_dct_workspace_free (gsl_fft_dct_workspace * w);
+
+int gsl_fft_dct_transform (double data[],
+                           const size_t stride,
+                           const size_t n,
+                           gsl_fft_dct_workspace * w);
+
+int gsl_fft_dct_inverse (double data[],
+                         const size_t stride,
+                         const size_t n,
+                         gsl_fft_dct_workspace * w);
+
+__END_DECLS
+
+#endif /* __GSL_FFT_DCT_H__ */
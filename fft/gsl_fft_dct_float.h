@@ -0,0 +1,78 @@
+/* fft/gsl_fft_dct_float.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_FFT_DCT_FLOAT_H__
+#define __GSL_FFT_DCT_FLOAT_H__
+
+#include <stddef.h>
+
+#include <gsl/gsl_complex.h>
+#include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex_float.h>
+#include <gsl/gsl_fft_real_float.h>
+#include <gsl/gsl_fft_halfcomplex_float.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* Discrete cosine and sine transforms of types I-IV, computed with
+   real or complex FFTs. A workspace is for one type and length, and
+   also computes the inverse transform. */
+
+typedef struct
+  {
+    gsl_fft_dct_type type;
+    size_t n;
+    size_t nfft;
+    gsl_fft_real_wavetable_float * real_wavetable;
+    gsl_fft_halfcomplex_wavetable_float * hc_wavetable;
+    gsl_fft_real_workspace_float * real_work;
+    gsl_fft_complex_wavetable_float * wavetable;
+    gsl_fft_complex_workspace_float * work;
+    gsl_complex_float * twiddle;
+    float * scratch;
+    float * buf;
+  }
+gsl_fft_dct_workspace_float;
+
+gsl_fft_dct_workspace_float * gsl_fft_dct_workspace_float_alloc (const gsl_fft_dct_type type,
+                                                                 const size_t n);
+
+void gsl_fft_dct_workspace_float_free (gsl_fft_dct_workspace_float * w);
+
+int gsl_fft_dct_float_transform (float data[],
+                                 const size_t stride,
+                                 const size_t n,
+                                 gsl_fft_dct_workspace_float * w);
+
+int gsl_fft_dct_float_inverse (float data[],
+                               const size_t stride,
+                               const size_t n,
+                               gsl_fft_dct_workspace_float * w);
+
+__END_DECLS
+
+#endif /* __GSL_FFT_DCT_FLOAT_H__ */
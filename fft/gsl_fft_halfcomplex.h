@@ -50,6 +50,8 @@ typedef struct
     size_t factor[64];
     gsl_complex *twiddle[64];
     gsl_complex *trig;
+    void *bluestein[64];   /* private, for prime factors above 90 */
+    void *half;            /* private, for even lengths from 512 */
   }
 gsl_fft_halfcomplex_wavetable;
 
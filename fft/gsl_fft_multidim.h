@@ -0,0 +1,179 @@
+/* fft/gsl_fft_multidim.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_FFT_MULTIDIM_H__
+#define __GSL_FFT_MULTIDIM_H__
+
+#include <stddef.h>
+
+#include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* Multidimensional transforms of row-major arrays. The workspaces hold
+   the wavetables for each dimension and scratch space for nthreads
+   threads. */
+
+typedef struct
+  {
+    size_t n1;
+    size_t n2;
+    size_t nthreads;
+    gsl_fft_complex_wavetable * wavetable1;
+    gsl_fft_complex_wavetable * wavetable2;
+    gsl_fft_complex_workspace ** work1;
+    gsl_fft_complex_workspace ** work2;
+    double * block;
+  }
+gsl_fft_complex_2d_workspace;
+
+typedef struct
+  {
+    size_t n1;
+    size_t n2;
+    size_t n3;
+    size_t nthreads;
+    gsl_fft_complex_wavetable * wavetable1;
+    gsl_fft_complex_wavetable * wavetable2;
+    gsl_fft_complex_wavetable * wavetable3;
+    gsl_fft_complex_workspace ** work1;
+    gsl_fft_complex_workspace ** work2;
+    gsl_fft_complex_workspace ** work3;
+    double * block;
+  }
+gsl_fft_complex_3d_workspace;
+
+typedef struct
+  {
+    size_t n1;
+    size_t n2;
+    size_t nthreads;
+    gsl_fft_complex_wavetable * wavetable;
+    gsl_fft_real_wavetable * real_wavetable;
+    gsl_fft_halfcomplex_wavetable * hc_wavetable;
+    gsl_fft_complex_workspace ** work;
+    gsl_fft_real_workspace ** real_work;
+    double * block;
+  }
+gsl_fft_real_2d_workspace;
+
+gsl_fft_complex_2d_workspace *
+gsl_fft_complex_2d_workspace_alloc (const size_t n1, const size_t n2);
+
+void
+gsl_fft_complex_2d_workspace_free (gsl_fft_complex_2d_workspace * w);
+
+int
+gsl_fft_complex_2d_workspace_set_threads (gsl_fft_complex_2d_workspace * w,
+                                          const size_t nthreads);
+
+int gsl_fft_complex_2d_forward (gsl_complex_packed_array data,
+                                const size_t tda,
+                                const size_t n1, const size_t n2,
+                                gsl_fft_complex_2d_workspace * w);
+
+int gsl_fft_complex_2d_backward (gsl_complex_packed_array data,
+                                 const size_t tda,
+                                 const size_t n1, const size_t n2,
+                                 gsl_fft_complex_2d_workspace * w);
+
+int gsl_fft_complex_2d_inverse (gsl_complex_packed_array data,
+                                const size_t tda,
+                                const size_t n1, const size_t n2,
+                                gsl_fft_complex_2d_workspace * w);
+
+int gsl_fft_complex_2d_transform (gsl_complex_packed_array data,
+                                  const size_t tda,
+                                  const size_t n1, const size_t n2,
+                                  gsl_fft_complex_2d_workspace * w,
+                                  const gsl_fft_direction sign);
+
+gsl_fft_complex_3d_workspace *
+gsl_fft_complex_3d_workspace_alloc (const size_t n1, const size_t n2,
+                                    const size_t n3);
+
+void
+gsl_fft_complex_3d_workspace_free (gsl_fft_complex_3d_workspace * w);
+
+int
+gsl_fft_complex_3d_workspace_set_threads (gsl_fft_complex_3d_workspace * w,
+                                          const size_t nthreads);
+
+int gsl_fft_complex_3d_forward (gsl_complex_packed_array data,
+                                const size_t n1, const size_t n2, const size_t n3,
+                                gsl_fft_complex_3d_workspace * w);
+
+int gsl_fft_complex_3d_backward (gsl_complex_packed_array data,
+                                 const size_t n1, const size_t n2, const size_t n3,
+                                 gsl_fft_complex_3d_workspace * w);
+
+int gsl_fft_complex_3d_inverse (gsl_complex_packed_array data,
+                                const size_t n1, const size_t n2, const size_t n3,
+                                gsl_fft_complex_3d_workspace * w);
+
+int gsl_fft_complex_3d_transform (gsl_complex_packed_array data,
+                                  const size_t n1, const size_t n2, const size_t n3,
+                                  gsl_fft_complex_3d_workspace * w,
+                                  const gsl_fft_direction sign);
+
+/* Real 2d transforms. The forward transform of the n1 x n2 real array
+   in gives the n1 x (n2/2+1) complex array out, the columns j > n2/2
+   of the full transform following from symmetry. The backward and
+   inverse transforms use their complex input as workspace and
+   overwrite it. */
+
+gsl_fft_real_2d_workspace *
+gsl_fft_real_2d_workspace_alloc (const size_t n1, const size_t n2);
+
+void
+gsl_fft_real_2d_workspace_free (gsl_fft_real_2d_workspace * w);
+
+int
+gsl_fft_real_2d_workspace_set_threads (gsl_fft_real_2d_workspace * w,
+                                       const size_t nthreads);
+
+int gsl_fft_real_2d_transform (const double in[],
+                               const size_t n1, const size_t n2,
+                               gsl_complex_packed_array out,
+                               gsl_fft_real_2d_workspace * w);
+
+int gsl_fft_halfcomplex_2d_backward (gsl_complex_packed_array in,
+                                     const size_t n1, const size_t n2,
+                                     double out[],
+                                     gsl_fft_real_2d_workspace * w);
+
+int gsl_fft_halfcomplex_2d_inverse (gsl_complex_packed_array in,
+                                    const size_t n1, const size_t n2,
+                                    double out[],
+                                    gsl_fft_real_2d_workspace * w);
+
+__END_DECLS
+
+#endif /* __GSL_FFT_MULTIDIM_H__ */
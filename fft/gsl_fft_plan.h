@@ -0,0 +1,116 @@
+/* fft/gsl_fft_plan.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_FFT_PLAN_H__
+#define __GSL_FFT_PLAN_H__
+
+#include <stddef.h>
+
+#include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* The kind of a plan selects the wavetable type, which also fixes the
+   direction for the real transforms: real wavetables are used for the
+   forward real-to-halfcomplex transform and halfcomplex wavetables for
+   the backward/inverse halfcomplex-to-real transform. Complex
+   wavetables serve both directions. */
+
+typedef enum
+  {
+    gsl_fft_plan_complex = 0,
+    gsl_fft_plan_real = 1,
+    gsl_fft_plan_halfcomplex = 2
+  }
+gsl_fft_plan_kind;
+
+typedef struct gsl_fft_plan_struct
+  {
+    size_t n;
+    gsl_fft_plan_kind kind;
+
+    /* exactly one of these is non-null, according to kind */
+    const gsl_fft_complex_wavetable * complex_wavetable;
+    const gsl_fft_real_wavetable * real_wavetable;
+    const gsl_fft_halfcomplex_wavetable * halfcomplex_wavetable;
+
+    /* private to the cache */
+    size_t refcount;
+    size_t bytes;
+    unsigned long stamp;
+    struct gsl_fft_plan_struct * next;
+  }
+gsl_fft_plan;
+
+typedef struct
+  {
+    size_t max_bytes;  /* memory bound for unreferenced plans and idle workspaces */
+    size_t bytes;      /* memory currently held by the cache */
+    size_t hits;       /* gsl_fft_plan_get calls satisfied from the cache */
+    size_t misses;     /* gsl_fft_plan_get calls which built a new wavetable */
+    size_t evictions;  /* plans and workspaces freed to respect max_bytes */
+
+    /* private */
+    unsigned long clock;
+    gsl_fft_plan * plans;
+    void * complex_pool;
+    void * real_pool;
+    void * lock;
+  }
+gsl_fft_plan_cache;
+
+gsl_fft_plan_cache * gsl_fft_plan_cache_alloc (const size_t max_bytes);
+
+void gsl_fft_plan_cache_free (gsl_fft_plan_cache * cache);
+
+const gsl_fft_plan * gsl_fft_plan_get (gsl_fft_plan_cache * cache,
+                                       const size_t n,
+                                       const gsl_fft_plan_kind kind);
+
+void gsl_fft_plan_release (gsl_fft_plan_cache * cache,
+                           const gsl_fft_plan * plan);
+
+gsl_fft_complex_workspace *
+gsl_fft_plan_complex_workspace_get (gsl_fft_plan_cache * cache,
+                                    const size_t n);
+
+void gsl_fft_plan_complex_workspace_release (gsl_fft_plan_cache * cache,
+                                             gsl_fft_complex_workspace * work);
+
+gsl_fft_real_workspace *
+gsl_fft_plan_real_workspace_get (gsl_fft_plan_cache * cache,
+                                 const size_t n);
+
+void gsl_fft_plan_real_workspace_release (gsl_fft_plan_cache * cache,
+                                          gsl_fft_real_workspace * work);
+
+__END_DECLS
+
+#endif /* __GSL_FFT_PLAN_H__ */
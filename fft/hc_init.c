@@ -41,6 +41,8 @@ FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (size_t n)
       GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
     }
 
+  wavetable->half = NULL;
+
   wavetable->trig = (TYPE(gsl_complex) *) malloc (n * sizeof (TYPE(gsl_complex)));
 
   if (wavetable->trig == NULL)
@@ -110,14 +112,86 @@ FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (size_t n)
       GSL_ERROR_VAL ("overflowed trigonometric lookup table", GSL_ESANITY, 0);
     }
 
+  /* chirp tables for the large prime factors, see c_bluestein.c */
+
+  for (i = 0; i < n_factors; i++)
+    {
+      wavetable->bluestein[i] = NULL;
+    }
+
+  for (i = 0; i < n_factors; i++)
+    {
+      if (wavetable->factor[i] > FFT_BLUESTEIN_MIN)
+        {
+          wavetable->bluestein[i] = 
+            FUNCTION(fft_bluestein,alloc) (wavetable->factor[i]);
+
+          if (wavetable->bluestein[i] == NULL)
+            {
+              /* error in constructor, prevent memory leak */
+
+              FUNCTION(gsl_fft_halfcomplex_wavetable,free) (wavetable);
+
+              GSL_ERROR_VAL ("failed to allocate chirp tables", 
+                             GSL_ENOMEM, 0);
+            }
+        }
+    }
+
+  /* complex transform of half the length, see real_half.c */
+
+  if (n % 2 == 0 && n >= FFT_REAL_HALF_MIN)
+    {
+      wavetable->half = FUNCTION(fft_real_half,alloc) (n);
+
+      if (wavetable->half == NULL)
+        {
+          /* error in constructor, prevent memory leak */
+
+          FUNCTION(gsl_fft_halfcomplex_wavetable,free) (wavetable);
+
+          GSL_ERROR_VAL ("failed to allocate half length tables",
+                         GSL_ENOMEM, 0);
+        }
+    }
+
   return wavetable;
 }
 
 
+size_t
+FUNCTION(gsl_fft_halfcomplex_wavetable,bytes) (const TYPE(gsl_fft_halfcomplex_wavetable) * wavetable)
+{
+  size_t bytes = sizeof (TYPE(gsl_fft_halfcomplex_wavetable))
+    + (wavetable->n) * sizeof (TYPE(gsl_complex));
+  size_t i;
+
+  for (i = 0; i < wavetable->nf; i++)
+    {
+      if (wavetable->bluestein[i] != NULL)
+        bytes += FUNCTION(fft_bluestein,bytes) (wavetable->bluestein[i]);
+    }
+
+  if (wavetable->half != NULL)
+    bytes += FUNCTION(fft_real_half,bytes) (wavetable->half);
+
+  return bytes;
+}
+
 void
 FUNCTION(gsl_fft_halfcomplex_wavetable,free) (TYPE(gsl_fft_halfcomplex_wavetable) * wavetable)
 {
+  size_t i;
+
   RETURN_IF_NULL (wavetable);
+
+  for (i = 0; i < wavetable->nf; i++)
+    {
+      FUNCTION(fft_bluestein,free) (wavetable->bluestein[i]);
+    }
+
+  FUNCTION(fft_real_half,free) (wavetable->half);
+
   /* release trigonometric lookup tables */
 
   free (wavetable->trig);
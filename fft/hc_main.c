@@ -103,6 +103,12 @@ FUNCTION(gsl_fft_halfcomplex,transform) (BASE data[], const size_t stride, const
       GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
     }
 
+  if (wavetable->half != NULL)
+    {
+      return FUNCTION(fft_real_half,backward) (wavetable->half, data, stride,
+                                               scratch);
+    }
+
   nf = wavetable->nf;
   product = 1;
   state = 0;
@@ -165,6 +171,15 @@ FUNCTION(gsl_fft_halfcomplex,transform) (BASE data[], const size_t stride, const
                                             product, n, twiddle1, twiddle2, 
                                             twiddle3, twiddle4);
         }
+      else if (wavetable->bluestein[i] != NULL)
+        {
+          twiddle1 = wavetable->twiddle[i];
+          FUNCTION(fft_halfcomplex,pass_bluestein) (in, istride, out, ostride,
+                                                    factor, product, n, 
+                                                    twiddle1,
+                                                    wavetable->bluestein[i],
+                                                    scratch + n);
+        }
       else
         {
           twiddle1 = wavetable->twiddle[i];
@@ -71,6 +71,18 @@ FUNCTION(fft_halfcomplex,pass_n) (const BASE in[],
                                   const size_t n,
                                   const TYPE(gsl_complex) twiddle[]);
 
+static void
+FUNCTION(fft_halfcomplex,pass_bluestein) (const BASE in[],
+                                          const size_t istride,
+                                          BASE out[],
+                                          const size_t ostride,
+                                          const size_t factor,
+                                          const size_t product,
+                                          const size_t n,
+                                          const TYPE(gsl_complex) twiddle[],
+                                          const TYPE(fft_bluestein) * bluestein,
+                                          BASE work[]);
+
 
 
 
@@ -0,0 +1,167 @@
+/* fft/hc_pass_bluestein.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the same pass as pass_n for an odd prime factor, with each
+   W(factor) computed as a complex DFT by Bluestein's algorithm (see
+   c_bluestein.c) instead of by direct summation. */
+
+static void
+FUNCTION(fft_halfcomplex,pass_bluestein) (const BASE in[],
+                                          const size_t istride,
+                                          BASE out[],
+                                          const size_t ostride,
+                                          const size_t factor,
+                                          const size_t product,
+                                          const size_t n,
+                                          const TYPE(gsl_complex) twiddle[],
+                                          const TYPE(fft_bluestein) * bluestein,
+                                          BASE work[])
+{
+  size_t k, k1;
+
+  const size_t m = n / factor;
+  const size_t q = n / product;
+  const size_t product_1 = product / factor;
+
+  size_t e1, e2;
+
+  BASE * const z = work;
+  BASE * const tw = work + 2 * factor;
+  BASE * const cwork = work + 4 * factor;
+
+  for (k1 = 0; k1 < product_1; k1++)
+    {
+      /* compute z = W(factor) x, for x halfcomplex */
+
+      REAL(z,1,0) = VECTOR(in,istride,factor * k1 * q);
+      IMAG(z,1,0) = 0.0;
+
+      for (e2 = 1; e2 < factor - e2; e2++)
+        {
+          const size_t from_idx = factor * q * k1 + 2 * e2 * q - 1;
+          const ATOMIC z_real = VECTOR(in,istride,from_idx);
+          const ATOMIC z_imag = VECTOR(in,istride,from_idx + 1);
+          REAL(z,1,e2) = z_real;
+          IMAG(z,1,e2) = z_imag;
+          REAL(z,1,factor - e2) = z_real;
+          IMAG(z,1,factor - e2) = -z_imag;
+        }
+
+      FUNCTION(fft_bluestein,dft) (bluestein, gsl_fft_backward, z, cwork);
+
+      for (e1 = 0; e1 < factor; e1++)
+        {
+          VECTOR(out,ostride,q * k1 + e1 * m) = REAL(z,1,e1);
+        }
+    }
+
+  if (q == 1)
+    return;
+
+  for (k = 1; k < (q + 1) / 2; k++)
+    {
+      const size_t tskip = (q + 1) / 2 - 1;
+
+      for (k1 = 0; k1 < product_1; k1++)
+        {
+          for (e2 = 0; e2 < factor; e2++)
+            {
+              if (e2 < factor - e2)
+                {
+                  const size_t from0 = factor * k1 * q + 2 * k + 2 * e2 * q - 1;
+                  REAL(z,1,e2) = VECTOR(in,istride,from0);
+                  IMAG(z,1,e2) = VECTOR(in,istride,from0 + 1);
+                }
+              else
+                {
+                  const size_t from0 = factor * k1 * q - 2 * k + 2 * (factor - e2) * q - 1;
+                  REAL(z,1,e2) = VECTOR(in,istride,from0);
+                  IMAG(z,1,e2) = -VECTOR(in,istride,from0 + 1);
+                }
+            }
+
+          FUNCTION(fft_bluestein,dft) (bluestein, gsl_fft_backward, z, cwork);
+
+          for (e1 = 0; e1 < factor; e1++)
+            {
+              const size_t to0 = k1 * q + 2 * k + e1 * m - 1;
+              const ATOMIC x_real = REAL(z,1,e1);
+              const ATOMIC x_imag = IMAG(z,1,e1);
+              ATOMIC w_real, w_imag;
+
+              if (e1 == 0)
+                {
+                  w_real = 1.0;
+                  w_imag = 0.0;
+                }
+              else
+                {
+                  w_real = GSL_REAL(twiddle[k - 1 + tskip * (e1 - 1)]);
+                  w_imag = GSL_IMAG(twiddle[k - 1 + tskip * (e1 - 1)]);
+                }
+
+              VECTOR(out,ostride,to0) = w_real * x_real - w_imag * x_imag;
+              VECTOR(out,ostride,to0 + 1) = w_real * x_imag + w_imag * x_real;
+            }
+        }
+    }
+
+  if (q % 2 == 1)
+    return;
+
+  /* k = q / 2, the outputs are real with twiddle exp(i pi e1/factor) */
+
+  for (e1 = 0; e1 < factor; e1++)
+    {
+      const double theta = M_PI * (double) e1 / (double) factor;
+      REAL(tw,1,e1) = cos (theta);
+      IMAG(tw,1,e1) = sin (theta);
+    }
+
+  for (k1 = 0; k1 < product_1; k1++)
+    {
+      for (e2 = 0; e2 < factor; e2++)
+        {
+          const size_t from0 = factor * k1 * q + q + 2 * e2 * q - 1;
+
+          if (e2 + 1 < factor - e2)
+            {
+              REAL(z,1,e2) = 2 * VECTOR(in,istride,from0);
+              IMAG(z,1,e2) = 2 * VECTOR(in,istride,from0 + 1);
+            }
+          else if (e2 + 1 == factor - e2)
+            {
+              REAL(z,1,e2) = VECTOR(in,istride,from0);
+              IMAG(z,1,e2) = 0.0;
+            }
+          else
+            {
+              REAL(z,1,e2) = 0.0;
+              IMAG(z,1,e2) = 0.0;
+            }
+        }
+
+      FUNCTION(fft_bluestein,dft) (bluestein, gsl_fft_backward, z, cwork);
+
+      for (e1 = 0; e1 < factor; e1++)
+        {
+          const size_t to0 = k1 * q + q + e1 * m - 1;
+          VECTOR(out,ostride,to0) = (REAL(tw,1,e1) * REAL(z,1,e1) 
+                                     - IMAG(tw,1,e1) * IMAG(z,1,e1));
+        }
+    }
+}
@@ -0,0 +1,510 @@
+/* fft/plan.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* A cache of shared, reference counted wavetables keyed on (n, kind),
+   together with pools of idle workspaces. Wavetables are never written
+   after construction, so a plan returned by gsl_fft_plan_get may be
+   used concurrently by any number of threads. When the library is
+   built with POSIX threads all cache operations are serialized by a
+   mutex; otherwise the usual GSL rule applies and a cache must not be
+   shared between threads. */
+
+#include <config.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_fft_plan.h>
+#include "bytes.h"
+
+typedef struct fft_plan_pool_struct
+  {
+    size_t n;
+    void * work;
+    size_t bytes;
+    unsigned long stamp;
+    struct fft_plan_pool_struct * next;
+  }
+fft_plan_pool;
+
+#ifdef HAVE_PTHREAD_H
+#define CACHE_LOCK(c)   pthread_mutex_lock ((pthread_mutex_t *) (c)->lock)
+#define CACHE_UNLOCK(c) pthread_mutex_unlock ((pthread_mutex_t *) (c)->lock)
+#else
+#define CACHE_LOCK(c)   ((void) 0)
+#define CACHE_UNLOCK(c) ((void) 0)
+#endif
+
+static size_t plan_bytes (const gsl_fft_plan * plan);
+static gsl_fft_plan * plan_find (gsl_fft_plan_cache * cache, const size_t n,
+                                 const gsl_fft_plan_kind kind);
+static void plan_destroy (gsl_fft_plan * plan);
+static void pool_destroy (fft_plan_pool * node, const int is_complex);
+static void cache_evict (gsl_fft_plan_cache * cache);
+static void * pool_get (gsl_fft_plan_cache * cache, const size_t n,
+                        const int is_complex);
+static void pool_put (gsl_fft_plan_cache * cache, void * work,
+                      const size_t n, const int is_complex);
+
+gsl_fft_plan_cache *
+gsl_fft_plan_cache_alloc (const size_t max_bytes)
+{
+  gsl_fft_plan_cache * cache;
+
+  cache = (gsl_fft_plan_cache *) calloc (1, sizeof (gsl_fft_plan_cache));
+
+  if (cache == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate struct", GSL_ENOMEM);
+    }
+
+  cache->max_bytes = max_bytes;
+
+#ifdef HAVE_PTHREAD_H
+  cache->lock = malloc (sizeof (pthread_mutex_t));
+
+  if (cache->lock == NULL)
+    {
+      free (cache);
+      GSL_ERROR_NULL ("failed to allocate mutex", GSL_ENOMEM);
+    }
+
+  if (pthread_mutex_init ((pthread_mutex_t *) cache->lock, NULL) != 0)
+    {
+      free (cache->lock);
+      free (cache);
+      GSL_ERROR_NULL ("failed to initialize mutex", GSL_EFAILED);
+    }
+#endif
+
+  return cache;
+}
+
+void
+gsl_fft_plan_cache_free (gsl_fft_plan_cache * cache)
+{
+  gsl_fft_plan * plan;
+  fft_plan_pool * node;
+
+  RETURN_IF_NULL (cache);
+
+  plan = cache->plans;
+  while (plan != NULL)
+    {
+      gsl_fft_plan * next = plan->next;
+      plan_destroy (plan);
+      plan = next;
+    }
+
+  node = (fft_plan_pool *) cache->complex_pool;
+  while (node != NULL)
+    {
+      fft_plan_pool * next = node->next;
+      pool_destroy (node, 1);
+      node = next;
+    }
+
+  node = (fft_plan_pool *) cache->real_pool;
+  while (node != NULL)
+    {
+      fft_plan_pool * next = node->next;
+      pool_destroy (node, 0);
+      node = next;
+    }
+
+#ifdef HAVE_PTHREAD_H
+  pthread_mutex_destroy ((pthread_mutex_t *) cache->lock);
+  free (cache->lock);
+#endif
+
+  free (cache);
+}
+
+const gsl_fft_plan *
+gsl_fft_plan_get (gsl_fft_plan_cache * cache, const size_t n,
+                  const gsl_fft_plan_kind kind)
+{
+  gsl_fft_plan * plan;
+  gsl_fft_plan * found;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("length n must be positive integer", GSL_EDOM);
+    }
+
+  if (kind != gsl_fft_plan_complex && kind != gsl_fft_plan_real
+      && kind != gsl_fft_plan_halfcomplex)
+    {
+      GSL_ERROR_NULL ("unknown plan kind", GSL_EINVAL);
+    }
+
+  CACHE_LOCK (cache);
+
+  plan = plan_find (cache, n, kind);
+
+  if (plan != NULL)
+    {
+      plan->refcount++;
+      plan->stamp = ++cache->clock;
+      cache->hits++;
+      CACHE_UNLOCK (cache);
+      return plan;
+    }
+
+  cache->misses++;
+
+  CACHE_UNLOCK (cache);
+
+  /* build the wavetable without holding the lock, so that other
+     threads can keep using the cache meanwhile */
+
+  plan = (gsl_fft_plan *) calloc (1, sizeof (gsl_fft_plan));
+
+  if (plan == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate plan", GSL_ENOMEM);
+    }
+
+  plan->n = n;
+  plan->kind = kind;
+  plan->refcount = 1;
+
+  switch (kind)
+    {
+    case gsl_fft_plan_complex:
+      plan->complex_wavetable = gsl_fft_complex_wavetable_alloc (n);
+      break;
+    case gsl_fft_plan_real:
+      plan->real_wavetable = gsl_fft_real_wavetable_alloc (n);
+      break;
+    case gsl_fft_plan_halfcomplex:
+      plan->halfcomplex_wavetable = gsl_fft_halfcomplex_wavetable_alloc (n);
+      break;
+    }
+
+  if (plan->complex_wavetable == NULL && plan->real_wavetable == NULL
+      && plan->halfcomplex_wavetable == NULL)
+    {
+      free (plan);
+      GSL_ERROR_NULL ("failed to allocate wavetable", GSL_ENOMEM);
+    }
+
+  plan->bytes = plan_bytes (plan);
+
+  CACHE_LOCK (cache);
+
+  /* another thread may have inserted the same plan in the meantime */
+
+  found = plan_find (cache, n, kind);
+
+  if (found != NULL)
+    {
+      found->refcount++;
+      found->stamp = ++cache->clock;
+      CACHE_UNLOCK (cache);
+      plan_destroy (plan);
+      return found;
+    }
+
+  plan->stamp = ++cache->clock;
+  plan->next = cache->plans;
+  cache->plans = plan;
+  cache->bytes += plan->bytes;
+
+  cache_evict (cache);
+
+  CACHE_UNLOCK (cache);
+
+  return plan;
+}
+
+void
+gsl_fft_plan_release (gsl_fft_plan_cache * cache, const gsl_fft_plan * plan)
+{
+  gsl_fft_plan * p;
+
+  RETURN_IF_NULL (plan);
+
+  CACHE_LOCK (cache);
+
+  /* look the plan up rather than casting away const on the argument */
+
+  for (p = cache->plans; p != NULL; p = p->next)
+    {
+      if (p == plan)
+        break;
+    }
+
+  if (p == NULL || p->refcount == 0)
+    {
+      CACHE_UNLOCK (cache);
+      GSL_ERROR_VOID ("plan was not obtained from this cache", GSL_EINVAL);
+    }
+
+  p->refcount--;
+
+  if (p->refcount == 0)
+    cache_evict (cache);
+
+  CACHE_UNLOCK (cache);
+}
+
+gsl_fft_complex_workspace *
+gsl_fft_plan_complex_workspace_get (gsl_fft_plan_cache * cache,
+                                    const size_t n)
+{
+  gsl_fft_complex_workspace * work;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("length n must be positive integer", GSL_EDOM);
+    }
+
+  work = (gsl_fft_complex_workspace *) pool_get (cache, n, 1);
+
+  if (work == NULL)
+    work = gsl_fft_complex_workspace_alloc (n);
+
+  return work;
+}
+
+void
+gsl_fft_plan_complex_workspace_release (gsl_fft_plan_cache * cache,
+                                        gsl_fft_complex_workspace * work)
+{
+  RETURN_IF_NULL (work);
+  pool_put (cache, work, work->n, 1);
+}
+
+gsl_fft_real_workspace *
+gsl_fft_plan_real_workspace_get (gsl_fft_plan_cache * cache,
+                                 const size_t n)
+{
+  gsl_fft_real_workspace * work;
+
+  if (n == 0)
+    {
+      GSL_ERROR_NULL ("length n must be positive integer", GSL_EDOM);
+    }
+
+  work = (gsl_fft_real_workspace *) pool_get (cache, n, 0);
+
+  if (work == NULL)
+    work = gsl_fft_real_workspace_alloc (n);
+
+  return work;
+}
+
+void
+gsl_fft_plan_real_workspace_release (gsl_fft_plan_cache * cache,
+                                     gsl_fft_real_workspace * work)
+{
+  RETURN_IF_NULL (work);
+  pool_put (cache, work, work->n, 0);
+}
+
+/* memory footprint of a plan and its wavetable, including the
+   Bluestein, four-step and half length tables, see fft/bytes.h */
+
+static size_t
+plan_bytes (const gsl_fft_plan * plan)
+{
+  size_t bytes = sizeof (gsl_fft_plan);
+
+  if (plan->complex_wavetable != NULL)
+    bytes += gsl_fft_complex_wavetable_bytes (plan->complex_wavetable);
+
+  if (plan->real_wavetable != NULL)
+    bytes += gsl_fft_real_wavetable_bytes (plan->real_wavetable);
+
+  if (plan->halfcomplex_wavetable != NULL)
+    bytes += gsl_fft_halfcomplex_wavetable_bytes (plan->halfcomplex_wavetable);
+
+  return bytes;
+}
+
+static gsl_fft_plan *
+plan_find (gsl_fft_plan_cache * cache, const size_t n,
+           const gsl_fft_plan_kind kind)
+{
+  gsl_fft_plan * plan;
+
+  for (plan = cache->plans; plan != NULL; plan = plan->next)
+    {
+      if (plan->n == n && plan->kind == kind)
+        return plan;
+    }
+
+  return NULL;
+}
+
+static void
+plan_destroy (gsl_fft_plan * plan)
+{
+  gsl_fft_complex_wavetable_free ((gsl_fft_complex_wavetable *) plan->complex_wavetable);
+  gsl_fft_real_wavetable_free ((gsl_fft_real_wavetable *) plan->real_wavetable);
+  gsl_fft_halfcomplex_wavetable_free ((gsl_fft_halfcomplex_wavetable *) plan->halfcomplex_wavetable);
+  free (plan);
+}
+
+static void
+pool_destroy (fft_plan_pool * node, const int is_complex)
+{
+  if (is_complex)
+    gsl_fft_complex_workspace_free ((gsl_fft_complex_workspace *) node->work);
+  else
+    gsl_fft_real_workspace_free ((gsl_fft_real_workspace *) node->work);
+
+  free (node);
+}
+
+/* free least recently used unreferenced plans and idle workspaces
+   until the cache fits in max_bytes; must be called with the lock held */
+
+static void
+cache_evict (gsl_fft_plan_cache * cache)
+{
+  while (cache->bytes > cache->max_bytes)
+    {
+      gsl_fft_plan ** plan_link = NULL;
+      fft_plan_pool ** pool_link = NULL;
+      int pool_is_complex = 0;
+      unsigned long oldest = 0;
+      int found = 0;
+      gsl_fft_plan ** pp;
+      fft_plan_pool ** np;
+      int c;
+
+      for (pp = &cache->plans; *pp != NULL; pp = &(*pp)->next)
+        {
+          if ((*pp)->refcount == 0 && (!found || (*pp)->stamp < oldest))
+            {
+              oldest = (*pp)->stamp;
+              plan_link = pp;
+              found = 1;
+            }
+        }
+
+      for (c = 0; c < 2; c++)
+        {
+          void ** head = c ? &cache->complex_pool : &cache->real_pool;
+
+          for (np = (fft_plan_pool **) head; *np != NULL; np = &(*np)->next)
+            {
+              if (!found || (*np)->stamp < oldest)
+                {
+                  oldest = (*np)->stamp;
+                  pool_link = np;
+                  pool_is_complex = c;
+                  plan_link = NULL;
+                  found = 1;
+                }
+            }
+        }
+
+      if (!found)
+        break;                  /* everything left is in use */
+
+      if (pool_link != NULL && plan_link == NULL)
+        {
+          fft_plan_pool * node = *pool_link;
+          *pool_link = node->next;
+          cache->bytes -= node->bytes;
+          pool_destroy (node, pool_is_complex);
+        }
+      else
+        {
+          gsl_fft_plan * plan = *plan_link;
+          *plan_link = plan->next;
+          cache->bytes -= plan->bytes;
+          plan_destroy (plan);
+        }
+
+      cache->evictions++;
+    }
+}
+
+static void *
+pool_get (gsl_fft_plan_cache * cache, const size_t n, const int is_complex)
+{
+  fft_plan_pool ** np;
+  void * work = NULL;
+
+  CACHE_LOCK (cache);
+
+  np = (fft_plan_pool **) (is_complex ? &cache->complex_pool : &cache->real_pool);
+
+  for (; *np != NULL; np = &(*np)->next)
+    {
+      if ((*np)->n == n)
+        {
+          fft_plan_pool * node = *np;
+          *np = node->next;
+          cache->bytes -= node->bytes;
+          work = node->work;
+          free (node);
+          break;
+        }
+    }
+
+  CACHE_UNLOCK (cache);
+
+  return work;
+}
+
+static void
+pool_put (gsl_fft_plan_cache * cache, void * work, const size_t n,
+          const int is_complex)
+{
+  fft_plan_pool * node;
+  void ** head;
+
+  node = (fft_plan_pool *) malloc (sizeof (fft_plan_pool));
+
+  if (node == NULL)
+    {
+      /* cannot pool it, so just release it */
+      if (is_complex)
+        gsl_fft_complex_workspace_free ((gsl_fft_complex_workspace *) work);
+      else
+        gsl_fft_real_workspace_free ((gsl_fft_real_workspace *) work);
+      return;
+    }
+
+  node->n = n;
+  node->work = work;
+  node->bytes = sizeof (fft_plan_pool)
+    + (is_complex
+       ? gsl_fft_complex_workspace_bytes ((gsl_fft_complex_workspace *) work)
+       : gsl_fft_real_workspace_bytes ((gsl_fft_real_workspace *) work));
+
+  CACHE_LOCK (cache);
+
+  head = is_complex ? &cache->complex_pool : &cache->real_pool;
+  node->stamp = ++cache->clock;
+  node->next = (fft_plan_pool *) *head;
+  *head = node;
+  cache->bytes += node->bytes;
+
+  cache_evict (cache);
+
+  CACHE_UNLOCK (cache);
+}
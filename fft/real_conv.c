@@ -0,0 +1,427 @@
+/* fft/real_conv.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Convolution and correlation of real data. The kernel is zero padded
+   to a length n of the form 2^a 3^b 5^c and its halfcomplex transform
+   is stored, scaled by 1/n so that the unnormalized backward transform
+   of a product gives the result directly. A convolution is then one
+   real transform, a product of halfcomplex arrays and one backward
+   transform. The correlation uses the complex conjugate of the kernel
+   transform. */
+
+#ifndef FFT_OVERLAP_SAVE_RATIO
+#define FFT_OVERLAP_SAVE_RATIO 4
+#endif
+
+#ifndef FFT_OVERLAP_SAVE_MIN
+#define FFT_OVERLAP_SAVE_MIN 64
+#endif
+
+/* halfcomplex product data = data * kernel, or data * conj(kernel) */
+
+static void
+FUNCTION(fft_halfcomplex,conv_multiply) (BASE data[], const BASE kernel[],
+                                         const size_t n, const int conj)
+{
+  const ATOMIC s = conj ? -1.0 : 1.0;
+  size_t k;
+
+  data[0] *= kernel[0];
+
+  for (k = 1; 2 * k < n; k++)
+    {
+      const ATOMIC x_real = data[2 * k - 1];
+      const ATOMIC x_imag = data[2 * k];
+      const ATOMIC h_real = kernel[2 * k - 1];
+      const ATOMIC h_imag = s * kernel[2 * k];
+
+      data[2 * k - 1] = x_real * h_real - x_imag * h_imag;
+      data[2 * k] = x_real * h_imag + x_imag * h_real;
+    }
+
+  if (n % 2 == 0)
+    {
+      data[n - 1] *= kernel[n - 1];
+    }
+}
+
+/* computes the scaled halfcomplex transform of the kernel in out[] */
+
+static int
+FUNCTION(fft_real,conv_kernel) (const BASE kernel[], const size_t stride,
+                                const size_t nk, const size_t n,
+                                const TYPE(gsl_fft_real_wavetable) * wavetable,
+                                TYPE(gsl_fft_real_workspace) * work,
+                                BASE out[])
+{
+  const ATOMIC norm = 1.0 / (double) n;
+  size_t i;
+  int status;
+
+  for (i = 0; i < nk; i++)
+    {
+      out[i] = kernel[i * stride];
+    }
+
+  for (i = nk; i < n; i++)
+    {
+      out[i] = 0.0;
+    }
+
+  status = FUNCTION(gsl_fft_real,transform) (out, 1, n, wavetable, work);
+
+  if (status)
+    {
+      return status;
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      out[i] *= norm;
+    }
+
+  return GSL_SUCCESS;
+}
+
+TYPE(gsl_fft_real_convolution) *
+FUNCTION(gsl_fft_real_convolution,alloc) (const BASE kernel[],
+                                          const size_t stride,
+                                          const size_t nk,
+                                          const size_t nx)
+{
+  TYPE(gsl_fft_real_convolution) * c;
+  int status;
+
+  if (nk == 0 || nx == 0)
+    {
+      GSL_ERROR_VAL ("lengths must be positive integers", GSL_EDOM, 0);
+    }
+
+  c = (TYPE(gsl_fft_real_convolution) *)
+    calloc (1, sizeof (TYPE(gsl_fft_real_convolution)));
+
+  if (c == NULL)
+    {
+      GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
+    }
+
+  c->nk = nk;
+  c->nx = nx;
+  c->n = fft_good_length (nx + nk - 1);
+
+  c->real_wavetable = FUNCTION(gsl_fft_real_wavetable,alloc) (c->n);
+  c->hc_wavetable = FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (c->n);
+  c->work = FUNCTION(gsl_fft_real_workspace,alloc) (c->n);
+  c->kernel = (BASE *) malloc (c->n * sizeof (BASE));
+  c->data = (BASE *) malloc (c->n * sizeof (BASE));
+
+  if (c->real_wavetable == NULL || c->hc_wavetable == NULL
+      || c->work == NULL || c->kernel == NULL || c->data == NULL)
+    {
+      FUNCTION(gsl_fft_real_convolution,free) (c);
+      GSL_ERROR_VAL ("failed to allocate space for convolution", GSL_ENOMEM, 0);
+    }
+
+  status = FUNCTION(fft_real,conv_kernel) (kernel, stride, nk, c->n,
+                                           c->real_wavetable, c->work,
+                                           c->kernel);
+
+  if (status)
+    {
+      FUNCTION(gsl_fft_real_convolution,free) (c);
+      GSL_ERROR_NULL ("failed to transform the kernel", status);
+    }
+
+  return c;
+}
+
+void
+FUNCTION(gsl_fft_real_convolution,free) (TYPE(gsl_fft_real_convolution) * c)
+{
+  RETURN_IF_NULL (c);
+
+  FUNCTION(gsl_fft_real_wavetable,free) (c->real_wavetable);
+  FUNCTION(gsl_fft_halfcomplex_wavetable,free) (c->hc_wavetable);
+  FUNCTION(gsl_fft_real_workspace,free) (c->work);
+  free (c->kernel);
+  free (c->data);
+  free (c);
+}
+
+/* transforms the signal, multiplies by the kernel and transforms back,
+   leaving the circular result of length n in c->data */
+
+static int
+FUNCTION(fft_real,conv_apply) (TYPE(gsl_fft_real_convolution) * c,
+                               const BASE x[], const size_t xstride,
+                               const size_t nx, const int conj)
+{
+  const size_t n = c->n;
+  BASE * const data = c->data;
+  size_t i;
+  int status;
+
+  if (nx == 0 || nx > c->nx)
+    {
+      GSL_ERROR ("signal length must be between 1 and the length nx used "
+                 "to allocate the convolution", GSL_EBADLEN);
+    }
+
+  for (i = 0; i < nx; i++)
+    {
+      data[i] = x[i * xstride];
+    }
+
+  for (i = nx; i < n; i++)
+    {
+      data[i] = 0.0;
+    }
+
+  status = FUNCTION(gsl_fft_real,transform) (data, 1, n, c->real_wavetable,
+                                             c->work);
+  if (status)
+    {
+      return status;
+    }
+
+  FUNCTION(fft_halfcomplex,conv_multiply) (data, c->kernel, n, conj);
+
+  return FUNCTION(gsl_fft_halfcomplex,transform) (data, 1, n, c->hc_wavetable,
+                                                  c->work);
+}
+
+int
+FUNCTION(gsl_fft_real,convolve) (TYPE(gsl_fft_real_convolution) * c,
+                                 const BASE x[], const size_t xstride,
+                                 const size_t nx,
+                                 BASE y[], const size_t ystride)
+{
+  const size_t ny = nx + c->nk - 1;
+  size_t i;
+  int status = FUNCTION(fft_real,conv_apply) (c, x, xstride, nx, 0);
+
+  if (status)
+    {
+      return status;
+    }
+
+  for (i = 0; i < ny; i++)
+    {
+      y[i * ystride] = c->data[i];
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+FUNCTION(gsl_fft_real,correlate) (TYPE(gsl_fft_real_convolution) * c,
+                                  const BASE x[], const size_t xstride,
+                                  const size_t nx,
+                                  BASE y[], const size_t ystride)
+{
+  const size_t nk = c->nk;
+  const size_t n = c->n;
+  size_t i;
+  int status = FUNCTION(fft_real,conv_apply) (c, x, xstride, nx, 1);
+
+  if (status)
+    {
+      return status;
+    }
+
+  /* negative lags -(nk-1) .. -1 are at the end of the circular result */
+
+  for (i = 1; i < nk; i++)
+    {
+      y[(nk - 1 - i) * ystride] = c->data[n - i];
+    }
+
+  for (i = 0; i < nx; i++)
+    {
+      y[(nk - 1 + i) * ystride] = c->data[i];
+    }
+
+  return GSL_SUCCESS;
+}
+
+TYPE(gsl_fft_real_overlap_save) *
+FUNCTION(gsl_fft_real_overlap_save,alloc) (const BASE kernel[],
+                                           const size_t stride,
+                                           const size_t nk)
+{
+  TYPE(gsl_fft_real_overlap_save) * s;
+  int status;
+
+  if (nk == 0)
+    {
+      GSL_ERROR_VAL ("kernel length must be positive integer", GSL_EDOM, 0);
+    }
+
+  s = (TYPE(gsl_fft_real_overlap_save) *)
+    calloc (1, sizeof (TYPE(gsl_fft_real_overlap_save)));
+
+  if (s == NULL)
+    {
+      GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
+    }
+
+  /* with a transform several times longer than the kernel most of
+     each block is new samples, and the cost per sample is O(log nk) */
+
+  s->nk = nk;
+  s->n = fft_good_length (GSL_MAX (FFT_OVERLAP_SAVE_RATIO * nk,
+                                   FFT_OVERLAP_SAVE_MIN));
+  s->step = s->n - nk + 1;
+
+  s->real_wavetable = FUNCTION(gsl_fft_real_wavetable,alloc) (s->n);
+  s->hc_wavetable = FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (s->n);
+  s->work = FUNCTION(gsl_fft_real_workspace,alloc) (s->n);
+  s->kernel = (BASE *) malloc (s->n * sizeof (BASE));
+  s->in = (BASE *) malloc (s->n * sizeof (BASE));
+  s->out = (BASE *) malloc (s->step * sizeof (BASE));
+  s->data = (BASE *) malloc (s->n * sizeof (BASE));
+
+  if (s->real_wavetable == NULL || s->hc_wavetable == NULL
+      || s->work == NULL || s->kernel == NULL || s->in == NULL
+      || s->out == NULL || s->data == NULL)
+    {
+      FUNCTION(gsl_fft_real_overlap_save,free) (s);
+      GSL_ERROR_VAL ("failed to allocate space for overlap-save", GSL_ENOMEM, 0);
+    }
+
+  status = FUNCTION(fft_real,conv_kernel) (kernel, stride, nk, s->n,
+                                           s->real_wavetable, s->work,
+                                           s->kernel);
+
+  if (status)
+    {
+      FUNCTION(gsl_fft_real_overlap_save,free) (s);
+      GSL_ERROR_NULL ("failed to transform the kernel", status);
+    }
+
+  FUNCTION(gsl_fft_real_overlap_save,reset) (s);
+
+  return s;
+}
+
+void
+FUNCTION(gsl_fft_real_overlap_save,free) (TYPE(gsl_fft_real_overlap_save) * s)
+{
+  RETURN_IF_NULL (s);
+
+  FUNCTION(gsl_fft_real_wavetable,free) (s->real_wavetable);
+  FUNCTION(gsl_fft_halfcomplex_wavetable,free) (s->hc_wavetable);
+  FUNCTION(gsl_fft_real_workspace,free) (s->work);
+  free (s->kernel);
+  free (s->in);
+  free (s->out);
+  free (s->data);
+  free (s);
+}
+
+void
+FUNCTION(gsl_fft_real_overlap_save,reset) (TYPE(gsl_fft_real_overlap_save) * s)
+{
+  size_t i;
+
+  for (i = 0; i < s->n; i++)
+    {
+      s->in[i] = 0.0;
+    }
+
+  for (i = 0; i < s->step; i++)
+    {
+      s->out[i] = 0.0;
+    }
+
+  s->fill = 0;
+}
+
+/* The input buffer s->in holds the last nk-1 samples of the previous
+   block followed by the s->fill samples received so far of the current
+   block. When the block is complete the last step elements of its
+   circular convolution, which are free of wrap-around, replace the
+   output of the previous block in s->out. Each output sample is taken
+   from s->out as the input sample in the same position of the next
+   block arrives, which gives the constant delay of step samples. */
+
+int
+FUNCTION(gsl_fft_real_overlap_save,process) (TYPE(gsl_fft_real_overlap_save) * s,
+                                             const BASE x[],
+                                             const size_t xstride,
+                                             const size_t nx,
+                                             BASE y[],
+                                             const size_t ystride)
+{
+  const size_t nk = s->nk;
+  const size_t n = s->n;
+  const size_t step = s->step;
+  BASE * const in = s->in;
+  BASE * const data = s->data;
+  size_t i = 0;
+
+  while (i < nx)
+    {
+      const size_t m = GSL_MIN (step - s->fill, nx - i);
+      BASE * const block_in = in + nk - 1 + s->fill;
+      const BASE * const block_out = s->out + s->fill;
+      size_t j;
+
+      /* x and y may be the same array */
+
+      for (j = 0; j < m; j++)
+        {
+          const BASE v = x[(i + j) * xstride];
+          y[(i + j) * ystride] = block_out[j];
+          block_in[j] = v;
+        }
+
+      i += m;
+      s->fill += m;
+
+      if (s->fill == step)
+        {
+          int status;
+
+          memcpy (data, in, n * sizeof (BASE));
+
+          status = FUNCTION(gsl_fft_real,transform) (data, 1, n,
+                                                     s->real_wavetable,
+                                                     s->work);
+          if (status)
+            {
+              return status;
+            }
+
+          FUNCTION(fft_halfcomplex,conv_multiply) (data, s->kernel, n, 0);
+
+          status = FUNCTION(gsl_fft_halfcomplex,transform) (data, 1, n,
+                                                            s->hc_wavetable,
+                                                            s->work);
+          if (status)
+            {
+              return status;
+            }
+
+          memcpy (s->out, data + nk - 1, step * sizeof (BASE));
+          memmove (in, in + step, (nk - 1) * sizeof (BASE));
+          s->fill = 0;
+        }
+    }
+
+  return GSL_SUCCESS;
+}
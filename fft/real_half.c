@@ -0,0 +1,243 @@
+/* fft/real_half.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Real and halfcomplex transforms of even length n computed with a
+   complex transform of length n/2.
+
+   The even and odd elements of x are packed into z_j = x_(2j) + i
+   x_(2j+1), and with Z the transform of z and w = exp(-2 pi i/n),
+
+     X_k = (Z_k + conj(Z_(n/2-k)))/2 - i w^k (Z_k - conj(Z_(n/2-k)))/2
+
+   for k = 0 .. n/2. The halfcomplex transform runs these steps
+   backwards. The real passes in real_pass_*.c have strided inner loops
+   which the compiler cannot vectorize, while the complex transform uses
+   the unit stride passes of c_pass_unit.c, so this is about twice as
+   fast in double precision and up to three times as fast in single
+   precision, where a vector holds twice as many elements. Short
+   transforms stay with the real passes, which have less overhead. */
+
+#ifndef FFT_REAL_HALF_MIN
+#define FFT_REAL_HALF_MIN 512
+#endif
+
+typedef struct
+  {
+    size_t n;
+    TYPE(gsl_fft_complex_wavetable) * wavetable;
+    TYPE(gsl_complex) * twiddle;   /* w^k for k = 0 .. n/2 - 1 */
+  }
+TYPE(fft_real_half);
+
+/* BASE elements of workspace scratch space needed by a real or
+   halfcomplex transform of length n, including the complex transform
+   below when it is used */
+
+static size_t
+FUNCTION(fft_real_half,scratch) (const size_t n)
+{
+  const size_t passes = n + FUNCTION(fft_bluestein,scratch) (n);
+
+  if (n % 2 == 0 && n >= FFT_REAL_HALF_MIN)
+    {
+      /* the packed data, followed by the scratch space of the complex
+         transform of length n/2 */
+
+      return n + FUNCTION(fft_complex,scratch) (n / 2, 1);
+    }
+
+  return passes;
+}
+
+static void
+FUNCTION(fft_real_half,free) (TYPE(fft_real_half) * h)
+{
+  RETURN_IF_NULL (h);
+
+  FUNCTION(gsl_fft_complex_wavetable,free) (h->wavetable);
+  free (h->twiddle);
+  free (h);
+}
+
+static size_t
+FUNCTION(fft_real_half,bytes) (const TYPE(fft_real_half) * h)
+{
+  return sizeof (TYPE(fft_real_half))
+    + (h->n / 2) * sizeof (TYPE(gsl_complex))
+    + FUNCTION(gsl_fft_complex_wavetable,bytes) (h->wavetable);
+}
+
+/* returns a null pointer, without an error, for the lengths which use
+   the real passes */
+
+static TYPE(fft_real_half) *
+FUNCTION(fft_real_half,alloc) (const size_t n)
+{
+  const size_t m = n / 2;
+  TYPE(fft_real_half) * h;
+  size_t k;
+
+  if (n % 2 != 0 || n < FFT_REAL_HALF_MIN)
+    {
+      return NULL;
+    }
+
+  h = (TYPE(fft_real_half) *) calloc (1, sizeof (TYPE(fft_real_half)));
+
+  if (h == NULL)
+    {
+      GSL_ERROR_NULL ("failed to allocate struct", GSL_ENOMEM);
+    }
+
+  h->n = n;
+  h->wavetable = FUNCTION(gsl_fft_complex_wavetable,alloc) (m);
+  h->twiddle = (TYPE(gsl_complex) *) malloc (m * sizeof (TYPE(gsl_complex)));
+
+  if (h->wavetable == NULL || h->twiddle == NULL)
+    {
+      FUNCTION(fft_real_half,free) (h);
+      GSL_ERROR_NULL ("failed to allocate half length tables", GSL_ENOMEM);
+    }
+
+  for (k = 0; k < m; k++)
+    {
+      const double theta = 2.0 * M_PI * (double) k / (double) n;
+      GSL_REAL(h->twiddle[k]) = cos (theta);
+      GSL_IMAG(h->twiddle[k]) = -sin (theta);
+    }
+
+  return h;
+}
+
+/* forward real transform of data into halfcomplex order. scratch must
+   hold fft_real_half_scratch(n) elements. */
+
+static int
+FUNCTION(fft_real_half,transform) (const TYPE(fft_real_half) * h,
+                                   BASE data[], const size_t stride,
+                                   BASE scratch[])
+{
+  const size_t n = h->n;
+  const size_t m = n / 2;
+  const TYPE(gsl_complex) * const twiddle = h->twiddle;
+  BASE * const z = scratch;
+  size_t j, k;
+  int status;
+
+  for (j = 0; j < n; j++)
+    {
+      z[j] = data[j * stride];
+    }
+
+  status = FUNCTION(fft_complex,transform_scratch) (z, 1, m, h->wavetable,
+                                                    scratch + n, 1,
+                                                    gsl_fft_forward);
+  if (status)
+    {
+      return status;
+    }
+
+  data[0] = REAL(z,1,0) + IMAG(z,1,0);
+  data[(n - 1) * stride] = REAL(z,1,0) - IMAG(z,1,0);
+
+  for (k = 1; k < m; k++)
+    {
+      const ATOMIC a_real = REAL(z,1,k);
+      const ATOMIC a_imag = IMAG(z,1,k);
+      const ATOMIC b_real = REAL(z,1,m - k);
+      const ATOMIC b_imag = -IMAG(z,1,m - k);
+
+      /* e = (a + b)/2, d = (a - b)/(2i) with b = conj(Z_(m-k)) */
+      const ATOMIC e_real = 0.5 * (a_real + b_real);
+      const ATOMIC e_imag = 0.5 * (a_imag + b_imag);
+      const ATOMIC d_real = 0.5 * (a_imag - b_imag);
+      const ATOMIC d_imag = -0.5 * (a_real - b_real);
+
+      const ATOMIC w_real = GSL_REAL(twiddle[k]);
+      const ATOMIC w_imag = GSL_IMAG(twiddle[k]);
+
+      data[(2 * k - 1) * stride] = e_real + w_real * d_real - w_imag * d_imag;
+      data[2 * k * stride] = e_imag + w_real * d_imag + w_imag * d_real;
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* unnormalized backward transform of halfcomplex data, the inverse of
+   fft_real_half_transform() up to a factor of n */
+
+static int
+FUNCTION(fft_real_half,backward) (const TYPE(fft_real_half) * h,
+                                  BASE data[], const size_t stride,
+                                  BASE scratch[])
+{
+  const size_t n = h->n;
+  const size_t m = n / 2;
+  const TYPE(gsl_complex) * const twiddle = h->twiddle;
+  BASE * const z = scratch;
+  size_t j, k;
+  int status;
+
+  /* 2 Z_k = (X_k + conj(X_(m-k))) + i conj(w^k) (X_k - conj(X_(m-k))),
+     which makes the backward transform of length m return n z */
+
+  {
+    const ATOMIC x0 = data[0];
+    const ATOMIC xm = data[(n - 1) * stride];
+
+    REAL(z,1,0) = x0 + xm;
+    IMAG(z,1,0) = x0 - xm;
+  }
+
+  for (k = 1; k < m; k++)
+    {
+      const ATOMIC a_real = data[(2 * k - 1) * stride];
+      const ATOMIC a_imag = data[2 * k * stride];
+      const ATOMIC b_real = data[(2 * (m - k) - 1) * stride];
+      const ATOMIC b_imag = -data[2 * (m - k) * stride];
+
+      const ATOMIC s_real = a_real + b_real;
+      const ATOMIC s_imag = a_imag + b_imag;
+      const ATOMIC d_real = a_real - b_real;
+      const ATOMIC d_imag = a_imag - b_imag;
+
+      const ATOMIC w_real = GSL_REAL(twiddle[k]);
+      const ATOMIC w_imag = GSL_IMAG(twiddle[k]);
+
+      /* t = conj(w^k) d */
+      const ATOMIC t_real = w_real * d_real + w_imag * d_imag;
+      const ATOMIC t_imag = w_real * d_imag - w_imag * d_real;
+
+      REAL(z,1,k) = s_real - t_imag;
+      IMAG(z,1,k) = s_imag + t_real;
+    }
+
+  status = FUNCTION(fft_complex,transform_scratch) (z, 1, m, h->wavetable,
+                                                    scratch + n, 1,
+                                                    gsl_fft_backward);
+  if (status)
+    {
+      return status;
+    }
+
+  for (j = 0; j < n; j++)
+    {
+      data[j * stride] = z[j];
+    }
+
+  return GSL_SUCCESS;
+}
@@ -41,6 +41,8 @@ FUNCTION(gsl_fft_real_wavetable,alloc) (size_t n)
       GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
     }
 
+  wavetable->half = NULL;
+
   if (n == 1) 
     {
       wavetable->trig = 0;
@@ -119,6 +121,49 @@ FUNCTION(gsl_fft_real_wavetable,alloc) (size_t n)
                         GSL_ESANITY, 0);
     }
 
+  /* chirp tables for the large prime factors, see c_bluestein.c */
+
+  for (i = 0; i < n_factors; i++)
+    {
+      wavetable->bluestein[i] = NULL;
+    }
+
+  for (i = 0; i < n_factors; i++)
+    {
+      if (wavetable->factor[i] > FFT_BLUESTEIN_MIN)
+        {
+          wavetable->bluestein[i] = 
+            FUNCTION(fft_bluestein,alloc) (wavetable->factor[i]);
+
+          if (wavetable->bluestein[i] == NULL)
+            {
+              /* error in constructor, prevent memory leak */
+
+              FUNCTION(gsl_fft_real_wavetable,free) (wavetable);
+
+              GSL_ERROR_VAL ("failed to allocate chirp tables", 
+                             GSL_ENOMEM, 0);
+            }
+        }
+    }
+
+  /* complex transform of half the length, see real_half.c */
+
+  if (n % 2 == 0 && n >= FFT_REAL_HALF_MIN)
+    {
+      wavetable->half = FUNCTION(fft_real_half,alloc) (n);
+
+      if (wavetable->half == NULL)
+        {
+          /* error in constructor, prevent memory leak */
+
+          FUNCTION(gsl_fft_real_wavetable,free) (wavetable);
+
+          GSL_ERROR_VAL ("failed to allocate half length tables",
+                         GSL_ENOMEM, 0);
+        }
+    }
+
   return wavetable;
 }
 
@@ -142,7 +187,12 @@ FUNCTION(gsl_fft_real_workspace,alloc) (size_t n)
 
   workspace->n = n;
 
-  workspace->scratch = (BASE *) malloc (n * sizeof (BASE));
+  /* the Bluestein passes keep their scratch space after the n
+     elements used by the other passes, and even lengths may need room
+     for a complex transform of half the length */
+
+  workspace->scratch = (BASE *) malloc (FUNCTION(fft_real_half,scratch) (n)
+                                        * sizeof (BASE));
 
   if (workspace->scratch == NULL)
     {
@@ -158,10 +208,46 @@ FUNCTION(gsl_fft_real_workspace,alloc) (size_t n)
 
 
 
+size_t
+FUNCTION(gsl_fft_real_wavetable,bytes) (const TYPE(gsl_fft_real_wavetable) * wavetable)
+{
+  size_t bytes = sizeof (TYPE(gsl_fft_real_wavetable))
+    + (wavetable->n / 2) * sizeof (TYPE(gsl_complex));
+  size_t i;
+
+  for (i = 0; i < wavetable->nf; i++)
+    {
+      if (wavetable->bluestein[i] != NULL)
+        bytes += FUNCTION(fft_bluestein,bytes) (wavetable->bluestein[i]);
+    }
+
+  if (wavetable->half != NULL)
+    bytes += FUNCTION(fft_real_half,bytes) (wavetable->half);
+
+  return bytes;
+}
+
+size_t
+FUNCTION(gsl_fft_real_workspace,bytes) (const TYPE(gsl_fft_real_workspace) * workspace)
+{
+  return sizeof (TYPE(gsl_fft_real_workspace))
+    + FUNCTION(fft_real_half,scratch) (workspace->n) * sizeof (BASE);
+}
+
 void
 FUNCTION(gsl_fft_real_wavetable,free) (TYPE(gsl_fft_real_wavetable) * wavetable)
 {
+  size_t i;
+
   RETURN_IF_NULL (wavetable);
+
+  for (i = 0; i < wavetable->nf; i++)
+    {
+      FUNCTION(fft_bluestein,free) (wavetable->bluestein[i]);
+    }
+
+  FUNCTION(fft_real_half,free) (wavetable->half);
+
   /* release trigonometric lookup tables */
 
   free (wavetable->trig);
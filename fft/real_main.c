@@ -69,6 +69,12 @@ FUNCTION(gsl_fft_real,transform) (BASE data[], const size_t stride, const size_t
       GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
     }
 
+  if (wavetable->half != NULL)
+    {
+      return FUNCTION(fft_real_half,transform) (wavetable->half, data, stride,
+                                                scratch);
+    }
+
   for (i = 0; i < nf; i++)
     {
       const size_t factor = wavetable->factor[i];
@@ -124,6 +130,14 @@ FUNCTION(gsl_fft_real,transform) (BASE data[], const size_t stride, const size_t
           FUNCTION(fft_real,pass_5) (in, istride, out, ostride, product, n, twiddle1,
                                      twiddle2, twiddle3, twiddle4);
         }
+      else if (wavetable->bluestein[i] != NULL)
+        {
+          twiddle1 = wavetable->twiddle[i];
+          FUNCTION(fft_real,pass_bluestein) (in, istride, out, ostride, factor, 
+                                             product, n, twiddle1, 
+                                             wavetable->bluestein[i],
+                                             scratch + n);
+        }
       else
         {
           twiddle1 = wavetable->twiddle[i];
@@ -0,0 +1,356 @@
+/* fft/real_md.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* 2d transforms of real data. The forward transform applies the real
+   transform to each row, unpacks the halfcomplex result in place into
+   the n2/2+1 complex coefficients which are not redundant, and then
+   applies the complex transform to these n2/2+1 columns (see c_md.c).
+   The backward transform reverses the steps. */
+
+typedef struct
+  {
+    const BASE * in;
+    BASE * out;
+    size_t n2;
+    const TYPE(gsl_fft_real_wavetable) * real_wavetable;
+    const TYPE(gsl_fft_halfcomplex_wavetable) * hc_wavetable;
+    TYPE(gsl_fft_real_workspace) ** work;
+  }
+TYPE(fft_real_md_pass);
+
+static int
+FUNCTION(fft_real,md_rows) (void * ctx, size_t thread, size_t begin,
+                            size_t end)
+{
+  const TYPE(fft_real_md_pass) * pass = (TYPE(fft_real_md_pass) *) ctx;
+  const size_t n2 = pass->n2;
+  const size_t nc = n2 / 2 + 1;
+  size_t i, k;
+
+  for (i = begin; i < end; i++)
+    {
+      const BASE * x = pass->in + i * n2;
+      BASE * y = pass->out + 2 * i * nc;
+      int status;
+
+      for (k = 0; k < n2; k++)
+        {
+          y[k] = x[k];
+        }
+
+      status = FUNCTION(gsl_fft_real,transform) (y, 1, n2, pass->real_wavetable,
+                                                 pass->work[thread]);
+      if (status)
+        {
+          return status;
+        }
+
+      /* unpack r0, r1, i1, r2, i2, ... into complex coefficients,
+         working backwards since each one moves up one place */
+
+      if (n2 % 2 == 0)
+        {
+          REAL(y,1,nc - 1) = y[n2 - 1];
+          IMAG(y,1,nc - 1) = 0.0;
+          k = nc - 1;
+        }
+      else
+        {
+          k = nc;
+        }
+
+      while (--k > 0)
+        {
+          IMAG(y,1,k) = y[2 * k];
+          REAL(y,1,k) = y[2 * k - 1];
+        }
+
+      IMAG(y,1,0) = 0.0;
+    }
+
+  return 0;
+}
+
+static int
+FUNCTION(fft_halfcomplex,md_rows) (void * ctx, size_t thread, size_t begin,
+                                   size_t end)
+{
+  const TYPE(fft_real_md_pass) * pass = (TYPE(fft_real_md_pass) *) ctx;
+  const size_t n2 = pass->n2;
+  const size_t nc = n2 / 2 + 1;
+  size_t i, k;
+
+  for (i = begin; i < end; i++)
+    {
+      const BASE * x = pass->in + 2 * i * nc;
+      BASE * y = pass->out + i * n2;
+      int status;
+
+      y[0] = REAL(x,1,0);
+
+      for (k = 1; 2 * k < n2; k++)
+        {
+          y[2 * k - 1] = REAL(x,1,k);
+          y[2 * k] = IMAG(x,1,k);
+        }
+
+      if (n2 % 2 == 0)
+        {
+          y[n2 - 1] = REAL(x,1,nc - 1);
+        }
+
+      status = FUNCTION(gsl_fft_halfcomplex,transform) (y, 1, n2,
+                                                        pass->hc_wavetable,
+                                                        pass->work[thread]);
+      if (status)
+        {
+          return status;
+        }
+    }
+
+  return 0;
+}
+
+static void
+FUNCTION(fft_real,md_work_free) (TYPE(gsl_fft_real_workspace) ** work,
+                                 const size_t nthreads)
+{
+  size_t t;
+
+  RETURN_IF_NULL (work);
+
+  for (t = 0; t < nthreads; t++)
+    {
+      FUNCTION(gsl_fft_real_workspace,free) (work[t]);
+    }
+
+  free (work);
+}
+
+static TYPE(gsl_fft_real_workspace) **
+FUNCTION(fft_real,md_work_alloc) (const size_t n, const size_t nthreads)
+{
+  size_t t;
+  TYPE(gsl_fft_real_workspace) ** work = (TYPE(gsl_fft_real_workspace) **)
+    calloc (nthreads, sizeof (TYPE(gsl_fft_real_workspace) *));
+
+  if (work == NULL)
+    {
+      return NULL;
+    }
+
+  for (t = 0; t < nthreads; t++)
+    {
+      work[t] = FUNCTION(gsl_fft_real_workspace,alloc) (n);
+
+      if (work[t] == NULL)
+        {
+          FUNCTION(fft_real,md_work_free) (work, nthreads);
+          return NULL;
+        }
+    }
+
+  return work;
+}
+
+TYPE(gsl_fft_real_2d_workspace) *
+FUNCTION(gsl_fft_real_2d_workspace,alloc) (const size_t n1, const size_t n2)
+{
+  TYPE(gsl_fft_real_2d_workspace) * w;
+
+  if (n1 == 0 || n2 == 0)
+    {
+      GSL_ERROR_VAL ("dimensions must be positive integers", GSL_EDOM, 0);
+    }
+
+  w = (TYPE(gsl_fft_real_2d_workspace) *)
+    calloc (1, sizeof (TYPE(gsl_fft_real_2d_workspace)));
+
+  if (w == NULL)
+    {
+      GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
+    }
+
+  w->n1 = n1;
+  w->n2 = n2;
+
+  w->wavetable = FUNCTION(gsl_fft_complex_wavetable,alloc) (n1);
+  w->real_wavetable = FUNCTION(gsl_fft_real_wavetable,alloc) (n2);
+  w->hc_wavetable = FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (n2);
+
+  if (w->wavetable == NULL || w->real_wavetable == NULL
+      || w->hc_wavetable == NULL)
+    {
+      FUNCTION(gsl_fft_real_2d_workspace,free) (w);
+      GSL_ERROR_VAL ("failed to allocate wavetables", GSL_ENOMEM, 0);
+    }
+
+  if (FUNCTION(gsl_fft_real_2d_workspace,set_threads) (w, 1))
+    {
+      FUNCTION(gsl_fft_real_2d_workspace,free) (w);
+      GSL_ERROR_VAL ("failed to allocate workspaces", GSL_ENOMEM, 0);
+    }
+
+  return w;
+}
+
+void
+FUNCTION(gsl_fft_real_2d_workspace,free) (TYPE(gsl_fft_real_2d_workspace) * w)
+{
+  RETURN_IF_NULL (w);
+
+  FUNCTION(fft_complex,md_work_free) (w->work, w->nthreads);
+  FUNCTION(fft_real,md_work_free) (w->real_work, w->nthreads);
+  free (w->block);
+  FUNCTION(gsl_fft_complex_wavetable,free) (w->wavetable);
+  FUNCTION(gsl_fft_real_wavetable,free) (w->real_wavetable);
+  FUNCTION(gsl_fft_halfcomplex_wavetable,free) (w->hc_wavetable);
+  free (w);
+}
+
+int
+FUNCTION(gsl_fft_real_2d_workspace,set_threads) (TYPE(gsl_fft_real_2d_workspace) * w,
+                                                 const size_t nthreads)
+{
+  const size_t nt = (nthreads == 0) ? 1 : nthreads;
+
+  TYPE(gsl_fft_complex_workspace) ** work = FUNCTION(fft_complex,md_work_alloc) (w->n1, nt);
+  TYPE(gsl_fft_real_workspace) ** real_work = FUNCTION(fft_real,md_work_alloc) (w->n2, nt);
+  BASE * block = (BASE *) malloc (2 * FFT_BLOCK * w->n1 * nt * sizeof (BASE));
+
+  if (work == NULL || real_work == NULL || block == NULL)
+    {
+      FUNCTION(fft_complex,md_work_free) (work, nt);
+      FUNCTION(fft_real,md_work_free) (real_work, nt);
+      free (block);
+      GSL_ERROR ("failed to allocate thread workspaces", GSL_ENOMEM);
+    }
+
+  FUNCTION(fft_complex,md_work_free) (w->work, w->nthreads);
+  FUNCTION(fft_real,md_work_free) (w->real_work, w->nthreads);
+  free (w->block);
+
+  w->nthreads = nt;
+  w->work = work;
+  w->real_work = real_work;
+  w->block = block;
+
+  return GSL_SUCCESS;
+}
+
+int
+FUNCTION(gsl_fft_real,2d_transform) (const BASE in[],
+                                     const size_t n1, const size_t n2,
+                                     TYPE(gsl_complex_packed_array) out,
+                                     TYPE(gsl_fft_real_2d_workspace) * w)
+{
+  TYPE(fft_real_md_pass) pass;
+  int status;
+
+  if (n1 != w->n1 || n2 != w->n2)
+    {
+      GSL_ERROR ("workspace does not match dimensions of data", GSL_EBADLEN);
+    }
+
+  pass.in = in;
+  pass.out = out;
+  pass.n2 = n2;
+  pass.real_wavetable = w->real_wavetable;
+  pass.hc_wavetable = w->hc_wavetable;
+  pass.work = w->real_work;
+
+  status = parallel_for (w->nthreads, n1, FUNCTION(fft_real,md_rows),
+                         &pass);
+  if (status)
+    {
+      return status;
+    }
+
+  status = FUNCTION(fft_complex,md_transform_columns) (out, n2 / 2 + 1, n1,
+                                                       n2 / 2 + 1, 1, 0,
+                                                       w->wavetable, w->work,
+                                                       w->block, FFT_BLOCK * n1,
+                                                       w->nthreads,
+                                                       gsl_fft_forward);
+  return status;
+}
+
+int
+FUNCTION(gsl_fft_halfcomplex,2d_backward) (TYPE(gsl_complex_packed_array) in,
+                                           const size_t n1, const size_t n2,
+                                           BASE out[],
+                                           TYPE(gsl_fft_real_2d_workspace) * w)
+{
+  TYPE(fft_real_md_pass) pass;
+  int status;
+
+  if (n1 != w->n1 || n2 != w->n2)
+    {
+      GSL_ERROR ("workspace does not match dimensions of data", GSL_EBADLEN);
+    }
+
+  status = FUNCTION(fft_complex,md_transform_columns) (in, n2 / 2 + 1, n1,
+                                                       n2 / 2 + 1, 1, 0,
+                                                       w->wavetable, w->work,
+                                                       w->block, FFT_BLOCK * n1,
+                                                       w->nthreads,
+                                                       gsl_fft_backward);
+  if (status)
+    {
+      return status;
+    }
+
+  pass.in = in;
+  pass.out = out;
+  pass.n2 = n2;
+  pass.real_wavetable = w->real_wavetable;
+  pass.hc_wavetable = w->hc_wavetable;
+  pass.work = w->real_work;
+
+  status = parallel_for (w->nthreads, n1,
+                         FUNCTION(fft_halfcomplex,md_rows), &pass);
+  return status;
+}
+
+int
+FUNCTION(gsl_fft_halfcomplex,2d_inverse) (TYPE(gsl_complex_packed_array) in,
+                                          const size_t n1, const size_t n2,
+                                          BASE out[],
+                                          TYPE(gsl_fft_real_2d_workspace) * w)
+{
+  int status = FUNCTION(gsl_fft_halfcomplex,2d_backward) (in, n1, n2, out, w);
+
+  if (status)
+    {
+      return status;
+    }
+
+  /* normalize inverse fft with 1/(n1 n2) */
+
+  {
+    const size_t n = n1 * n2;
+    const ATOMIC norm = 1.0 / (double) n;
+    size_t i;
+
+    for (i = 0; i < n; i++)
+      {
+        out[i] *= norm;
+      }
+  }
+
+  return status;
+}
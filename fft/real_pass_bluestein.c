@@ -0,0 +1,166 @@
+/* fft/real_pass_bluestein.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the same pass as pass_n for an odd prime factor, with each
+   W(factor) computed as a complex DFT by Bluestein's algorithm (see
+   c_bluestein.c) instead of by direct summation. */
+
+static void
+FUNCTION(fft_real,pass_bluestein) (const BASE in[],
+                                   const size_t istride,
+                                   BASE out[],
+                                   const size_t ostride,
+                                   const size_t factor,
+                                   const size_t product,
+                                   const size_t n,
+                                   const TYPE(gsl_complex) twiddle[],
+                                   const TYPE(fft_bluestein) * bluestein,
+                                   BASE work[])
+{
+  size_t k, k1;
+
+  const size_t m = n / factor;
+  const size_t q = n / product;
+  const size_t product_1 = product / factor;
+
+  size_t e1, e2;
+
+  BASE * const z = work;
+  BASE * const tw = work + 2 * factor;
+  BASE * const cwork = work + 4 * factor;
+
+  for (k1 = 0; k1 < q; k1++)
+    {
+      /* compute x = W(factor) z, for z real */
+
+      for (e2 = 0; e2 < factor; e2++)
+        {
+          REAL(z,1,e2) = VECTOR(in,istride,k1 * product_1 + e2 * m);
+          IMAG(z,1,e2) = 0.0;
+        }
+
+      FUNCTION(fft_bluestein,dft) (bluestein, gsl_fft_forward, z, cwork);
+
+      VECTOR(out,ostride,product * k1) = REAL(z,1,0);
+
+      for (e1 = 1; e1 < factor - e1; e1++)
+        {
+          const size_t to0 = k1 * product + 2 * e1 * product_1 - 1;
+          VECTOR(out,ostride,to0) = REAL(z,1,e1);
+          VECTOR(out,ostride,to0 + 1) = IMAG(z,1,e1);
+        }
+    }
+
+  if (product_1 == 1)
+    return;
+
+  for (k = 1; k < (product_1 + 1) / 2; k++)
+    {
+      const size_t tskip = (product_1 + 1) / 2 - 1;
+
+      for (k1 = 0; k1 < q; k1++)
+        {
+          for (e2 = 0; e2 < factor; e2++)
+            {
+              const size_t from0 = k1 * product_1 + 2 * k + e2 * m - 1;
+              const ATOMIC f0_real = VECTOR(in,istride,from0);
+              const ATOMIC f0_imag = VECTOR(in,istride,from0 + 1);
+
+              if (e2 == 0)
+                {
+                  REAL(z,1,e2) = f0_real;
+                  IMAG(z,1,e2) = f0_imag;
+                }
+              else
+                {
+                  const size_t t_index = (k - 1) + (e2 - 1) * tskip;
+                  const ATOMIC tw_real = GSL_REAL(twiddle[t_index]);
+                  const ATOMIC tw_imag = -GSL_IMAG(twiddle[t_index]);
+
+                  REAL(z,1,e2) = tw_real * f0_real - tw_imag * f0_imag;
+                  IMAG(z,1,e2) = tw_real * f0_imag + tw_imag * f0_real;
+                }
+            }
+
+          FUNCTION(fft_bluestein,dft) (bluestein, gsl_fft_forward, z, cwork);
+
+          for (e1 = 0; e1 < factor; e1++)
+            {
+              if (e1 < factor - e1)
+                {
+                  const size_t to0 = k1 * product - 1 + 2 * e1 * product_1 + 2 * k;
+                  VECTOR(out,ostride,to0) = REAL(z,1,e1);
+                  VECTOR(out,ostride,to0 + 1) = IMAG(z,1,e1);
+                }
+              else
+                {
+                  const size_t to0 = k1 * product - 1 + 2 * (factor - e1) * product_1 - 2 * k;
+                  VECTOR(out,ostride,to0) = REAL(z,1,e1);
+                  VECTOR(out,ostride,to0 + 1) = -IMAG(z,1,e1);
+                }
+            }
+        }
+    }
+
+  if (product_1 % 2 == 1)
+    return;
+
+  /* k = product_1 / 2, the inputs are real with twiddle exp(-i pi e2/factor) */
+
+  k = product_1 / 2;
+
+  for (e2 = 0; e2 < factor; e2++)
+    {
+      const double theta = -M_PI * (double) e2 / (double) factor;
+      REAL(tw,1,e2) = cos (theta);
+      IMAG(tw,1,e2) = sin (theta);
+    }
+
+  for (k1 = 0; k1 < q; k1++)
+    {
+      for (e2 = 0; e2 < factor; e2++)
+        {
+          const size_t from0 = k1 * product_1 + 2 * k + e2 * m - 1;
+          const ATOMIC f0_real = VECTOR(in,istride,from0);
+          REAL(z,1,e2) = REAL(tw,1,e2) * f0_real;
+          IMAG(z,1,e2) = IMAG(tw,1,e2) * f0_real;
+        }
+
+      FUNCTION(fft_bluestein,dft) (bluestein, gsl_fft_forward, z, cwork);
+
+      for (e1 = 0; e1 < factor; e1++)
+        {
+          if (e1 + 1 < factor - e1)
+            {
+              const size_t to0 = k1 * product - 1 + 2 * e1 * product_1 + 2 * k;
+              VECTOR(out,ostride,to0) = REAL(z,1,e1);
+              VECTOR(out,ostride,to0 + 1) = IMAG(z,1,e1);
+            }
+          else if (e1 + 1 == factor - e1)
+            {
+              const size_t to0 = k1 * product - 1 + 2 * e1 * product_1 + 2 * k;
+              VECTOR(out,ostride,to0) = REAL(z,1,e1);
+            }
+          else
+            {
+              const size_t to0 = k1 * product - 1 + 2 * (factor - e1) * product_1 - 2 * k;
+              VECTOR(out,ostride,to0) = REAL(z,1,e1);
+              VECTOR(out,ostride,to0 + 1) = -IMAG(z,1,e1);
+            }
+        }
+    }
+}
@@ -27,19 +27,30 @@
 
 #include <gsl/gsl_complex.h>
 #include <gsl/gsl_errno.h>
+#include <gsl/gsl_minmax.h>
 #include <gsl/gsl_dft_complex.h>
+#include <gsl/gsl_dft_complex_float.h>
 #include <gsl/gsl_fft_complex.h>
 #include <gsl/gsl_fft_complex_float.h>
 #include <gsl/gsl_fft_real.h>
 #include <gsl/gsl_fft_real_float.h>
 #include <gsl/gsl_fft_halfcomplex.h>
 #include <gsl/gsl_fft_halfcomplex_float.h>
+#include <gsl/gsl_fft_plan.h>
+#include <gsl/gsl_fft_multidim.h>
+#include <gsl/gsl_fft_multidim_float.h>
+#include <gsl/gsl_fft_convolve.h>
+#include <gsl/gsl_fft_convolve_float.h>
+#include <gsl/gsl_fft_dct.h>
+#include <gsl/gsl_fft_dct_float.h>
 #include <gsl/gsl_ieee_utils.h>
 #include <gsl/gsl_test.h>
 
 void my_error_handler (const char *reason, const char *file,
                        int line, int err);
 
+double urand (void);
+
 #include "complex_internal.h"
 
 /* Usage: test [n]
@@ -53,6 +64,11 @@ void my_error_handler (const char *reason, const char *file,
 #include "test_complex_source.c"
 #include "test_real_source.c"
 #include "test_trap_source.c"
+#include "test_md_source.c"
+#include "test_batch_source.c"
+#include "test_fourstep_source.c"
+#include "test_conv_source.c"
+#include "test_dct_source.c"
 #include "templates_off.h"
 #undef  BASE_DOUBLE
 
@@ -63,9 +79,16 @@ void my_error_handler (const char *reason, const char *file,
 #include "test_complex_source.c"
 #include "test_real_source.c"
 #include "test_trap_source.c"
+#include "test_md_source.c"
+#include "test_batch_source.c"
+#include "test_fourstep_source.c"
+#include "test_conv_source.c"
+#include "test_dct_source.c"
 #include "templates_off.h"
 #undef  BASE_FLOAT
 
+#include "test_plan.c"
+
 int
 main (int argc, char *argv[])
 {
@@ -111,6 +134,134 @@ main (int argc, char *argv[])
         }
     }
 
+  /* longer lengths made of several radix-8 passes, and real lengths
+     which use a complex transform of half the length */
+
+  if (n == 0)
+    {
+      const size_t big[] = { 128, 512, 514, 1536, 4096, 0 };
+
+      for (i = 0 ; big[i] != 0 ; i++)
+        {
+          for (stride = 1 ; stride < 3 ; stride++)
+            {
+              test_complex_func (stride, big[i]) ;
+              test_complex_float_func (stride, big[i]) ;
+              test_real_func (stride, big[i]) ;
+              test_real_float_func (stride, big[i]) ;
+            }
+        }
+    }
+
+  /* lengths with a prime factor above 90, which use Bluestein's
+     algorithm */
+
+  if (n == 0)
+    {
+      const size_t prime[] = { 194, 388, 582, 0 };
+
+      for (i = 0 ; prime[i] != 0 ; i++)
+        {
+          for (stride = 1 ; stride < 3 ; stride++)
+            {
+              test_complex_func (stride, prime[i]) ;
+              test_complex_float_func (stride, prime[i]) ;
+              test_real_func (stride, prime[i]) ;
+              test_real_float_func (stride, prime[i]) ;
+            }
+        }
+    }
+
+  /* multidimensional transforms */
+
+  if (n == 0)
+    {
+      test_md_complex_2d (6, 10, 10) ;
+      test_md_complex_2d (17, 5, 8) ;
+      test_md_complex_2d (1, 8, 8) ;
+      test_md_complex_2d (40, 1, 3) ;
+      test_md_complex_2d (33, 20, 21) ;
+      test_md_float_complex_2d (12, 9, 11) ;
+      test_md_complex_3d (4, 6, 5) ;
+      test_md_complex_3d (3, 1, 7) ;
+      test_md_complex_3d (5, 18, 1) ;
+      test_md_float_complex_3d (4, 3, 20) ;
+      test_md_real_2d (6, 10) ;
+      test_md_real_2d (7, 9) ;
+      test_md_real_2d (5, 1) ;
+      test_md_real_2d (1, 6) ;
+      test_md_real_2d (20, 33) ;
+      test_md_float_real_2d (8, 11) ;
+    }
+
+  /* batches of transforms, contiguous, strided and interleaved */
+
+  if (n == 0)
+    {
+      test_batch_complex (64, 37, 1, 64) ;
+      test_batch_complex (60, 20, 2, 130) ;
+      test_batch_complex (45, 9, 9, 1) ;
+      test_batch_complex (1, 5, 1, 1) ;
+      test_batch_complex (194, 18, 1, 194) ;
+      test_batch_complex (1024, 40, 1, 1024) ;
+      test_batch_float_complex (96, 21, 1, 100) ;
+    }
+
+  /* long transforms, which use the four-step algorithm */
+
+  if (n == 0)
+    {
+      test_fourstep_complex (4194304, 1) ;
+      test_fourstep_complex (4200000, 1) ;
+      test_fourstep_float_complex (4200000, 2) ;
+      test_fourstep_real (8388608) ;
+      test_fourstep_float_real (8400000) ;
+    }
+
+  /* convolutions and correlations */
+
+  if (n == 0)
+    {
+      test_conv_real (100, 17, 1) ;
+      test_conv_real (7, 30, 2) ;
+      test_conv_real (1, 1, 1) ;
+      test_conv_real (250, 1, 3) ;
+      test_conv_float_real (64, 9, 1) ;
+      test_conv_complex (100, 17, 1) ;
+      test_conv_complex (7, 30, 2) ;
+      test_conv_complex (1, 5, 1) ;
+      test_conv_float_complex (33, 12, 1) ;
+      test_conv_overlap_save (1, 300) ;
+      test_conv_overlap_save (31, 1000) ;
+      test_conv_overlap_save (100, 3000) ;
+      test_conv_float_overlap_save (25, 700) ;
+    }
+
+  /* cosine and sine transforms */
+
+  if (n == 0)
+    {
+      int type;
+
+      for (type = GSL_FFT_DCT_I; type <= GSL_FFT_DST_IV; type++)
+        {
+          test_dct_transform (type, 64, 1) ;
+          test_dct_transform (type, 45, 2) ;
+          test_dct_transform (type, 2, 1) ;
+          test_dct_transform (type, 97, 1) ;
+          test_dct_float_transform (type, 30, 3) ;
+          if (type != GSL_FFT_DCT_I)
+            test_dct_transform (type, 1, 1) ;
+        }
+    }
+
+  for (i = start ; i <= end ; i += 7)
+    {
+      test_plan_cache (i) ;
+    }
+
+  test_plan_bytes () ;
+
   gsl_set_error_handler (&my_error_handler);
   test_trap () ;
   test_float_trap () ;
@@ -0,0 +1,109 @@
+/* fft/test_batch_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+void FUNCTION(test_batch,complex) (size_t n, size_t howmany, size_t stride,
+                                   size_t dist);
+
+void
+FUNCTION(test_batch,complex) (size_t n, size_t howmany, size_t stride,
+                              size_t dist)
+{
+  size_t i, t;
+  int status;
+  const size_t len = (howmany - 1) * dist + (n - 1) * stride + 1;
+  BASE * data = (BASE *) malloc (2 * len * sizeof (BASE));
+  BASE * orig = (BASE *) malloc (2 * len * sizeof (BASE));
+  BASE * ref = (BASE *) malloc (2 * len * sizeof (BASE));
+  BASE * serial = (BASE *) malloc (2 * len * sizeof (BASE));
+  BASE * x = (BASE *) malloc (2 * n * sizeof (BASE));
+  BASE * y = (BASE *) malloc (2 * n * sizeof (BASE));
+  char * used = (char *) calloc (len, 1);
+  TYPE(gsl_fft_complex_wavetable) * wavetable =
+    FUNCTION(gsl_fft_complex_wavetable,alloc) (n);
+  TYPE(gsl_fft_complex_batch_workspace) * w =
+    FUNCTION(gsl_fft_complex_batch_workspace,alloc) (n);
+
+  for (i = 0; i < 2 * len; i++)
+    {
+      orig[i] = (BASE) urand ();
+      data[i] = orig[i];
+      ref[i] = orig[i];
+    }
+
+  for (t = 0; t < howmany; t++)
+    {
+      for (i = 0; i < n; i++)
+        {
+          REAL(x,1,i) = REAL(orig,1,t * dist + i * stride);
+          IMAG(x,1,i) = IMAG(orig,1,t * dist + i * stride);
+          used[t * dist + i * stride] = 1;
+        }
+
+      FUNCTION(gsl_dft_complex,forward) (x, 1, n, y);
+
+      for (i = 0; i < n; i++)
+        {
+          REAL(ref,1,t * dist + i * stride) = REAL(y,1,i);
+          IMAG(ref,1,t * dist + i * stride) = IMAG(y,1,i);
+        }
+    }
+
+  FUNCTION(gsl_fft_complex,batch_forward) (data, stride, dist, n, howmany,
+                                           wavetable, w);
+  status = FUNCTION(compare_complex,results) ("dft", ref, "fft", data,
+                                              1, len, 1e6);
+  gsl_test (status, NAME(gsl_fft_complex) "_batch_forward, n = %d, howmany = %d, stride = %d, dist = %d",
+            n, howmany, stride, dist);
+
+  status = 0;
+  for (i = 0; i < len; i++)
+    {
+      if (!used[i])
+        status |= (data[2 * i] != orig[2 * i] || data[2 * i + 1] != orig[2 * i + 1]);
+    }
+  gsl_test (status, NAME(gsl_fft_complex) "_batch_forward avoids gaps, n = %d, howmany = %d, stride = %d, dist = %d",
+            n, howmany, stride, dist);
+
+  memcpy (serial, data, 2 * len * sizeof (BASE));
+
+  FUNCTION(gsl_fft_complex,batch_inverse) (data, stride, dist, n, howmany,
+                                           wavetable, w);
+  status = FUNCTION(compare_complex,results) ("orig", orig, "fft inverse", data,
+                                              1, len, 1e6);
+  gsl_test (status, NAME(gsl_fft_complex) "_batch_inverse, n = %d, howmany = %d, stride = %d, dist = %d",
+            n, howmany, stride, dist);
+
+  /* the result does not depend on the number of threads */
+
+  FUNCTION(gsl_fft_complex_batch_workspace,set_threads) (w, 3);
+  memcpy (data, orig, 2 * len * sizeof (BASE));
+  FUNCTION(gsl_fft_complex,batch_forward) (data, stride, dist, n, howmany,
+                                           wavetable, w);
+  gsl_test (memcmp (data, serial, 2 * len * sizeof (BASE)) != 0,
+            NAME(gsl_fft_complex) "_batch_forward with 3 threads, n = %d, howmany = %d, stride = %d, dist = %d",
+            n, howmany, stride, dist);
+
+  FUNCTION(gsl_fft_complex_batch_workspace,free) (w);
+  FUNCTION(gsl_fft_complex_wavetable,free) (wavetable);
+  free (data);
+  free (orig);
+  free (ref);
+  free (serial);
+  free (x);
+  free (y);
+  free (used);
+}
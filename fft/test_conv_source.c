@@ -0,0 +1,272 @@
+/* fft/test_conv_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+void FUNCTION(test_conv,real) (size_t nx, size_t nk, size_t stride);
+void FUNCTION(test_conv,complex) (size_t nx, size_t nk, size_t stride);
+void FUNCTION(test_conv,overlap_save) (size_t nk, size_t len);
+
+void
+FUNCTION(test_conv,real) (size_t nx, size_t nk, size_t stride)
+{
+  size_t i, l;
+  int status;
+  const size_t ny = nx + nk - 1;
+  BASE * x = (BASE *) malloc (stride * nx * sizeof (BASE));
+  BASE * h = (BASE *) malloc (nk * sizeof (BASE));
+  BASE * y = (BASE *) malloc (stride * ny * sizeof (BASE));
+  BASE * ref = (BASE *) malloc (stride * ny * sizeof (BASE));
+  TYPE(gsl_fft_real_convolution) * c;
+
+  for (i = 0; i < stride * nx; i++)
+    {
+      x[i] = (BASE) urand ();
+    }
+
+  for (i = 0; i < nk; i++)
+    {
+      h[i] = (BASE) urand ();
+    }
+
+  c = FUNCTION(gsl_fft_real_convolution,alloc) (h, 1, nk, nx);
+
+  for (i = 0; i < stride * ny; i++)
+    {
+      ref[i] = 0.0;
+    }
+
+  for (i = 0; i < nx; i++)
+    {
+      for (l = 0; l < nk; l++)
+        {
+          ref[(i + l) * stride] += x[i * stride] * h[l];
+        }
+    }
+
+  FUNCTION(gsl_fft_real,convolve) (c, x, stride, nx, y, stride);
+  status = FUNCTION(compare_real,results) ("direct", ref, "fft", y,
+                                           stride, ny, 1e6);
+  gsl_test (status, NAME(gsl_fft_real) "_convolve, nx = %d, nk = %d, stride = %d",
+            nx, nk, stride);
+
+  /* correlation, r_k = sum_l x_(l+k) h_l for k = -(nk-1) .. nx-1 */
+
+  for (i = 0; i < stride * ny; i++)
+    {
+      ref[i] = 0.0;
+    }
+
+  for (i = 0; i < nx; i++)
+    {
+      for (l = 0; l < nk; l++)
+        {
+          ref[(i + nk - 1 - l) * stride] += x[i * stride] * h[l];
+        }
+    }
+
+  FUNCTION(gsl_fft_real,correlate) (c, x, stride, nx, y, stride);
+  status = FUNCTION(compare_real,results) ("direct", ref, "fft", y,
+                                           stride, ny, 1e6);
+  gsl_test (status, NAME(gsl_fft_real) "_correlate, nx = %d, nk = %d, stride = %d",
+            nx, nk, stride);
+
+  /* a shorter signal with the same kernel transform */
+
+  for (i = 0; i < stride * ny; i++)
+    {
+      ref[i] = 0.0;
+    }
+
+  for (i = 0; i < (nx + 1) / 2; i++)
+    {
+      for (l = 0; l < nk; l++)
+        {
+          ref[(i + l) * stride] += x[i * stride] * h[l];
+        }
+    }
+
+  FUNCTION(gsl_fft_real,convolve) (c, x, stride, (nx + 1) / 2, y, stride);
+  status = FUNCTION(compare_real,results) ("direct", ref, "fft", y,
+                                           stride, (nx + 1) / 2 + nk - 1, 1e6);
+  gsl_test (status, NAME(gsl_fft_real) "_convolve shorter signal, nx = %d, nk = %d, stride = %d",
+            (nx + 1) / 2, nk, stride);
+
+  FUNCTION(gsl_fft_real_convolution,free) (c);
+  free (x);
+  free (h);
+  free (y);
+  free (ref);
+}
+
+void
+FUNCTION(test_conv,complex) (size_t nx, size_t nk, size_t stride)
+{
+  size_t i, l;
+  int status;
+  const size_t ny = nx + nk - 1;
+  BASE * x = (BASE *) malloc (2 * stride * nx * sizeof (BASE));
+  BASE * h = (BASE *) malloc (2 * nk * sizeof (BASE));
+  BASE * y = (BASE *) malloc (2 * stride * ny * sizeof (BASE));
+  BASE * ref = (BASE *) malloc (2 * stride * ny * sizeof (BASE));
+  TYPE(gsl_fft_complex_convolution) * c;
+
+  for (i = 0; i < 2 * stride * nx; i++)
+    {
+      x[i] = (BASE) urand ();
+    }
+
+  for (i = 0; i < 2 * nk; i++)
+    {
+      h[i] = (BASE) urand ();
+    }
+
+  c = FUNCTION(gsl_fft_complex_convolution,alloc) (h, 1, nk, nx);
+
+  for (i = 0; i < 2 * stride * ny; i++)
+    {
+      ref[i] = 0.0;
+    }
+
+  for (i = 0; i < nx; i++)
+    {
+      for (l = 0; l < nk; l++)
+        {
+          REAL(ref,stride,i + l) += (REAL(x,stride,i) * REAL(h,1,l)
+                                     - IMAG(x,stride,i) * IMAG(h,1,l));
+          IMAG(ref,stride,i + l) += (REAL(x,stride,i) * IMAG(h,1,l)
+                                     + IMAG(x,stride,i) * REAL(h,1,l));
+        }
+    }
+
+  FUNCTION(gsl_fft_complex,convolve) (c, x, stride, nx, y, stride);
+  status = FUNCTION(compare_complex,results) ("direct", ref, "fft", y,
+                                              stride, ny, 1e6);
+  gsl_test (status, NAME(gsl_fft_complex) "_convolve, nx = %d, nk = %d, stride = %d",
+            nx, nk, stride);
+
+  /* correlation, r_k = sum_l x_(l+k) conj(h_l) */
+
+  for (i = 0; i < 2 * stride * ny; i++)
+    {
+      ref[i] = 0.0;
+    }
+
+  for (i = 0; i < nx; i++)
+    {
+      for (l = 0; l < nk; l++)
+        {
+          REAL(ref,stride,i + nk - 1 - l) += (REAL(x,stride,i) * REAL(h,1,l)
+                                              + IMAG(x,stride,i) * IMAG(h,1,l));
+          IMAG(ref,stride,i + nk - 1 - l) += (IMAG(x,stride,i) * REAL(h,1,l)
+                                              - REAL(x,stride,i) * IMAG(h,1,l));
+        }
+    }
+
+  FUNCTION(gsl_fft_complex,correlate) (c, x, stride, nx, y, stride);
+  status = FUNCTION(compare_complex,results) ("direct", ref, "fft", y,
+                                              stride, ny, 1e6);
+  gsl_test (status, NAME(gsl_fft_complex) "_correlate, nx = %d, nk = %d, stride = %d",
+            nx, nk, stride);
+
+  FUNCTION(gsl_fft_complex_convolution,free) (c);
+  free (x);
+  free (h);
+  free (y);
+  free (ref);
+}
+
+void
+FUNCTION(test_conv,overlap_save) (size_t nk, size_t len)
+{
+  size_t i, l;
+  int status;
+  BASE * x = (BASE *) malloc (len * sizeof (BASE));
+  BASE * h = (BASE *) malloc (nk * sizeof (BASE));
+  BASE * y = (BASE *) malloc (len * sizeof (BASE));
+  BASE * z = (BASE *) malloc (len * sizeof (BASE));
+  BASE * ref = (BASE *) malloc (len * sizeof (BASE));
+  TYPE(gsl_fft_real_overlap_save) * s;
+  size_t step;
+
+  for (i = 0; i < len; i++)
+    {
+      x[i] = (BASE) urand ();
+    }
+
+  for (i = 0; i < nk; i++)
+    {
+      h[i] = (BASE) urand ();
+    }
+
+  s = FUNCTION(gsl_fft_real_overlap_save,alloc) (h, 1, nk);
+  step = s->step;
+
+  /* the output is the convolution delayed by step samples */
+
+  for (i = 0; i < len; i++)
+    {
+      ref[i] = 0.0;
+
+      for (l = 0; l < nk && l + step <= i; l++)
+        {
+          ref[i] += h[l] * x[i - step - l];
+        }
+    }
+
+  /* chunks of varying length, including empty ones */
+
+  i = 0;
+  while (i < len)
+    {
+      size_t m = (size_t) (urand () * 2.5 * step);
+
+      if (m > len - i)
+        {
+          m = len - i;
+        }
+
+      FUNCTION(gsl_fft_real_overlap_save,process) (s, x + i, 1, m, y + i, 1);
+      i += m;
+    }
+
+  status = FUNCTION(compare_real,results) ("direct", ref, "overlap-save", y,
+                                           1, len, 1e6);
+  gsl_test (status, NAME(gsl_fft_real_overlap_save) "_process, nk = %d, step = %d, len = %d",
+            nk, step, len);
+
+  /* in place, after a reset, in chunks of one block */
+
+  FUNCTION(gsl_fft_real_overlap_save,reset) (s);
+  memcpy (z, x, len * sizeof (BASE));
+
+  for (i = 0; i < len; i += step)
+    {
+      FUNCTION(gsl_fft_real_overlap_save,process) (s, z + i, 1,
+                                                   GSL_MIN (step, len - i),
+                                                   z + i, 1);
+    }
+
+  gsl_test (memcmp (z, y, len * sizeof (BASE)) != 0,
+            NAME(gsl_fft_real_overlap_save) "_process in place, nk = %d, step = %d, len = %d",
+            nk, step, len);
+
+  FUNCTION(gsl_fft_real_overlap_save,free) (s);
+  free (x);
+  free (h);
+  free (y);
+  free (z);
+  free (ref);
+}
@@ -0,0 +1,128 @@
+/* fft/test_dct_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+void FUNCTION(test_dct,transform) (gsl_fft_dct_type type, size_t n,
+                                   size_t stride);
+
+/* direct evaluation of the definitions */
+
+static void
+FUNCTION(test_dct,direct) (gsl_fft_dct_type type, const BASE x[],
+                           size_t stride, size_t n, BASE y[])
+{
+  size_t j, k;
+
+  for (k = 0; k < n; k++)
+    {
+      const double sk = (k % 2) ? -1.0 : 1.0;
+      double sum = 0.0;
+
+      for (j = 0; j < n; j++)
+        {
+          const double xj = x[j * stride];
+          double a;
+
+          switch (type)
+            {
+            case GSL_FFT_DCT_I:
+              if (j == 0)
+                a = xj;
+              else if (j == n - 1)
+                a = sk * xj;
+              else
+                a = 2 * xj * cos (M_PI * j * k / (n - 1.0));
+              break;
+            case GSL_FFT_DCT_II:
+              a = 2 * xj * cos (M_PI * (j + 0.5) * k / n);
+              break;
+            case GSL_FFT_DCT_III:
+              a = (j == 0) ? xj : 2 * xj * cos (M_PI * j * (k + 0.5) / n);
+              break;
+            case GSL_FFT_DCT_IV:
+              a = 2 * xj * cos (M_PI * (j + 0.5) * (k + 0.5) / n);
+              break;
+            case GSL_FFT_DST_I:
+              a = 2 * xj * sin (M_PI * (j + 1.0) * (k + 1.0) / (n + 1.0));
+              break;
+            case GSL_FFT_DST_II:
+              a = 2 * xj * sin (M_PI * (j + 0.5) * (k + 1.0) / n);
+              break;
+            case GSL_FFT_DST_III:
+              if (j == n - 1)
+                a = sk * xj;
+              else
+                a = 2 * xj * sin (M_PI * (j + 1.0) * (k + 0.5) / n);
+              break;
+            default:
+              a = 2 * xj * sin (M_PI * (j + 0.5) * (k + 0.5) / n);
+              break;
+            }
+
+          sum += a;
+        }
+
+      y[k * stride] = (BASE) sum;
+    }
+}
+
+void
+FUNCTION(test_dct,transform) (gsl_fft_dct_type type, size_t n, size_t stride)
+{
+  static const char * names[] = { "DCT-I", "DCT-II", "DCT-III", "DCT-IV",
+                                  "DST-I", "DST-II", "DST-III", "DST-IV" };
+  size_t i;
+  int status;
+  BASE * data = (BASE *) malloc (stride * n * sizeof (BASE));
+  BASE * orig = (BASE *) malloc (stride * n * sizeof (BASE));
+  BASE * ref = (BASE *) malloc (stride * n * sizeof (BASE));
+  TYPE(gsl_fft_dct_workspace) * w = FUNCTION(gsl_fft_dct_workspace,alloc) (type, n);
+
+  for (i = 0; i < stride * n; i++)
+    {
+      orig[i] = (BASE) urand ();
+      data[i] = orig[i];
+      ref[i] = orig[i];
+    }
+
+  FUNCTION(test_dct,direct) (type, orig, stride, n, ref);
+
+  FUNCTION(gsl_fft_dct,transform) (data, stride, n, w);
+  status = FUNCTION(compare_real,results) ("direct", ref, "fft", data,
+                                           stride, n, 1e6);
+  gsl_test (status, NAME(gsl_fft_dct) "_transform %s, n = %d, stride = %d",
+            names[type], n, stride);
+
+  status = 0;
+  for (i = 0; i < stride * n; i++)
+    {
+      if (i % stride != 0)
+        status |= (data[i] != orig[i]);
+    }
+  gsl_test (status, NAME(gsl_fft_dct) "_transform %s avoids unstrided data, n = %d, stride = %d",
+            names[type], n, stride);
+
+  FUNCTION(gsl_fft_dct,inverse) (data, stride, n, w);
+  status = FUNCTION(compare_real,results) ("orig", orig, "fft inverse", data,
+                                           stride, n, 1e6);
+  gsl_test (status, NAME(gsl_fft_dct) "_inverse %s, n = %d, stride = %d",
+            names[type], n, stride);
+
+  FUNCTION(gsl_fft_dct_workspace,free) (w);
+  free (data);
+  free (orig);
+  free (ref);
+}
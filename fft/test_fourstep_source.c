@@ -0,0 +1,194 @@
+/* fft/test_fourstep_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* The lengths which use the four-step algorithm are too long for a
+   full comparison with the dft, so a sample of the outputs is compared
+   with direct sums, and powers of 2 are also compared with the radix-2
+   routines. The data has zero mean so that the outputs are all of
+   similar size. */
+
+void FUNCTION(test_fourstep,complex) (size_t n, size_t stride);
+
+void
+FUNCTION(test_fourstep,complex) (size_t n, size_t stride)
+{
+  const size_t nk = 16;
+  size_t i, j;
+  int status;
+  BASE * data = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+  BASE * orig = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+  BASE * serial = (BASE *) malloc (2 * n * stride * sizeof (BASE));
+  BASE * x = (BASE *) malloc (2 * nk * sizeof (BASE));
+  BASE * y = (BASE *) malloc (2 * nk * sizeof (BASE));
+  TYPE(gsl_fft_complex_wavetable) * wavetable =
+    FUNCTION(gsl_fft_complex_wavetable,alloc) (n);
+  TYPE(gsl_fft_complex_workspace) * work =
+    FUNCTION(gsl_fft_complex_workspace,alloc) (n);
+
+  for (i = 0; i < 2 * n * stride; i++)
+    {
+      orig[i] = (BASE) (urand () - 0.5);
+      data[i] = orig[i];
+    }
+
+  FUNCTION(gsl_fft_complex,forward) (data, stride, n, wavetable, work);
+
+  /* outputs at both ends, and spread over the rest */
+
+  for (i = 0; i < nk; i++)
+    {
+      const size_t k = (i < nk / 2) ? i : n - 1 - (i * 7919) % (n / 2);
+      double sum_real = 0, sum_imag = 0;
+      size_t e = 0;   /* j k mod n */
+
+      for (j = 0; j < n; j++)
+        {
+          const double theta = -2.0 * M_PI * (double) e / (double) n;
+          const double w_real = cos (theta);
+          const double w_imag = sin (theta);
+
+          sum_real += REAL(orig,stride,j) * w_real - IMAG(orig,stride,j) * w_imag;
+          sum_imag += REAL(orig,stride,j) * w_imag + IMAG(orig,stride,j) * w_real;
+
+          e += k;
+
+          if (e >= n)
+            {
+              e -= n;
+            }
+        }
+
+      REAL(x,1,i) = (BASE) sum_real;
+      IMAG(x,1,i) = (BASE) sum_imag;
+      REAL(y,1,i) = REAL(data,stride,k);
+      IMAG(y,1,i) = IMAG(data,stride,k);
+    }
+
+  status = FUNCTION(compare_complex,results) ("dft", x, "fft", y, 1, nk, 1e6);
+  gsl_test (status, NAME(gsl_fft_complex) "_forward four-step, n = %d, stride = %d",
+            n, stride);
+
+  /* the radix-2 routines compute their twiddle factors by recurrence,
+     which loses accuracy at these lengths, but an error in the order
+     of the outputs would still be of the size of the outputs */
+
+  if ((n & (n - 1)) == 0)
+    {
+      memcpy (serial, orig, 2 * n * stride * sizeof (BASE));
+      FUNCTION(gsl_fft_complex,radix2_forward) (serial, stride, n);
+      status = FUNCTION(compare_complex,results) ("radix2", serial, "fft", data,
+                                                  stride, n, 1e9);
+      gsl_test (status, NAME(gsl_fft_complex) "_forward four-step vs radix2, n = %d, stride = %d",
+                n, stride);
+    }
+
+  memcpy (serial, data, 2 * n * stride * sizeof (BASE));
+
+  FUNCTION(gsl_fft_complex,inverse) (data, stride, n, wavetable, work);
+  status = FUNCTION(compare_complex,results) ("orig", orig, "fft inverse", data,
+                                              stride, n, 1e6);
+  gsl_test (status, NAME(gsl_fft_complex) "_inverse four-step, n = %d, stride = %d",
+            n, stride);
+
+  /* the result does not depend on the number of threads */
+
+  FUNCTION(gsl_fft_complex_workspace,set_threads) (work, 3);
+  memcpy (data, orig, 2 * n * stride * sizeof (BASE));
+  FUNCTION(gsl_fft_complex,forward) (data, stride, n, wavetable, work);
+  gsl_test (memcmp (data, serial, 2 * n * stride * sizeof (BASE)) != 0,
+            NAME(gsl_fft_complex) "_forward four-step with 3 threads, n = %d, stride = %d",
+            n, stride);
+
+  FUNCTION(gsl_fft_complex_workspace,free) (work);
+  FUNCTION(gsl_fft_complex_wavetable,free) (wavetable);
+  free (data);
+  free (orig);
+  free (serial);
+  free (x);
+  free (y);
+}
+
+/* real transforms of twice the length use a four-step complex
+   transform of length n/2, see real_half.c */
+
+void FUNCTION(test_fourstep,real) (size_t n);
+
+void
+FUNCTION(test_fourstep,real) (size_t n)
+{
+  const size_t nk = 8;
+  size_t i, j;
+  int status;
+  BASE * data = (BASE *) malloc (n * sizeof (BASE));
+  BASE * orig = (BASE *) malloc (n * sizeof (BASE));
+  BASE * x = (BASE *) malloc (2 * nk * sizeof (BASE));
+  BASE * y = (BASE *) malloc (2 * nk * sizeof (BASE));
+  TYPE(gsl_fft_real_wavetable) * rw = FUNCTION(gsl_fft_real_wavetable,alloc) (n);
+  TYPE(gsl_fft_halfcomplex_wavetable) * hw = FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (n);
+  TYPE(gsl_fft_real_workspace) * work = FUNCTION(gsl_fft_real_workspace,alloc) (n);
+
+  for (i = 0; i < n; i++)
+    {
+      orig[i] = (BASE) (urand () - 0.5);
+      data[i] = orig[i];
+    }
+
+  FUNCTION(gsl_fft_real,transform) (data, 1, n, rw, work);
+
+  for (i = 0; i < nk; i++)
+    {
+      const size_t k = 1 + (i * 7919) % (n / 2 - 1);
+      double sum_real = 0, sum_imag = 0;
+      size_t e = 0;   /* j k mod n */
+
+      for (j = 0; j < n; j++)
+        {
+          const double theta = -2.0 * M_PI * (double) e / (double) n;
+
+          sum_real += orig[j] * cos (theta);
+          sum_imag += orig[j] * sin (theta);
+
+          e += k;
+
+          if (e >= n)
+            {
+              e -= n;
+            }
+        }
+
+      REAL(x,1,i) = (BASE) sum_real;
+      IMAG(x,1,i) = (BASE) sum_imag;
+      REAL(y,1,i) = data[2 * k - 1];
+      IMAG(y,1,i) = data[2 * k];
+    }
+
+  status = FUNCTION(compare_complex,results) ("dft", x, "fft", y, 1, nk, 1e6);
+  gsl_test (status, NAME(gsl_fft_real) " four-step, n = %d", n);
+
+  FUNCTION(gsl_fft_halfcomplex,inverse) (data, 1, n, hw, work);
+  status = FUNCTION(compare_real,results) ("orig", orig, "fft inverse", data,
+                                           1, n, 1e6);
+  gsl_test (status, NAME(gsl_fft_halfcomplex) "_inverse four-step, n = %d", n);
+
+  FUNCTION(gsl_fft_real_workspace,free) (work);
+  FUNCTION(gsl_fft_halfcomplex_wavetable,free) (hw);
+  FUNCTION(gsl_fft_real_wavetable,free) (rw);
+  free (data);
+  free (orig);
+  free (x);
+  free (y);
+}
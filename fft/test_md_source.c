@@ -0,0 +1,241 @@
+/* fft/test_md_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+void FUNCTION(test_md,complex_2d) (size_t n1, size_t n2, size_t tda);
+void FUNCTION(test_md,complex_3d) (size_t n1, size_t n2, size_t n3);
+void FUNCTION(test_md,real_2d) (size_t n1, size_t n2);
+
+/* reference transform of an n1 x n2 array by dfts along each dimension */
+
+static void
+FUNCTION(test_md,dft_2d) (BASE data[], size_t tda, size_t n1, size_t n2)
+{
+  size_t i, j;
+  size_t nmax = GSL_MAX (n1, n2);
+  BASE * tmp = (BASE *) malloc (2 * nmax * sizeof (BASE));
+  BASE * col = (BASE *) malloc (2 * nmax * sizeof (BASE));
+
+  for (i = 0; i < n1; i++)
+    {
+      FUNCTION(gsl_dft_complex,forward) (data + 2 * i * tda, 1, n2, tmp);
+      for (j = 0; j < n2; j++)
+        {
+          REAL(data,1,i * tda + j) = REAL(tmp,1,j);
+          IMAG(data,1,i * tda + j) = IMAG(tmp,1,j);
+        }
+    }
+
+  /* the dft result has the same stride as its input */
+
+  for (j = 0; j < n2; j++)
+    {
+      for (i = 0; i < n1; i++)
+        {
+          REAL(col,1,i) = REAL(data,1,i * tda + j);
+          IMAG(col,1,i) = IMAG(data,1,i * tda + j);
+        }
+      FUNCTION(gsl_dft_complex,forward) (col, 1, n1, tmp);
+      for (i = 0; i < n1; i++)
+        {
+          REAL(data,1,i * tda + j) = REAL(tmp,1,i);
+          IMAG(data,1,i * tda + j) = IMAG(tmp,1,i);
+        }
+    }
+
+  free (tmp);
+  free (col);
+}
+
+void
+FUNCTION(test_md,complex_2d) (size_t n1, size_t n2, size_t tda)
+{
+  size_t i;
+  int status;
+  const size_t n = n1 * tda;
+  BASE * data = (BASE *) malloc (2 * n * sizeof (BASE));
+  BASE * orig = (BASE *) malloc (2 * n * sizeof (BASE));
+  BASE * ref = (BASE *) malloc (2 * n * sizeof (BASE));
+  BASE * serial = (BASE *) malloc (2 * n * sizeof (BASE));
+  TYPE(gsl_fft_complex_2d_workspace) * w =
+    FUNCTION(gsl_fft_complex_2d_workspace,alloc) (n1, n2);
+
+  for (i = 0; i < 2 * n; i++)
+    {
+      orig[i] = (BASE) urand ();
+      data[i] = orig[i];
+      ref[i] = orig[i];
+    }
+
+  FUNCTION(test_md,dft_2d) (ref, tda, n1, n2);
+
+  FUNCTION(gsl_fft_complex,2d_forward) (data, tda, n1, n2, w);
+  status = FUNCTION(compare_complex,results) ("dft", ref, "fft", data,
+                                              1, n, 1e6);
+  gsl_test (status, NAME(gsl_fft_complex) "_2d_forward, n1 = %d, n2 = %d, tda = %d",
+            n1, n2, tda);
+
+  status = 0;
+  for (i = 0; i < n1 * tda; i++)
+    {
+      if (i % tda >= n2)
+        status |= (data[2 * i] != orig[2 * i] || data[2 * i + 1] != orig[2 * i + 1]);
+    }
+  gsl_test (status, NAME(gsl_fft_complex) "_2d_forward avoids padding, n1 = %d, n2 = %d, tda = %d",
+            n1, n2, tda);
+
+  memcpy (serial, data, 2 * n * sizeof (BASE));
+
+  FUNCTION(gsl_fft_complex,2d_inverse) (data, tda, n1, n2, w);
+  status = FUNCTION(compare_complex,results) ("orig", orig, "fft inverse", data,
+                                              1, n, 1e6);
+  gsl_test (status, NAME(gsl_fft_complex) "_2d_inverse, n1 = %d, n2 = %d, tda = %d",
+            n1, n2, tda);
+
+  /* the result does not depend on the number of threads */
+
+  FUNCTION(gsl_fft_complex_2d_workspace,set_threads) (w, 3);
+  memcpy (data, orig, 2 * n * sizeof (BASE));
+  FUNCTION(gsl_fft_complex,2d_forward) (data, tda, n1, n2, w);
+  gsl_test (memcmp (data, serial, 2 * n * sizeof (BASE)) != 0,
+            NAME(gsl_fft_complex) "_2d_forward with 3 threads, n1 = %d, n2 = %d, tda = %d",
+            n1, n2, tda);
+
+  FUNCTION(gsl_fft_complex_2d_workspace,free) (w);
+  free (data);
+  free (orig);
+  free (ref);
+  free (serial);
+}
+
+void
+FUNCTION(test_md,complex_3d) (size_t n1, size_t n2, size_t n3)
+{
+  size_t i, j;
+  int status;
+  const size_t n = n1 * n2 * n3;
+  BASE * data = (BASE *) malloc (2 * n * sizeof (BASE));
+  BASE * orig = (BASE *) malloc (2 * n * sizeof (BASE));
+  BASE * ref = (BASE *) malloc (2 * n * sizeof (BASE));
+  BASE * tmp = (BASE *) malloc (2 * n1 * sizeof (BASE));
+  BASE * col = (BASE *) malloc (2 * n1 * sizeof (BASE));
+  TYPE(gsl_fft_complex_3d_workspace) * w =
+    FUNCTION(gsl_fft_complex_3d_workspace,alloc) (n1, n2, n3);
+
+  for (i = 0; i < 2 * n; i++)
+    {
+      orig[i] = (BASE) urand ();
+      data[i] = orig[i];
+      ref[i] = orig[i];
+    }
+
+  /* 2d transform of each plane, then dfts along the first dimension */
+
+  for (i = 0; i < n1; i++)
+    {
+      FUNCTION(test_md,dft_2d) (ref + 2 * i * n2 * n3, n3, n2, n3);
+    }
+
+  for (j = 0; j < n2 * n3; j++)
+    {
+      for (i = 0; i < n1; i++)
+        {
+          REAL(col,1,i) = REAL(ref,1,i * n2 * n3 + j);
+          IMAG(col,1,i) = IMAG(ref,1,i * n2 * n3 + j);
+        }
+      FUNCTION(gsl_dft_complex,forward) (col, 1, n1, tmp);
+      for (i = 0; i < n1; i++)
+        {
+          REAL(ref,1,i * n2 * n3 + j) = REAL(tmp,1,i);
+          IMAG(ref,1,i * n2 * n3 + j) = IMAG(tmp,1,i);
+        }
+    }
+
+  FUNCTION(gsl_fft_complex_3d_workspace,set_threads) (w, 2);
+
+  FUNCTION(gsl_fft_complex,3d_forward) (data, n1, n2, n3, w);
+  status = FUNCTION(compare_complex,results) ("dft", ref, "fft", data,
+                                              1, n, 1e6);
+  gsl_test (status, NAME(gsl_fft_complex) "_3d_forward, n1 = %d, n2 = %d, n3 = %d",
+            n1, n2, n3);
+
+  FUNCTION(gsl_fft_complex,3d_inverse) (data, n1, n2, n3, w);
+  status = FUNCTION(compare_complex,results) ("orig", orig, "fft inverse", data,
+                                              1, n, 1e6);
+  gsl_test (status, NAME(gsl_fft_complex) "_3d_inverse, n1 = %d, n2 = %d, n3 = %d",
+            n1, n2, n3);
+
+  FUNCTION(gsl_fft_complex_3d_workspace,free) (w);
+  free (data);
+  free (orig);
+  free (ref);
+  free (tmp);
+  free (col);
+}
+
+void
+FUNCTION(test_md,real_2d) (size_t n1, size_t n2)
+{
+  size_t i, j;
+  int status;
+  const size_t nc = n2 / 2 + 1;
+  BASE * real_data = (BASE *) malloc (n1 * n2 * sizeof (BASE));
+  BASE * real_orig = (BASE *) malloc (n1 * n2 * sizeof (BASE));
+  BASE * out = (BASE *) malloc (2 * n1 * nc * sizeof (BASE));
+  BASE * ref = (BASE *) malloc (2 * n1 * n2 * sizeof (BASE));
+  BASE * ref_half = (BASE *) malloc (2 * n1 * nc * sizeof (BASE));
+  TYPE(gsl_fft_real_2d_workspace) * w =
+    FUNCTION(gsl_fft_real_2d_workspace,alloc) (n1, n2);
+
+  for (i = 0; i < n1 * n2; i++)
+    {
+      real_orig[i] = (BASE) urand ();
+      REAL(ref,1,i) = real_orig[i];
+      IMAG(ref,1,i) = 0.0;
+    }
+
+  FUNCTION(test_md,dft_2d) (ref, n2, n1, n2);
+
+  for (i = 0; i < n1; i++)
+    {
+      for (j = 0; j < nc; j++)
+        {
+          REAL(ref_half,1,i * nc + j) = REAL(ref,1,i * n2 + j);
+          IMAG(ref_half,1,i * nc + j) = IMAG(ref,1,i * n2 + j);
+        }
+    }
+
+  FUNCTION(gsl_fft_real_2d_workspace,set_threads) (w, 2);
+
+  FUNCTION(gsl_fft_real,2d_transform) (real_orig, n1, n2, out, w);
+  status = FUNCTION(compare_complex,results) ("dft", ref_half, "fft", out,
+                                              1, n1 * nc, 1e6);
+  gsl_test (status, NAME(gsl_fft_real) "_2d_transform, n1 = %d, n2 = %d",
+            n1, n2);
+
+  FUNCTION(gsl_fft_halfcomplex,2d_inverse) (out, n1, n2, real_data, w);
+  status = FUNCTION(compare_real,results) ("orig", real_orig, "fft inverse",
+                                           real_data, 1, n1 * n2, 1e6);
+  gsl_test (status, NAME(gsl_fft_halfcomplex) "_2d_inverse, n1 = %d, n2 = %d",
+            n1, n2);
+
+  FUNCTION(gsl_fft_real_2d_workspace,free) (w);
+  free (real_data);
+  free (real_orig);
+  free (out);
+  free (ref);
+  free (ref_half);
+}
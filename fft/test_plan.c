@@ -0,0 +1,156 @@
+/* fft/test_plan.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+void test_plan_cache (size_t n);
+void test_plan_bytes (void);
+
+void
+test_plan_cache (size_t n)
+{
+  int status;
+  size_t i;
+  const gsl_fft_plan * p1, * p2, * pr, * ph;
+  gsl_fft_complex_workspace * cw1, * cw2;
+  gsl_fft_real_workspace * rw;
+  gsl_fft_plan_cache * cache = gsl_fft_plan_cache_alloc (1 << 20);
+
+  double * data = (double *) malloc (2 * n * sizeof (double));
+  double * fft_data = (double *) malloc (2 * n * sizeof (double));
+  double * real_data = (double *) malloc (n * sizeof (double));
+  double * real_tmp = (double *) malloc (n * sizeof (double));
+
+  /* repeated lookups share one wavetable */
+
+  p1 = gsl_fft_plan_get (cache, n, gsl_fft_plan_complex);
+  p2 = gsl_fft_plan_get (cache, n, gsl_fft_plan_complex);
+
+  status = (p1 == 0 || p1 != p2 || p1->complex_wavetable == 0
+            || cache->hits != 1 || cache->misses != 1);
+  gsl_test (status, "gsl_fft_plan_get shares complex plan, n = %u",
+            (unsigned int) n);
+
+  /* a cached plan gives the same transform as a private wavetable */
+
+  cw1 = gsl_fft_plan_complex_workspace_get (cache, n);
+
+  fft_signal_complex_noise (n, 1, data, fft_data);
+  gsl_fft_complex_forward (data, 1, n, p1->complex_wavetable, cw1);
+  status = compare_complex_results ("dft", fft_data, "fft of noise", data,
+                                    1, n, 1e6);
+  gsl_test (status, "gsl_fft_complex_forward with cached plan, n = %u",
+            (unsigned int) n);
+
+  gsl_fft_plan_complex_workspace_release (cache, cw1);
+  cw2 = gsl_fft_plan_complex_workspace_get (cache, n);
+  gsl_test (cw1 != cw2, "gsl_fft_plan workspace is pooled, n = %u",
+            (unsigned int) n);
+  gsl_fft_plan_complex_workspace_release (cache, cw2);
+
+  /* real and halfcomplex plans are keyed separately */
+
+  pr = gsl_fft_plan_get (cache, n, gsl_fft_plan_real);
+  ph = gsl_fft_plan_get (cache, n, gsl_fft_plan_halfcomplex);
+
+  status = (pr == 0 || ph == 0 || pr == ph || pr->real_wavetable == 0
+            || ph->halfcomplex_wavetable == 0 || cache->misses != 3);
+  gsl_test (status, "gsl_fft_plan_get real/halfcomplex plans, n = %u",
+            (unsigned int) n);
+
+  rw = gsl_fft_plan_real_workspace_get (cache, n);
+
+  fft_signal_real_noise (n, 1, data, fft_data);
+  for (i = 0; i < n; i++)
+    {
+      real_data[i] = data[2 * i];
+      real_tmp[i] = real_data[i];
+    }
+
+  gsl_fft_real_transform (real_data, 1, n, pr->real_wavetable, rw);
+  gsl_fft_halfcomplex_inverse (real_data, 1, n, ph->halfcomplex_wavetable, rw);
+  status = compare_real_results ("orig", real_tmp, "fft inverse", real_data,
+                                 1, n, 1e6);
+  gsl_test (status, "gsl_fft_real/halfcomplex with cached plans, n = %u",
+            (unsigned int) n);
+
+  gsl_fft_plan_real_workspace_release (cache, rw);
+
+  gsl_fft_plan_release (cache, p1);
+  gsl_fft_plan_release (cache, p2);
+  gsl_fft_plan_release (cache, pr);
+  gsl_fft_plan_release (cache, ph);
+
+  /* shrinking the budget evicts everything that is no longer in use */
+
+  cache->max_bytes = 0;
+  p1 = gsl_fft_plan_get (cache, n + 1, gsl_fft_plan_complex);
+
+  status = (cache->bytes != p1->bytes || cache->evictions == 0);
+  gsl_test (status, "gsl_fft_plan_cache evicts unused entries, n = %u",
+            (unsigned int) n);
+
+  gsl_fft_plan_release (cache, p1);
+
+  gsl_test (cache->bytes != 0, "gsl_fft_plan_cache respects max_bytes, n = %u",
+            (unsigned int) n);
+
+  gsl_fft_plan_cache_free (cache);
+
+  free (data);
+  free (fft_data);
+  free (real_data);
+  free (real_tmp);
+}
+
+/* the size of a plan includes the tables hung off its wavetable: the
+   Bluestein tables of the factor 101, and the half length complex
+   transform of an even real length.  A pooled workspace is charged
+   for its Bluestein scratch space too */
+
+void
+test_plan_bytes (void)
+{
+  const size_t n = 2 * 101, nr = 1024;
+  gsl_fft_plan_cache * cache = gsl_fft_plan_cache_alloc (1 << 20);
+  const gsl_fft_plan * p = gsl_fft_plan_get (cache, n, gsl_fft_plan_complex);
+  const gsl_fft_plan * pr = gsl_fft_plan_get (cache, nr, gsl_fft_plan_real);
+  gsl_fft_complex_workspace * w;
+  size_t bytes;
+
+  gsl_test (p->bytes <= sizeof (gsl_fft_plan)
+            + sizeof (gsl_fft_complex_wavetable) + n * sizeof (gsl_complex),
+            "gsl_fft_plan bytes include the Bluestein tables, n = %u",
+            (unsigned int) n);
+  gsl_test (pr->bytes <= sizeof (gsl_fft_plan)
+            + sizeof (gsl_fft_real_wavetable) + (nr / 2) * sizeof (gsl_complex),
+            "gsl_fft_plan bytes include the half length tables, n = %u",
+            (unsigned int) nr);
+  gsl_test (cache->bytes != p->bytes + pr->bytes,
+            "gsl_fft_plan_cache bytes is the sum of its plans");
+
+  bytes = cache->bytes;
+  w = gsl_fft_plan_complex_workspace_get (cache, n);
+  gsl_fft_plan_complex_workspace_release (cache, w);
+
+  gsl_test (cache->bytes - bytes <= sizeof (gsl_fft_complex_workspace)
+            + 4 * n * sizeof (double),
+            "gsl_fft_plan_cache bytes include the Bluestein scratch space, n = %u",
+            (unsigned int) n);
+
+  gsl_fft_plan_release (cache, p);
+  gsl_fft_plan_release (cache, pr);
+  gsl_fft_plan_cache_free (cache);
+}
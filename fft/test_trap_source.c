@@ -124,6 +124,13 @@ FUNCTION(test,trap) (void)
   status = FUNCTION(gsl_fft_halfcomplex,transform) (real_data, 1, 4, hcw, rwork);
   gsl_test (!status, "trap for n != nw in " NAME(gsl_fft_halfcomplex) "_transform");
 
+  /* DCT-I needs at least two points */
+
+  {
+    TYPE(gsl_fft_dct_workspace) * dw = FUNCTION(gsl_fft_dct_workspace,alloc) (GSL_FFT_DCT_I, 1);
+    gsl_test (dw != 0, "trap for n < 2 in " NAME(gsl_fft_dct_workspace) "_alloc for DCT-I");
+  }
+
   FUNCTION (gsl_fft_halfcomplex_wavetable,free) (hcw) ;
   FUNCTION (gsl_fft_real_wavetable,free) (rw) ;
   FUNCTION (gsl_fft_complex_wavetable,free) (cw) ;
@@ -0,0 +1,144 @@
+/* Run the ranges of a loop in POSIX threads, for the internal use of
+   the library.
+
+   parallel_for() splits the loop [0, count) into nthreads contiguous
+   ranges and calls fn(ctx, thread, begin, end) for each, with thread
+   = 0 .. nthreads-1 identifying the scratch space which the call may
+   use.  The calling thread handles the first range and POSIX threads
+   the others.  Without POSIX threads, or if a thread cannot be
+   started, the ranges are run one after another in the calling
+   thread, so the result never depends on the thread count.  Each call
+   must write only its own part of ctx.  The return value is the first
+   nonzero status, or zero. */
+
+#ifndef __GSL_PARALLEL_H__
+#define __GSL_PARALLEL_H__
+
+#include <stdlib.h>
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
+typedef int parallel_fn (void * ctx, size_t thread, size_t begin,
+                         size_t end);
+
+typedef struct
+  {
+    parallel_fn * fn;
+    void * ctx;
+    size_t thread;
+    size_t begin;
+    size_t end;
+    int status;
+  }
+parallel_task;
+
+#ifdef HAVE_PTHREAD_H
+static void *
+parallel_run (void * arg)
+{
+  parallel_task * task = (parallel_task *) arg;
+  task->status = task->fn (task->ctx, task->thread, task->begin, task->end);
+  return NULL;
+}
+#endif
+
+static int
+parallel_for (size_t nthreads, const size_t count, parallel_fn * fn,
+              void * ctx)
+{
+  if (nthreads > count)
+    {
+      nthreads = count;
+    }
+
+  if (nthreads <= 1)
+    {
+      return fn (ctx, 0, 0, count);
+    }
+
+#ifdef HAVE_PTHREAD_H
+  {
+    size_t t;
+    int status = 0;
+    parallel_task * task;
+    pthread_t * thread;
+    char * started;
+
+    task = (parallel_task *) malloc (nthreads * sizeof (parallel_task));
+    thread = (pthread_t *) malloc (nthreads * sizeof (pthread_t));
+    started = (char *) calloc (nthreads, 1);
+
+    if (task == NULL || thread == NULL || started == NULL)
+      {
+        free (task);
+        free (thread);
+        free (started);
+
+        /* fall back to a serial loop, reusing the scratch of thread 0 */
+
+        return fn (ctx, 0, 0, count);
+      }
+
+    for (t = 0; t < nthreads; t++)
+      {
+        task[t].fn = fn;
+        task[t].ctx = ctx;
+        task[t].thread = t;
+        task[t].begin = (t * count) / nthreads;
+        task[t].end = ((t + 1) * count) / nthreads;
+        task[t].status = 0;
+      }
+
+    for (t = 1; t < nthreads; t++)
+      {
+        started[t] = (pthread_create (&thread[t], NULL, parallel_run,
+                                      &task[t]) == 0);
+      }
+
+    parallel_run (&task[0]);
+
+    for (t = 1; t < nthreads; t++)
+      {
+        if (started[t])
+          {
+            pthread_join (thread[t], NULL);
+          }
+        else
+          {
+            parallel_run (&task[t]);
+          }
+      }
+
+    for (t = 0; t < nthreads && status == 0; t++)
+      {
+        status = task[t].status;
+      }
+
+    free (task);
+    free (thread);
+    free (started);
+
+    return status;
+  }
+#else
+  {
+    size_t t;
+
+    for (t = 0; t < nthreads; t++)
+      {
+        int status = fn (ctx, t, (t * count) / nthreads,
+                         ((t + 1) * count) / nthreads);
+        if (status)
+          {
+            return status;
+          }
+      }
+
+    return 0;
+  }
+#endif
+}
+
+#endif /* __GSL_PARALLEL_H__ */
@@ -7,6 +7,7 @@
 #include <gsl/gsl_types.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_inline.h>
+#include <gsl/gsl_rng.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -32,6 +33,13 @@ typedef struct
   size_t (*state_size) (unsigned int dimension);
   int (*init_state) (void * state, unsigned int dimension);
   int (*get) (void * state, unsigned int dimension, double x[]);
+  /* optional, store the next n points in x[]; a null pointer falls
+     back to calling get in a loop */
+  int (*get_array) (void * state, unsigned int dimension, double x[], size_t n);
+  /* optional, position the sequence at the point of index i */
+  int (*set_index) (void * state, unsigned int dimension, unsigned long int i);
+  /* optional, replace the sequence by a random scrambling of it */
+  int (*scramble) (void * state, unsigned int dimension, const gsl_rng * r);
 }
 gsl_qrng_type;
 
@@ -53,6 +61,7 @@ gsl_qrng;
  */
 GSL_VAR const gsl_qrng_type * gsl_qrng_niederreiter_2;
 GSL_VAR const gsl_qrng_type * gsl_qrng_sobol;
+GSL_VAR const gsl_qrng_type * gsl_qrng_sobol_jk;
 GSL_VAR const gsl_qrng_type * gsl_qrng_halton;
 GSL_VAR const gsl_qrng_type * gsl_qrng_reversehalton;
 
@@ -93,6 +102,22 @@ size_t gsl_qrng_size (const gsl_qrng * q);
 void * gsl_qrng_state (const gsl_qrng * q);
 
 
+/* Retrieve the next n vectors in sequence, one after the other. */
+int gsl_qrng_get_array (const gsl_qrng * q, double x[], size_t n);
+
+
+/* Position the generator so that the next vector is the one
+ * after the first i vectors of the sequence.
+ */
+int gsl_qrng_set_index (const gsl_qrng * q, unsigned long int i);
+
+
+/* Scramble the sequence with random numbers from r, keeping
+ * the position in the sequence.
+ */
+int gsl_qrng_scramble (const gsl_qrng * q, const gsl_rng * r);
+
+
 /* Retrieve next vector in sequence. */
 INLINE_DECL int gsl_qrng_get (const gsl_qrng * q, double x[]);
 
@@ -24,14 +24,23 @@
 
 #include <config.h>
 #include <gsl/gsl_qrng.h>
+#include <gsl/gsl_rng.h>
 
 /* maximum allowed space dimension */
 #define HALTON_MAX_DIMENSION 1229
 
+/* number of scrambled digits; with indices below 2^32 the digits
+   beyond these contribute less than 2^-32 */
+#define HALTON_SCRAMBLE_DIGITS 32
+
 /* prototypes for generator type functions */
 static size_t halton_state_size (unsigned int dimension);
 static int halton_init (void *state, unsigned int dimension);
 static int halton_get (void *state, unsigned int dimension, double *v);
+static int halton_set_index (void *state, unsigned int dimension,
+                             unsigned long int i);
+static int halton_scramble (void *state, unsigned int dimension,
+                            const gsl_rng * r);
 
 /* global Halton generator type object */
 static const gsl_qrng_type halton_type = {
@@ -39,7 +48,10 @@ static const gsl_qrng_type halton_type = {
   HALTON_MAX_DIMENSION,
   halton_state_size,
   halton_init,
-  halton_get
+  halton_get,
+  0,
+  halton_set_index,
+  halton_scramble
 };
 
 const gsl_qrng_type *gsl_qrng_halton = &halton_type;
@@ -174,17 +186,26 @@ static const int prime_numbers[HALTON_MAX_DIMENSION] = {
 
 /* Halton generator state.
  *   sequence_count       = number of calls with this generator
+ *   scrambled            = whether the digits are scrambled
+ *
+ * The struct is followed by the multipliers and offsets of the
+ * scrambled digits, scramble[dimension][HALTON_SCRAMBLE_DIGITS][2].
  */
 typedef struct
 {
   unsigned int sequence_count;
+  int scrambled;
 } 
 halton_state_t;
 
+#define SCRAMBLE(s,i) ((unsigned short *) ((halton_state_t *) (s) + 1) \
+                       + 2 * HALTON_SCRAMBLE_DIGITS * (size_t) (i))
+
 static size_t
 halton_state_size (unsigned int dimension)
 {
-  return sizeof (halton_state_t);
+  return sizeof (halton_state_t)
+    + 2 * HALTON_SCRAMBLE_DIGITS * sizeof (unsigned short) * (size_t) dimension;
 }
 
 static int
@@ -193,6 +214,7 @@ halton_init (void *state, unsigned int dimension)
   halton_state_t *h_state = (halton_state_t *) state;
 
   h_state->sequence_count = 0;
+  h_state->scrambled = 0;
 
   if (dimension < 1 || dimension > HALTON_MAX_DIMENSION)
     {
@@ -218,6 +240,27 @@ vdcorput (int x, int b)
   return r;
 }
 
+/* Radical inverse with the k-th digit a mapped to (h a + g) mod b,
+ * for the multiplier h and offset g of the digit in s[2k], s[2k+1].
+ */
+static double
+vdcorput_scrambled (unsigned int x, int b, const unsigned short *s)
+{
+  double r = 0.;
+  double v = 1.;
+  double binv = 1. / (double) b;
+  int k;
+
+  for (k = 0; k < HALTON_SCRAMBLE_DIGITS; k++)
+    {
+      const unsigned int a = x % b;
+      v *= binv;
+      r += v * (double) ((s[2 * k] * a + s[2 * k + 1]) % b);
+      x /= b;
+    }
+  return r;
+}
+
 static int
 halton_get (void *state, unsigned int dimension, double *v)
 {
@@ -230,6 +273,17 @@ halton_get (void *state, unsigned int dimension, double *v)
     }
   h_state->sequence_count++;
 
+  if (h_state->scrambled)
+    {
+      for (i = 0; i < dimension; i++)
+        {
+          v[i] = vdcorput_scrambled (h_state->sequence_count,
+                                     prime_numbers[i], SCRAMBLE (state, i));
+        }
+
+      return GSL_SUCCESS;
+    }
+
   for (i = 0; i < dimension; i++)
     {
       v[i] = vdcorput (h_state->sequence_count, prime_numbers[i]);
@@ -237,3 +291,51 @@ halton_get (void *state, unsigned int dimension, double *v)
 
   return GSL_SUCCESS;
 }
+
+static int
+halton_set_index (void *state, unsigned int dimension, unsigned long int i)
+{
+  halton_state_t *h_state = (halton_state_t *) state;
+
+  /* the count is passed to vdcorput as an int */
+  if (i >= 0x7fffffffUL)
+    {
+      return GSL_EINVAL;
+    }
+
+  h_state->sequence_count = i;
+
+  return GSL_SUCCESS;
+}
+
+/* Random linear digit scrambling: each digit of each dimension has
+ * its own random multiplier h in 1..b-1 and offset g in 0..b-1.
+ */
+static int
+halton_scramble (void *state, unsigned int dimension, const gsl_rng * r)
+{
+  halton_state_t *h_state = (halton_state_t *) state;
+  unsigned int i;
+  int k;
+
+  if (dimension < 1 || dimension > HALTON_MAX_DIMENSION)
+    {
+      return GSL_EINVAL;
+    }
+
+  for (i = 0; i < dimension; i++)
+    {
+      const unsigned long int b = prime_numbers[i];
+      unsigned short *s = SCRAMBLE (state, i);
+
+      for (k = 0; k < HALTON_SCRAMBLE_DIGITS; k++)
+        {
+          s[2 * k] = (unsigned short) (1 + gsl_rng_uniform_int (r, b - 1));
+          s[2 * k + 1] = (unsigned short) gsl_rng_uniform_int (r, b);
+        }
+    }
+
+  h_state->scrambled = 1;
+
+  return GSL_SUCCESS;
+}
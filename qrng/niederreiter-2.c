@@ -6,6 +6,7 @@
  */
 #include <config.h>
 #include <gsl/gsl_qrng.h>
+#include "scramble.h"
 
 
 #define NIED2_CHARACTERISTIC 2
@@ -29,6 +30,8 @@
 static size_t nied2_state_size(unsigned int dimension);
 static int nied2_init(void * state, unsigned int dimension);
 static int nied2_get(void * state, unsigned int dimension, double * v);
+static int nied2_set_index(void * state, unsigned int dimension, unsigned long int i);
+static int nied2_scramble(void * state, unsigned int dimension, const gsl_rng * r);
 
 
 static const gsl_qrng_type nied2_type = 
@@ -37,7 +40,10 @@ static const gsl_qrng_type nied2_type =
   NIED2_MAX_DIMENSION,
   nied2_state_size,
   nied2_init,
-  nied2_get
+  nied2_get,
+  0,
+  nied2_set_index,
+  nied2_scramble
 };
 
 const gsl_qrng_type * gsl_qrng_niederreiter_2 = &nied2_type;
@@ -72,6 +78,7 @@ typedef struct
   unsigned int sequence_count;
   int cj[NIED2_NBITS][NIED2_MAX_DIMENSION];
   int nextq[NIED2_MAX_DIMENSION];
+  int shift[NIED2_MAX_DIMENSION];
 } nied2_state_t;
 
 
@@ -306,7 +313,10 @@ static int nied2_init(void * state, unsigned int dimension)
 
   calculate_cj(n_state, dimension);
 
-  for(i_dim=0; i_dim<dimension; i_dim++) n_state->nextq[i_dim] = 0;
+  for(i_dim=0; i_dim<dimension; i_dim++) {
+    n_state->nextq[i_dim] = 0;
+    n_state->shift[i_dim] = 0;
+  }
   n_state->sequence_count = 0;
 
   return GSL_SUCCESS;
@@ -351,3 +361,56 @@ static int nied2_get(void * state, unsigned int dimension, double * v)
 
   return GSL_SUCCESS;
 }
+
+
+/* The next point after i calls is the shift plus the columns cj
+ * selected by the bits of the Gray code of i.
+ */
+static int nied2_set_index(void * state, unsigned int dimension, unsigned long int i)
+{
+  nied2_state_t * n_state = (nied2_state_t *) state;
+  const unsigned long int g = scramble_gray(i);
+  unsigned int i_dim;
+  int r;
+
+  if(i >= (1UL << NIED2_NBITS)) return GSL_EINVAL;
+
+  for(i_dim=0; i_dim<dimension; i_dim++) {
+    int q = n_state->shift[i_dim];
+    for(r=0; r<NIED2_NBITS; r++) {
+      if((g >> r) & 1) q ^= n_state->cj[r][i_dim];
+    }
+    n_state->nextq[i_dim] = q;
+  }
+
+  n_state->sequence_count = i;
+
+  return GSL_SUCCESS;
+}
+
+
+/* Linear matrix scrambling and digital shift of each dimension,
+ * applied to the unscrambled columns.
+ */
+static int nied2_scramble(void * state, unsigned int dimension, const gsl_rng * r)
+{
+  nied2_state_t * n_state = (nied2_state_t *) state;
+  const unsigned int count = n_state->sequence_count;
+  uint32_t mask[NIED2_NBITS];
+  unsigned int i_dim;
+  int k;
+
+  int status = nied2_init(state, dimension);
+  if(status != GSL_SUCCESS) return status;
+
+  for(i_dim=0; i_dim<dimension; i_dim++) {
+    scramble_matrix(r, mask, NIED2_NBITS);
+    for(k=0; k<NIED2_NBITS; k++) {
+      const uint32_t c = (uint32_t) n_state->cj[k][i_dim];
+      n_state->cj[k][i_dim] = (int) scramble_apply(mask, c, NIED2_NBITS);
+    }
+    n_state->shift[i_dim] = (int) scramble_random_bits(r, NIED2_NBITS);
+  }
+
+  return nied2_set_index(state, dimension, count);
+}
@@ -43,6 +43,57 @@ gsl_qrng_init (gsl_qrng * q)
   (q->type->init_state) (q->state, q->dimension);
 }
 
+int
+gsl_qrng_get_array (const gsl_qrng * q, double x[], size_t n)
+{
+  if (q->type->get_array != 0)
+    {
+      return (q->type->get_array) (q->state, q->dimension, x, n);
+    }
+  else
+    {
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        {
+          int status = (q->type->get) (q->state, q->dimension,
+                                       x + i * q->dimension);
+
+          if (status)
+            return status;
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+int
+gsl_qrng_set_index (const gsl_qrng * q, unsigned long int i)
+{
+  if (q->type->set_index == 0)
+    {
+      GSL_ERROR ("generator does not support skipping", GSL_EUNSUP);
+    }
+
+  if ((q->type->set_index) (q->state, q->dimension, i) != GSL_SUCCESS)
+    {
+      GSL_ERROR ("index is beyond the end of the sequence", GSL_EINVAL);
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_qrng_scramble (const gsl_qrng * q, const gsl_rng * r)
+{
+  if (q->type->scramble == 0)
+    {
+      GSL_ERROR ("generator does not support scrambling", GSL_EUNSUP);
+    }
+
+  return (q->type->scramble) (q->state, q->dimension, r);
+}
+
 int
 gsl_qrng_memcpy (gsl_qrng * dest, const gsl_qrng * src)
 {
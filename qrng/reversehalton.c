@@ -34,6 +34,8 @@
 static size_t reversehalton_state_size (unsigned int dimension);
 static int reversehalton_init (void *state, unsigned int dimension);
 static int reversehalton_get (void *state, unsigned int dimension, double *v);
+static int reversehalton_set_index (void *state, unsigned int dimension,
+                                    unsigned long int i);
 
 /* global Halton generator type object */
 static const gsl_qrng_type reversehalton_type = {
@@ -41,7 +43,10 @@ static const gsl_qrng_type reversehalton_type = {
   REVERSEHALTON_MAX_DIMENSION,
   reversehalton_state_size,
   reversehalton_init,
-  reversehalton_get
+  reversehalton_get,
+  0,
+  reversehalton_set_index,
+  0
 };
 const gsl_qrng_type *gsl_qrng_reversehalton = &reversehalton_type;
 
@@ -239,3 +244,20 @@ reversehalton_get (void *state, unsigned int dimension, double *v)
 
   return GSL_SUCCESS;
 }
+
+static int
+reversehalton_set_index (void *state, unsigned int dimension,
+                         unsigned long int i)
+{
+  reversehalton_state_t *h_state = (reversehalton_state_t *) state;
+
+  /* the count is passed to vdcorput as an int */
+  if (i >= 0x7fffffffUL)
+    {
+      return GSL_EINVAL;
+    }
+
+  h_state->sequence_count = i;
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,92 @@
+/* qrng/scramble.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Random linear scrambling of the base 2 sequences (Sobol and
+   Niederreiter), following Matousek, J. Complexity 14, 527 (1998).
+   The coordinates of each dimension are words of up to 32 digits,
+   most significant first.  Multiplying every direction number by the
+   same random nonsingular lower triangular matrix L over GF(2), and
+   adding a random digital shift e, maps the point x of the sequence to
+   L x + e, which keeps the (t,s)-net properties of the sequence and
+   makes each point uniformly distributed. */
+
+#include <stdint.h>
+#include <gsl/gsl_rng.h>
+
+#define SCRAMBLE_MAX_BITS 32
+
+/* a random word of the given number of bits, 16 bits at a time so as
+   to use only the range which every generator has */
+
+static inline uint32_t
+scramble_random_bits (const gsl_rng * r, const int bits)
+{
+  const uint32_t hi = (uint32_t) gsl_rng_uniform_int (r, 65536);
+  const uint32_t lo = (uint32_t) gsl_rng_uniform_int (r, 65536);
+  const uint32_t w = (hi << 16) | lo;
+
+  return (bits < 32) ? (w & (((uint32_t) 1 << bits) - 1)) : w;
+}
+
+/* Draw the rows of L.  Bit b of L x is the parity of x & mask[b], with
+   bit b itself on the diagonal and random bits above it, so that each
+   digit of L x depends on the digits of x of the same or higher
+   significance. */
+
+static inline void
+scramble_matrix (const gsl_rng * r, uint32_t mask[], const int bits)
+{
+  int b;
+
+  for (b = 0; b < bits; b++)
+    {
+      const uint32_t above = (b + 1 < 32) ? ~(((uint32_t) 2 << b) - 1) : 0;
+
+      mask[b] = ((uint32_t) 1 << b) | (scramble_random_bits (r, bits) & above);
+    }
+}
+
+static inline uint32_t
+scramble_apply (const uint32_t mask[], const uint32_t x, const int bits)
+{
+  uint32_t y = 0;
+  int b;
+
+  for (b = 0; b < bits; b++)
+    {
+      uint32_t p = x & mask[b];
+
+      p ^= p >> 16;
+      p ^= p >> 8;
+      p ^= p >> 4;
+      p ^= p >> 2;
+      p ^= p >> 1;
+
+      y |= (p & 1) << b;
+    }
+
+  return y;
+}
+
+/* the Gray code of the index i, whose bits give the direction numbers
+   summed in the i-th point of a sequence generated in Gray code order */
+
+static inline unsigned long int
+scramble_gray (const unsigned long int i)
+{
+  return i ^ (i >> 1);
+}
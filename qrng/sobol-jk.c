@@ -0,0 +1,304 @@
+/* qrng/sobol-jk.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Sobol generator with the direction numbers of Joe and Kuo, in up to
+ * 21201 dimensions.  The points are computed in the Gray code order of
+ * Antonov and Saleev with 32-bit direction numbers, so that 2^32 - 1
+ * points are available.  As for gsl_qrng_sobol the first point
+ * returned is the one after the origin.  See
+ *   [Joe+Kuo, SIAM J. Sci. Comput. 30, 2635 (2008)]
+ *   [Antonov+Saleev, USSR Comput. Maths. Math. Phys. 19, 252 (1980)]
+ */
+
+#include <config.h>
+#include <stdint.h>
+#include <gsl/gsl_qrng.h>
+#include "vectorize.h"
+#include "scramble.h"
+#include "sobol-jk.h"
+
+/* bits of the direction numbers */
+#define SOBOL_JK_BIT_COUNT 32
+
+/* prototypes for generator type functions */
+static size_t sobol_jk_state_size (unsigned int dimension);
+static int sobol_jk_init (void *state, unsigned int dimension);
+static int sobol_jk_get (void *state, unsigned int dimension, double *v);
+static int sobol_jk_get_array (void *state, unsigned int dimension,
+                               double x[], size_t n);
+static int sobol_jk_set_index (void *state, unsigned int dimension,
+                               unsigned long int i);
+static int sobol_jk_scramble (void *state, unsigned int dimension,
+                              const gsl_rng * r);
+
+/* global Sobol generator type object */
+static const gsl_qrng_type sobol_jk_type = {
+  "sobol_jk",
+  SOBOL_JK_MAX_DIMENSION,
+  sobol_jk_state_size,
+  sobol_jk_init,
+  sobol_jk_get,
+  sobol_jk_get_array,
+  sobol_jk_set_index,
+  sobol_jk_scramble
+};
+
+const gsl_qrng_type *gsl_qrng_sobol_jk = &sobol_jk_type;
+
+/* Sobol generator state.
+ *   sequence_count = number of points returned
+ *
+ * The struct is followed by the numerators of the last point,
+ * numerator[dimension], the digital shift of a scrambled sequence,
+ * shift[dimension], and the direction numbers
+ * v[SOBOL_JK_BIT_COUNT][dimension], with v[k][j] the numerator of the
+ * k-th direction number of dimension j over 2^32.  They are stored
+ * bit by bit so that each step reads a contiguous row.
+ */
+typedef struct
+{
+  uint32_t sequence_count;
+} sobol_jk_state_t;
+
+#define NUMERATOR(s) ((uint32_t *) ((sobol_jk_state_t *) (s) + 1))
+#define SHIFT(s,dim) (NUMERATOR (s) + (dim))
+#define DIRECTION(s,dim,k) (NUMERATOR (s) + (size_t) (dim) * (2 + (k)))
+
+static size_t
+sobol_jk_state_size (unsigned int dimension)
+{
+  return sizeof (sobol_jk_state_t)
+    + sizeof (uint32_t) * (size_t) dimension * (2 + SOBOL_JK_BIT_COUNT);
+}
+
+static int
+sobol_jk_init (void *state, unsigned int dimension)
+{
+  sobol_jk_state_t *s_state = (sobol_jk_state_t *) state;
+  const unsigned int *m = sobol_jk_m;
+  uint32_t *num = NUMERATOR (state);
+  uint32_t *shift = SHIFT (state, dimension);
+  unsigned int i_dim;
+  int k;
+
+  if (dimension < 1 || dimension > SOBOL_JK_MAX_DIMENSION)
+    {
+      return GSL_EINVAL;
+    }
+
+  /* The first dimension is the van der Corput sequence. */
+  for (k = 0; k < SOBOL_JK_BIT_COUNT; k++)
+    {
+      DIRECTION (state, dimension, k)[0] = (uint32_t) 1 << (31 - k);
+    }
+
+  for (i_dim = 1; i_dim < dimension; i_dim++)
+    {
+      const unsigned int p = sobol_jk_poly[i_dim];
+      uint32_t v[SOBOL_JK_BIT_COUNT];
+      int degree = 0, i;
+
+      while ((p >> (degree + 1)) != 0)
+        {
+          degree++;
+        }
+
+      /* The initial direction numbers m_k / 2^k, then the recurrence
+       *   v_k = v_{k-s} ^ (v_{k-s} >> s) ^ a_1 v_{k-1} ^ ... ^ a_{s-1} v_{k-s+1}
+       * of Bratley+Fox for the polynomial x^s + a_1 x^{s-1} + ... + 1.
+       */
+      for (k = 0; k < degree; k++)
+        {
+          v[k] = (uint32_t) m[k] << (31 - k);
+        }
+
+      for (k = degree; k < SOBOL_JK_BIT_COUNT; k++)
+        {
+          uint32_t newv = v[k - degree] ^ (v[k - degree] >> degree);
+
+          for (i = 1; i < degree; i++)
+            {
+              if ((p >> (degree - i)) & 1)
+                newv ^= v[k - i];
+            }
+
+          v[k] = newv;
+        }
+
+      for (k = 0; k < SOBOL_JK_BIT_COUNT; k++)
+        {
+          DIRECTION (state, dimension, k)[i_dim] = v[k];
+        }
+
+      m += degree;
+    }
+
+  s_state->sequence_count = 0;
+
+  for (i_dim = 0; i_dim < dimension; i_dim++)
+    {
+      num[i_dim] = 0;
+      shift[i_dim] = 0;
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* Compute the next n points, with the direction numbers of the step
+ * from point i to point i+1 given by the lowest zero bit of i.  The
+ * numerators are converted through signed integers, which vectorizes
+ * on all instruction sets.
+ */
+static void sobol_jk_points (void *state, const unsigned int dimension,
+                             double x[], size_t n) GSL_VECTORIZE;
+
+static void
+sobol_jk_points (void *state, const unsigned int dimension, double x[],
+                 size_t n)
+{
+  sobol_jk_state_t *s_state = (sobol_jk_state_t *) state;
+  uint32_t *num = NUMERATOR (state);
+  uint32_t count = s_state->sequence_count;
+  size_t i;
+
+  for (i = 0; i < n; i++, count++, x += dimension)
+    {
+      const uint32_t *v;
+      unsigned int j;
+      int ell = 0;
+      uint32_t c = count;
+
+      while (c & 1)
+        {
+          c >>= 1;
+          ell++;
+        }
+
+      v = DIRECTION (state, dimension, ell);
+
+      for (j = 0; j < dimension; j++)
+        {
+          const uint32_t y = num[j] ^ v[j];
+          num[j] = y;
+          x[j] = ((double) (int32_t) (y ^ 0x80000000UL) + 2147483648.0)
+            * (1.0 / 4294967296.0);
+        }
+    }
+
+  s_state->sequence_count = count;
+}
+
+static int
+sobol_jk_get (void *state, unsigned int dimension, double *v)
+{
+  sobol_jk_state_t *s_state = (sobol_jk_state_t *) state;
+
+  /* Check for exhaustion. */
+  if (s_state->sequence_count == 0xffffffffUL)
+    return GSL_EFAILED;
+
+  sobol_jk_points (state, dimension, v, 1);
+
+  return GSL_SUCCESS;
+}
+
+static int
+sobol_jk_get_array (void *state, unsigned int dimension, double x[],
+                    size_t n)
+{
+  sobol_jk_state_t *s_state = (sobol_jk_state_t *) state;
+
+  if (n > 0xffffffffUL - s_state->sequence_count)
+    return GSL_EFAILED;
+
+  sobol_jk_points (state, dimension, x, n);
+
+  return GSL_SUCCESS;
+}
+
+/* The numerators after i points are the shift plus the direction
+ * numbers selected by the bits of the Gray code of i.
+ */
+static int
+sobol_jk_set_index (void *state, unsigned int dimension, unsigned long int i)
+{
+  sobol_jk_state_t *s_state = (sobol_jk_state_t *) state;
+  uint32_t *num = NUMERATOR (state);
+  const uint32_t *shift = SHIFT (state, dimension);
+  const unsigned long int g = scramble_gray (i);
+  unsigned int j;
+  int k;
+
+  if (i > 0xffffffffUL)
+    return GSL_EINVAL;
+
+  for (j = 0; j < dimension; j++)
+    {
+      num[j] = shift[j];
+    }
+
+  for (k = 0; k < SOBOL_JK_BIT_COUNT; k++)
+    {
+      if ((g >> k) & 1)
+        {
+          const uint32_t *v = DIRECTION (state, dimension, k);
+
+          for (j = 0; j < dimension; j++)
+            {
+              num[j] ^= v[j];
+            }
+        }
+    }
+
+  s_state->sequence_count = (uint32_t) i;
+
+  return GSL_SUCCESS;
+}
+
+/* Linear matrix scrambling and digital shift of each dimension,
+ * applied to the unscrambled direction numbers.
+ */
+static int
+sobol_jk_scramble (void *state, unsigned int dimension, const gsl_rng * r)
+{
+  sobol_jk_state_t *s_state = (sobol_jk_state_t *) state;
+  const unsigned long int count = s_state->sequence_count;
+  uint32_t *shift = SHIFT (state, dimension);
+  uint32_t mask[SOBOL_JK_BIT_COUNT];
+  unsigned int j;
+  int k;
+
+  int status = sobol_jk_init (state, dimension);
+
+  if (status != GSL_SUCCESS)
+    return status;
+
+  for (j = 0; j < dimension; j++)
+    {
+      scramble_matrix (r, mask, SOBOL_JK_BIT_COUNT);
+
+      for (k = 0; k < SOBOL_JK_BIT_COUNT; k++)
+        {
+          uint32_t *v = DIRECTION (state, dimension, k);
+          v[j] = scramble_apply (mask, v[j], SOBOL_JK_BIT_COUNT);
+        }
+
+      shift[j] = scramble_random_bits (r, SOBOL_JK_BIT_COUNT);
+    }
+
+  return sobol_jk_set_index (state, dimension, count);
+}
@@ -7,6 +7,7 @@
  */
 #include <config.h>
 #include <gsl/gsl_qrng.h>
+#include "scramble.h"
 
 
 /* maximum allowed space dimension */
@@ -19,6 +20,8 @@
 static size_t sobol_state_size(unsigned int dimension);
 static int sobol_init(void * state, unsigned int dimension);
 static int sobol_get(void * state, unsigned int dimension, double * v);
+static int sobol_set_index(void * state, unsigned int dimension, unsigned long int i);
+static int sobol_scramble(void * state, unsigned int dimension, const gsl_rng * r);
 
 /* global Sobol generator type object */
 static const gsl_qrng_type sobol_type = 
@@ -27,7 +30,10 @@ static const gsl_qrng_type sobol_type =
   SOBOL_MAX_DIMENSION,
   sobol_state_size,
   sobol_init,
-  sobol_get
+  sobol_get,
+  0,
+  sobol_set_index,
+  sobol_scramble
 };
 const gsl_qrng_type * gsl_qrng_sobol = &sobol_type;
 
@@ -113,12 +119,14 @@ static const int v_init[8][SOBOL_MAX_DIMENSION] =
  *   last_numerator_vec   = last generated numerator vector
  *   last_denominator_inv = 1/denominator for last numerator vector
  *   v_direction          = direction number table
+ *   shift_vec            = digital shift of a scrambled sequence
  */
 typedef struct
 {
   unsigned int  sequence_count;
   double        last_denominator_inv;
   int           last_numerator_vec[SOBOL_MAX_DIMENSION];
+  int           shift_vec[SOBOL_MAX_DIMENSION];
   int           v_direction[SOBOL_BIT_COUNT][SOBOL_MAX_DIMENSION];
 } sobol_state_t;
 
@@ -193,7 +201,10 @@ static int sobol_init(void * state, unsigned int dimension)
 
   /* final setup */
   s_state->sequence_count = 0;
-  for(i_dim=0; i_dim<dimension; i_dim++) s_state->last_numerator_vec[i_dim] = 0;
+  for(i_dim=0; i_dim<dimension; i_dim++) {
+    s_state->last_numerator_vec[i_dim] = 0;
+    s_state->shift_vec[i_dim] = 0;
+  }
 
   return GSL_SUCCESS;
 }
@@ -229,3 +240,56 @@ static int sobol_get(void * state, unsigned int dimension, double * v)
 
   return GSL_SUCCESS;
 }
+
+
+/* The numerators after i calls are the shift plus the direction
+ * numbers selected by the bits of the Gray code of i.
+ */
+static int sobol_set_index(void * state, unsigned int dimension, unsigned long int i)
+{
+  sobol_state_t * s_state = (sobol_state_t *) state;
+  const unsigned long int g = scramble_gray(i);
+  unsigned int i_dimension;
+  int k;
+
+  if(i >= (1UL << SOBOL_BIT_COUNT)) return GSL_EINVAL;
+
+  for(i_dimension=0; i_dimension<dimension; i_dimension++) {
+    int numerator = s_state->shift_vec[i_dimension];
+    for(k=0; k<SOBOL_BIT_COUNT; k++) {
+      if((g >> k) & 1) numerator ^= s_state->v_direction[k][i_dimension];
+    }
+    s_state->last_numerator_vec[i_dimension] = numerator;
+  }
+
+  s_state->sequence_count = i;
+
+  return GSL_SUCCESS;
+}
+
+
+/* Linear matrix scrambling and digital shift of each dimension,
+ * applied to the unscrambled direction numbers.
+ */
+static int sobol_scramble(void * state, unsigned int dimension, const gsl_rng * r)
+{
+  sobol_state_t * s_state = (sobol_state_t *) state;
+  const unsigned int count = s_state->sequence_count;
+  uint32_t mask[SOBOL_BIT_COUNT];
+  unsigned int i_dimension;
+  int k;
+
+  int status = sobol_init(state, dimension);
+  if(status != GSL_SUCCESS) return status;
+
+  for(i_dimension=0; i_dimension<dimension; i_dimension++) {
+    scramble_matrix(r, mask, SOBOL_BIT_COUNT);
+    for(k=0; k<SOBOL_BIT_COUNT; k++) {
+      const uint32_t v = (uint32_t) s_state->v_direction[k][i_dimension];
+      s_state->v_direction[k][i_dimension] = (int) scramble_apply(mask, v, SOBOL_BIT_COUNT);
+    }
+    s_state->shift_vec[i_dimension] = (int) scramble_random_bits(r, SOBOL_BIT_COUNT);
+  }
+
+  return sobol_set_index(state, dimension, count);
+}
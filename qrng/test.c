@@ -5,6 +5,7 @@
 #include <gsl/gsl_ieee_utils.h>
 
 #include <gsl/gsl_qrng.h>
+#include <gsl/gsl_rng.h>
 #include <gsl/gsl_test.h>
 #include <math.h>
 
@@ -51,6 +52,218 @@ void test_sobol(void)
   gsl_test (status, "Sobol d=3 (reinitialized)");
 }
 
+void test_sobol_jk(void)
+{
+  int status = 0;
+  size_t i, j;
+  double v[5], w[5];
+  double *x, *y;
+  unsigned char *seen;
+
+  /* first points of the Joe-Kuo sequence in dimension 4 */
+  gsl_qrng * g = gsl_qrng_alloc(gsl_qrng_sobol_jk, 4);
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.5 || v[1] != 0.5 || v[2] != 0.5 || v[3] != 0.5 );
+  gsl_qrng_get(g, v);
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.25 || v[1] != 0.75 || v[2] != 0.75 || v[3] != 0.75 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.375 || v[1] != 0.375 || v[2] != 0.625 || v[3] != 0.875 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.875 || v[1] != 0.875 || v[2] != 0.125 || v[3] != 0.375 );
+  gsl_qrng_free(g);
+
+  gsl_test (status, "Sobol Joe-Kuo d=4");
+
+  /* the last dimensions of the table */
+  status = 0;
+  g = gsl_qrng_alloc(gsl_qrng_sobol_jk, 21201);
+  x = (double *) malloc (21201 * sizeof (double));
+  for (i = 0; i < 31; i++)
+    gsl_qrng_get(g, x);
+  status += ( x[99] != 0.34375 || x[999] != 0.09375
+              || x[4999] != 0.59375 || x[21200] != 0.46875 );
+  for (; i < 1000; i++)
+    gsl_qrng_get(g, x);
+  status += ( x[99] != 0.1865234375 || x[999] != 0.2001953125
+              || x[4999] != 0.1416015625 || x[21200] != 0.0830078125 );
+  free (x);
+  gsl_qrng_free(g);
+
+  gsl_test (status, "Sobol Joe-Kuo d=21201");
+
+  /* bulk points match successive calls */
+  status = 0;
+  g = gsl_qrng_alloc(gsl_qrng_sobol_jk, 5);
+  x = (double *) malloc (100 * 5 * sizeof (double));
+  gsl_qrng_get(g, v);
+  status += gsl_qrng_get_array(g, x, 100);
+  gsl_qrng_get(g, v);
+  gsl_qrng_init(g);
+  gsl_qrng_get(g, w);
+  for (i = 0; i < 100; i++)
+    {
+      gsl_qrng_get(g, w);
+      for (j = 0; j < 5; j++)
+        status += ( x[i * 5 + j] != w[j] );
+    }
+  gsl_qrng_get(g, w);
+  for (j = 0; j < 5; j++)
+    status += ( v[j] != w[j] );
+  free (x);
+  gsl_qrng_free(g);
+
+  gsl_test (status, "Sobol Joe-Kuo d=5 gsl_qrng_get_array");
+
+  /* each coordinate of the first 1023 points takes the distinct
+     values k/1024, k=1..1023 */
+  status = 0;
+  g = gsl_qrng_alloc(gsl_qrng_sobol_jk, 50);
+  x = (double *) malloc (1023 * 50 * sizeof (double));
+  seen = (unsigned char *) malloc (1024);
+  gsl_qrng_get_array(g, x, 1023);
+  for (j = 0; j < 50; j++)
+    {
+      for (i = 0; i < 1024; i++)
+        seen[i] = 0;
+      for (i = 0; i < 1023; i++)
+        {
+          double k = x[i * 50 + j] * 1024;
+          status += ( k != floor(k) || k < 1 || k > 1023 || seen[(int) k] );
+          if (k >= 1 && k <= 1023)
+            seen[(int) k] = 1;
+        }
+    }
+  free (seen);
+  free (x);
+  gsl_qrng_free(g);
+
+  gsl_test (status, "Sobol Joe-Kuo d=50 stratification");
+
+  /* generators without bulk points fall back to gsl_qrng_get */
+  status = 0;
+  g = gsl_qrng_alloc(gsl_qrng_halton, 3);
+  x = (double *) malloc (10 * 3 * sizeof (double));
+  status += gsl_qrng_get_array(g, x, 10);
+  gsl_qrng_init(g);
+  for (i = 0; i < 10; i++)
+    {
+      gsl_qrng_get(g, w);
+      for (j = 0; j < 3; j++)
+        status += ( x[i * 3 + j] != w[j] );
+    }
+  free (x);
+  gsl_qrng_free(g);
+
+  gsl_test (status, "Halton d=3 gsl_qrng_get_array");
+}
+
+/* gsl_qrng_set_index gives the same points as stepping */
+void test_set_index(const gsl_qrng_type * T, unsigned int d)
+{
+  int status = 0;
+  size_t i, j;
+  double x[100 * 5], v[5];
+  gsl_qrng * g = gsl_qrng_alloc(T, d);
+  gsl_qrng * h = gsl_qrng_alloc(T, d);
+
+  for (i = 0; i < 100; i++)
+    gsl_qrng_get(g, x + i * d);
+
+  status += gsl_qrng_set_index(h, 37);
+  for (i = 37; i < 100; i++)
+    {
+      gsl_qrng_get(h, v);
+      for (j = 0; j < d; j++)
+        status += ( v[j] != x[i * d + j] );
+    }
+
+  status += gsl_qrng_set_index(h, 0);
+  gsl_qrng_get(h, v);
+  for (j = 0; j < d; j++)
+    status += ( v[j] != x[j] );
+
+  gsl_qrng_free(h);
+  gsl_qrng_free(g);
+
+  gsl_test (status, "%s d=%u gsl_qrng_set_index", T->name, d);
+}
+
+/* A scrambled sequence keeps the stratification of each coordinate
+   over the first points, b^m - 1 of them in base b, and depends on
+   the random numbers only. */
+void test_scramble(const gsl_qrng_type * T, unsigned int d, const size_t n,
+                   const unsigned int base[])
+{
+  int status = 0;
+  size_t i, j;
+  double *x = (double *) malloc (n * d * sizeof (double));
+  double *y = (double *) malloc (n * d * sizeof (double));
+  unsigned char *seen = (unsigned char *) malloc (n + 1);
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_mt19937);
+  gsl_qrng * g = gsl_qrng_alloc(T, d);
+  gsl_qrng * h = gsl_qrng_alloc(T, d);
+
+  gsl_rng_set(r, 1);
+  status += gsl_qrng_scramble(g, r);
+  for (i = 0; i < n; i++)
+    gsl_qrng_get(g, x + i * d);
+
+  for (j = 0; j < d; j++)
+    {
+      size_t m = 1;
+      while (m * base[j] <= n + 1)
+        m *= base[j];
+      for (i = 0; i <= n; i++)
+        seen[i] = 0;
+      for (i = 0; i < m - 1; i++)
+        {
+          const double u = x[i * d + j];
+          const size_t k = (size_t) (u * m);
+          status += ( u < 0 || u >= 1 || seen[k] );
+          seen[k] = 1;
+        }
+    }
+
+  /* the same random numbers give the same sequence, and the index
+     is kept */
+  gsl_qrng_get(h, y);
+  gsl_qrng_get(h, y);
+  gsl_rng_set(r, 1);
+  status += gsl_qrng_scramble(h, r);
+  gsl_qrng_get(h, y + 2 * d);
+  for (j = 0; j < d; j++)
+    status += ( y[2 * d + j] != x[2 * d + j] );
+
+  status += gsl_qrng_set_index(h, 5);
+  gsl_qrng_get(h, y);
+  for (j = 0; j < d; j++)
+    status += ( y[j] != x[5 * d + j] );
+
+  /* other random numbers give another sequence */
+  status += gsl_qrng_scramble(h, r);
+  status += gsl_qrng_set_index(h, 5);
+  gsl_qrng_get(h, y);
+  status += ( y[0] == x[5 * d] );
+
+  /* reinitializing gives the unscrambled sequence */
+  gsl_qrng_init(h);
+  gsl_qrng_init(g);
+  gsl_qrng_get(h, y);
+  gsl_qrng_get(g, x);
+  for (j = 0; j < d; j++)
+    status += ( y[j] != x[j] );
+
+  gsl_qrng_free(h);
+  gsl_qrng_free(g);
+  gsl_rng_free(r);
+  free (seen);
+  free (y);
+  free (x);
+
+  gsl_test (status, "%s d=%u gsl_qrng_scramble", T->name, d);
+}
+
 void test_halton(void)
 {
 	int status = 0;
@@ -239,9 +452,26 @@ int main()
   gsl_ieee_env_setup ();
 
   test_sobol();
+  test_sobol_jk();
 	test_halton();
 	test_reversehalton();
   test_nied2();
 
+  {
+    const unsigned int base2[5] = { 2, 2, 2, 2, 2 };
+    const unsigned int primes[5] = { 2, 3, 5, 7, 11 };
+
+    test_set_index(gsl_qrng_sobol, 5);
+    test_set_index(gsl_qrng_sobol_jk, 5);
+    test_set_index(gsl_qrng_niederreiter_2, 5);
+    test_set_index(gsl_qrng_halton, 5);
+    test_set_index(gsl_qrng_reversehalton, 5);
+
+    test_scramble(gsl_qrng_sobol, 5, 1023, base2);
+    test_scramble(gsl_qrng_sobol_jk, 5, 1023, base2);
+    test_scramble(gsl_qrng_niederreiter_2, 5, 1023, base2);
+    test_scramble(gsl_qrng_halton, 5, 1023, primes);
+  }
+
   exit (gsl_test_summary ());
 }
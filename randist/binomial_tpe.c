@@ -19,6 +19,8 @@
 
 #include <config.h>
 #include <math.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
 #include <gsl/gsl_pow_int.h>
@@ -93,31 +95,106 @@ gsl_ran_binomial_tpe (const gsl_rng * rng, double p, unsigned int n)
   return gsl_ran_binomial (rng, p, n);
 }
 
-unsigned int
-gsl_ran_binomial (const gsl_rng * rng, double p, unsigned int n)
+/* The constants of both methods depend only on p and n, and are
+   computed once by binomial_setup() for a sampler, or on each call of
+   gsl_ran_binomial(). */
+
+static void
+binomial_setup (gsl_ran_binomial_t * g, double p, unsigned int n)
 {
-  int ix;                       /* return value */
-  int flipped = 0;
-  double q, s, np;
+  double q, np;
 
-  if (n == 0)
-    return 0;
+  g->n = n;
+  g->flipped = 0;
 
   if (p > 0.5)
     {
       p = 1.0 - p;              /* work with small p */
-      flipped = 1;
+      g->flipped = 1;
     }
 
   q = 1 - p;
-  s = p / q;
   np = n * p;
 
+  g->p = p;
+  g->q = q;
+  g->s = p / q;
+  g->np = np;
+
+  if (np < SMALL_MEAN)
+    {
+      g->f0 = gsl_pow_uint (q, n);   /* f(x), starting with x=0 */
+    }
+  else
+    {
+      double ffm = np + p;      /* ffm = n*p+p             */
+      int m = (int) ffm;        /* m = int floor[n*p+p]    */
+      double fm = m;            /* fm = double m;          */
+      double xm = fm + 0.5;     /* xm = half integer mean (tip of triangle)  */
+      double npq = np * q;      /* npq = n*p*q            */
+
+      /* Compute cumulative area of tri, para, exp tails */
+
+      /* p1: radius of triangle region; since height=1, also: area of region */
+      /* p2: p1 + area of parallelogram region */
+      /* p3: p2 + area of left tail */
+      /* p4: p3 + area of right tail */
+      /* pi/p4: probability of i'th area (i=1,2,3,4) */
+
+      /* Note: magic numbers 2.195, 4.6, 0.134, 20.5, 15.3 */
+      /* These magic numbers are not adjustable...at least not easily! */
+
+      double p1 = floor (2.195 * sqrt (npq) - 4.6 * q) + 0.5;
+
+      /* xl, xr: left and right edges of triangle */
+      double xl = xm - p1;
+      double xr = xm + p1;
+
+      /* Parameter of exponential tails */
+      /* Left tail:  t(x) = c*exp(-lambda_l*[xl - (x+0.5)]) */
+      /* Right tail: t(x) = c*exp(-lambda_r*[(x+0.5) - xr]) */
+
+      double c = 0.134 + 20.5 / (15.3 + fm);
+      double p2 = p1 * (1.0 + c + c);
+
+      double al = (ffm - xl) / (ffm - xl * p);
+      double lambda_l = al * (1.0 + 0.5 * al);
+      double ar = (xr - ffm) / (xr * q);
+      double lambda_r = ar * (1.0 + 0.5 * ar);
+      double p3 = p2 + c / lambda_l;
+      double p4 = p3 + c / lambda_r;
+
+      g->m = m;
+      g->fm = fm;
+      g->xm = xm;
+      g->npq = npq;
+      g->p1 = p1;
+      g->xl = xl;
+      g->xr = xr;
+      g->c = c;
+      g->p2 = p2;
+      g->lambda_l = lambda_l;
+      g->lambda_r = lambda_r;
+      g->p3 = p3;
+      g->p4 = p4;
+    }
+}
+
+static unsigned int
+binomial_sample (const gsl_rng * rng, const gsl_ran_binomial_t * g)
+{
+  int ix;                       /* return value */
+  const unsigned int n = g->n;
+  const double p = g->p, q = g->q, s = g->s, np = g->np;
+
+  if (n == 0)
+    return 0;
+
   /* Inverse cdf logic for small mean (BINV in K+S) */
 
   if (np < SMALL_MEAN)
     {
-      double f0 = gsl_pow_uint (q, n);   /* f(x), starting with x=0 */
+      const double f0 = g->f0;
 
       while (1)
         {
@@ -168,42 +245,11 @@ gsl_ran_binomial (const gsl_rng * rng, double p, unsigned int n)
 
       int k;
 
-      double ffm = np + p;      /* ffm = n*p+p             */
-      int m = (int) ffm;        /* m = int floor[n*p+p]    */
-      double fm = m;            /* fm = double m;          */
-      double xm = fm + 0.5;     /* xm = half integer mean (tip of triangle)  */
-      double npq = np * q;      /* npq = n*p*q            */
-
-      /* Compute cumulative area of tri, para, exp tails */
-
-      /* p1: radius of triangle region; since height=1, also: area of region */
-      /* p2: p1 + area of parallelogram region */
-      /* p3: p2 + area of left tail */
-      /* p4: p3 + area of right tail */
-      /* pi/p4: probability of i'th area (i=1,2,3,4) */
-
-      /* Note: magic numbers 2.195, 4.6, 0.134, 20.5, 15.3 */
-      /* These magic numbers are not adjustable...at least not easily! */
-
-      double p1 = floor (2.195 * sqrt (npq) - 4.6 * q) + 0.5;
-
-      /* xl, xr: left and right edges of triangle */
-      double xl = xm - p1;
-      double xr = xm + p1;
-
-      /* Parameter of exponential tails */
-      /* Left tail:  t(x) = c*exp(-lambda_l*[xl - (x+0.5)]) */
-      /* Right tail: t(x) = c*exp(-lambda_r*[(x+0.5) - xr]) */
-
-      double c = 0.134 + 20.5 / (15.3 + fm);
-      double p2 = p1 * (1.0 + c + c);
-
-      double al = (ffm - xl) / (ffm - xl * p);
-      double lambda_l = al * (1.0 + 0.5 * al);
-      double ar = (xr - ffm) / (xr * q);
-      double lambda_r = ar * (1.0 + 0.5 * ar);
-      double p3 = p2 + c / lambda_l;
-      double p4 = p3 + c / lambda_r;
+      const int m = g->m;
+      const double fm = g->fm, xm = g->xm, npq = g->npq;
+      const double p1 = g->p1, xl = g->xl, xr = g->xr, c = g->c;
+      const double p2 = g->p2, p3 = g->p3, p4 = g->p4;
+      const double lambda_l = g->lambda_l, lambda_r = g->lambda_r;
 
       double var, accept;
       double u, v;              /* random variates */
@@ -377,5 +423,70 @@ gsl_ran_binomial (const gsl_rng * rng, double p, unsigned int n)
 
 Finish:
 
-  return (flipped) ? (n - ix) : (unsigned int)ix;
+  return (g->flipped) ? (n - ix) : (unsigned int)ix;
+}
+
+unsigned int
+gsl_ran_binomial (const gsl_rng * rng, double p, unsigned int n)
+{
+  gsl_ran_binomial_t g;
+
+  if (n == 0)
+    return 0;
+
+  binomial_setup (&g, p, n);
+
+  return binomial_sample (rng, &g);
+}
+
+/* Samplers for fixed p and n give the same values as
+   gsl_ran_binomial() */
+
+gsl_ran_binomial_t *
+gsl_ran_binomial_alloc (double p, unsigned int n)
+{
+  gsl_ran_binomial_t *g;
+
+  if (!(p >= 0 && p <= 1))
+    {
+      GSL_ERROR_NULL ("probability p must lie in [0,1]", GSL_EDOM);
+    }
+
+  g = (gsl_ran_binomial_t *) malloc (sizeof (gsl_ran_binomial_t));
+
+  if (g == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for binomial sampler",
+                      GSL_ENOMEM);
+    }
+
+  binomial_setup (g, p, n);
+
+  return g;
+}
+
+void
+gsl_ran_binomial_free (gsl_ran_binomial_t * g)
+{
+  RETURN_IF_NULL (g);
+  free (g);
+}
+
+unsigned int
+gsl_ran_binomial_sample (const gsl_rng * r, const gsl_ran_binomial_t * g)
+{
+  return binomial_sample (r, g);
+}
+
+void
+gsl_ran_binomial_sample_array (const gsl_rng * r,
+                               const gsl_ran_binomial_t * g, size_t n,
+                               unsigned int k[])
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      k[i] = binomial_sample (r, g);
+    }
 }
@@ -93,13 +93,16 @@
  * small, we are able to deal with it right then and there, and we
  * never have to pop more than K smalls, then the algorithm is O(K).
 
- * This implementation sets up two separate stacks, and allocates K
- * elements between them.  Since neither stack ever grows, we do an
- * extra O(K) pass through the data to determine how many smalls and
- * bigs there are to begin with and allocate appropriately.  In all
- * there are 2*K*sizeof(double) transient bytes of memory that are
- * used than returned, and K*(sizeof(int)+sizeof(double)) bytes used
- * in the lookup table.
+ * This implementation follows Vose (M. D. Vose, A linear algorithm
+ * for generating random numbers with a given distribution, IEEE Trans
+ * Software Eng 17, 972-975 (1991)): the probabilities are scaled by K
+ * in place in the table, so that the mean is one, and the two stacks
+ * share a single array of K indices, the smalls growing from the
+ * bottom and the bigs from the top.  Since an index is on at most one
+ * stack at a time they never meet.  In all there are K*sizeof(size_t)
+ * transient bytes of memory, and the lookup table holds F[k] and A[k]
+ * side by side, K*(sizeof(size_t)+sizeof(double)) bytes, so that a
+ * sample touches a single cache line of it.
    
  * Walker spoke of using two random numbers (an integer 0..K-1, and a
  * floating point u in [0,1]), but Knuth points out that one can just
@@ -152,62 +155,6 @@
                                  * in the call to gsl_ran_discrete()
                                  */
 
-/*** Begin Stack (this code is used just in this file) ***/
-
-/* Stack code converted to use unsigned indices (i.e. s->i == 0 now
-   means an empty stack, instead of -1), for consistency and to give a
-   bigger allowable range. BJG */
-
-typedef struct {
-    size_t N;                      /* max number of elts on stack */
-    size_t *v;                     /* array of values on the stack */
-    size_t i;                      /* index of top of stack */
-} gsl_stack_t;
-
-static gsl_stack_t *
-new_stack(size_t N) {
-    gsl_stack_t *s;
-    s = (gsl_stack_t *)malloc(sizeof(gsl_stack_t));
-    s->N = N;
-    s->i = 0;                  /* indicates stack is empty */
-    s->v = (size_t *)malloc(sizeof(size_t)*N);
-    return s;
-}
-
-static int
-push_stack(gsl_stack_t *s, size_t v)
-{
-    if ((s->i) >= (s->N)) {
-      return -1; /* stack overflow (shouldn't happen) */
-    }
-    (s->v)[s->i] = v;
-    s->i += 1;
-    return 0;
-}
-
-static size_t pop_stack(gsl_stack_t *s)
-{
-    if ((s->i) == 0) {
-      GSL_ERROR ("internal error - stack exhausted", GSL_ESANITY);
-    }
-    s->i -= 1;
-    return ((s->v)[s->i]);
-}
-
-static inline size_t size_stack(const gsl_stack_t *s)
-{
-    return s->i;
-}
-
-static void free_stack(gsl_stack_t *s)
-{
-    free((char *)(s->v));
-    free((char *)s);
-}
-
-/*** End Stack ***/
-
-
 /*** Begin Walker's Algorithm ***/
 
 gsl_ran_discrete_t *
@@ -215,11 +162,11 @@ gsl_ran_discrete_preproc(size_t Kevents, const double *ProbArray)
 {
     size_t k,b,s;
     gsl_ran_discrete_t *g;
-    size_t nBigs, nSmalls;
-    gsl_stack_t *Bigs;
-    gsl_stack_t *Smalls;
-    double *E;
-    double pTotal = 0.0, mean, d;
+    gsl_ran_discrete_entry_t *T;
+    size_t *stack;
+    size_t nSmalls, top;        /* smalls in stack[0..nSmalls-1], bigs
+                                   in stack[top..Kevents-1] */
+    double pTotal = 0.0, scale;
     
     if (Kevents < 1) {
       /* Could probably treat Kevents=1 as a special case */
@@ -242,86 +189,74 @@ gsl_ran_discrete_preproc(size_t Kevents, const double *ProbArray)
 
     /* Begin setting up the main "object" (just a struct, no steroids) */
     g = (gsl_ran_discrete_t *)malloc(sizeof(gsl_ran_discrete_t));
+
+    if (g==NULL) {
+      GSL_ERROR_VAL ("Cannot allocate memory for randevent", GSL_ENOMEM, 0);
+    }
+
     g->K = Kevents;
-    g->F = (double *)malloc(sizeof(double)*Kevents);
-    g->A = (size_t *)malloc(sizeof(size_t)*Kevents);
+    g->T = (gsl_ran_discrete_entry_t *)
+      malloc(sizeof(gsl_ran_discrete_entry_t)*Kevents);
 
-    E = (double *)malloc(sizeof(double)*Kevents);
+    stack = (size_t *)malloc(sizeof(size_t)*Kevents);
 
-    if (E==NULL) {
+    if (g->T==NULL || stack==NULL) {
+      free(g->T);
+      free(stack);
+      free(g);
       GSL_ERROR_VAL ("Cannot allocate memory for randevent", GSL_ENOMEM, 0);
     }
 
-    for (k=0; k<Kevents; ++k) {
-        E[k] = ProbArray[k]/pTotal;
-    }
+    T = g->T;
 
-    /* Now create the Bigs and the Smalls */
-    mean = 1.0/Kevents;
-    nSmalls=nBigs=0;
-    {
-      /* Temporarily use which[k] = g->A[k] to indicate small or large */
-      size_t * const which = g->A;
-
-      for (k=0; k<Kevents; ++k) {
-        if (E[k] < mean) { 
-          ++nSmalls; which[k] = 0;
-        } else { 
-          ++nBigs; which[k] = 1; 
+    /* Scale the probabilities to a mean of one, and create the Bigs
+       and the Smalls */
+    scale = Kevents/pTotal;
+    nSmalls = 0;
+    top = Kevents;
+
+    for (k=0; k<Kevents; ++k) {
+        T[k].F = ProbArray[k]*scale;
+        if (T[k].F < 1.0) {
+            stack[nSmalls++] = k;
+        } else {
+            stack[--top] = k;
         }
-      }
-
-      Bigs   = new_stack(nBigs);
-      Smalls = new_stack(nSmalls);
-      for (k=0; k<Kevents; ++k) {
-        gsl_stack_t * Dest = which[k] ? Bigs : Smalls;
-        int status = push_stack(Dest,k);
-        if (status)
-          GSL_ERROR_VAL ("failed to build stacks", GSL_EFAILED, 0);
-      }
     }
 
-    /* Now work through the smalls */
-    while (size_stack(Smalls) > 0) {
-        s = pop_stack(Smalls);
-        if (size_stack(Bigs) == 0) {
-            (g->A)[s]=s;
-            (g->F)[s]=1.0;
+    /* Now work through the smalls.  The next big is at the top of its
+       stack, stack[top] */
+    while (nSmalls > 0) {
+        s = stack[--nSmalls];
+        if (top == Kevents) {
+            T[s].A = s;
+            T[s].F = 1.0;
             continue;
         }
-        b = pop_stack(Bigs);
-        (g->A)[s]=b;
-        (g->F)[s]=Kevents*E[s];
+        b = stack[top++];
+        T[s].A = b;
 #if DEBUG
-        fprintf(stderr,"s=%2d, A=%2d, F=%.4f\n",s,(g->A)[s],(g->F)[s]);
+        fprintf(stderr,"s=%2d, A=%2d, F=%.4f\n",s,T[s].A,T[s].F);
 #endif        
-        d = mean - E[s];
-        E[s] += d;              /* now E[s] == mean */
-        E[b] -= d;
-        if (E[b] < mean) {
-            push_stack(Smalls,b); /* no longer big, join ranks of the small */
+        T[b].F -= 1.0 - T[s].F;  /* T[s] borrows from T[b] up to the mean */
+        if (T[b].F < 1.0) {
+            stack[nSmalls++] = b; /* no longer big, join ranks of the small */
         }
-        else if (E[b] > mean) {
-            push_stack(Bigs,b); /* still big, put it back where you found it */
+        else if (T[b].F > 1.0) {
+            stack[--top] = b; /* still big, put it back where you found it */
         }
         else {
-            /* E[b]==mean implies it is finished too */
-            (g->A)[b]=b;
-            (g->F)[b]=1.0;
+            /* T[b].F==1 implies it is finished too */
+            T[b].A = b;
         }
     }
-    while (size_stack(Bigs) > 0) {
-        b = pop_stack(Bigs);
-        (g->A)[b]=b;
-        (g->F)[b]=1.0;
+    while (top < Kevents) {
+        b = stack[top++];
+        T[b].A = b;
+        T[b].F = 1.0;
     }
     /* Stacks have been emptied, and A and F have been filled */
 
-    if ( size_stack(Smalls) != 0) {
-      GSL_ERROR_VAL ("Smalls stack has not been emptied",
-                     GSL_ESANITY, 0 );
-    }
-    
 #if 0
     /* if 1, then artificially set all F[k]'s to unity.  This will
      * give wrong answers, but you'll get them faster.  But, not
@@ -329,7 +264,7 @@ gsl_ran_discrete_preproc(size_t Kevents, const double *ProbArray)
      * on what the optimal preprocessing would give.
      */
     for (k=0; k<Kevents; ++k) {
-        (g->F)[k] = 1.0;
+        T[k].F = 1.0;
     }
 #endif
 
@@ -339,14 +274,12 @@ gsl_ran_discrete_preproc(size_t Kevents, const double *ProbArray)
      * it doesn't actually make much difference.
      */
     for (k=0; k<Kevents; ++k) {
-        (g->F)[k] += k;
-        (g->F)[k] /= Kevents;
+        T[k].F += k;
+        T[k].F /= Kevents;
     }
 #endif    
 
-    free_stack(Bigs);
-    free_stack(Smalls);
-    free((char *)E);
+    free((char *)stack);
 
     return g;
 }
@@ -364,7 +297,7 @@ gsl_ran_discrete(const gsl_rng *r, const gsl_ran_discrete_t *g)
     c = u;
     u -= c;
 #endif
-    f = (g->F)[c];
+    f = (g->T)[c].F;
     /* fprintf(stderr,"c,f,u: %d %.4f %f\n",c,f,u); */
     if (f == 1.0) return c;
 
@@ -372,15 +305,50 @@ gsl_ran_discrete(const gsl_rng *r, const gsl_ran_discrete_t *g)
         return c;
     }
     else {
-        return (g->A)[c];
+        return (g->T)[c].A;
+    }
+}
+
+/* The array version takes the uniforms in bulk from the generator and
+   gives the same values as n calls of gsl_ran_discrete(), since u < 1
+   always passes the test u < f for f == 1 */
+
+#define DISCRETE_BLOCK 256
+
+void
+gsl_ran_discrete_array(const gsl_rng *r, const gsl_ran_discrete_t *g,
+                       size_t n, size_t k[])
+{
+    const gsl_ran_discrete_entry_t * const T = g->T;
+    const size_t K = g->K;
+    double u[DISCRETE_BLOCK];
+    size_t i;
+
+    while (n > 0) {
+        const size_t nb = (n < DISCRETE_BLOCK) ? n : DISCRETE_BLOCK;
+
+        gsl_rng_uniform_array(r, u, nb);
+
+        for (i=0; i<nb; ++i) {
+#if KNUTH_CONVENTION
+            const size_t c = (u[i]*K);
+            const double v = u[i];
+#else
+            const size_t c = (u[i]*K);
+            const double v = u[i]*K - c;
+#endif
+            k[i] = (v < T[c].F) ? c : T[c].A;
+        }
+
+        k += nb;
+        n -= nb;
     }
 }
 
 void gsl_ran_discrete_free(gsl_ran_discrete_t *g)
 {
     RETURN_IF_NULL (g);
-    free((char *)(g->A));
-    free((char *)(g->F));
+    free((char *)(g->T));
     free((char *)g);
 }
 
@@ -392,13 +360,13 @@ gsl_ran_discrete_pdf(size_t k, const gsl_ran_discrete_t *g)
     K= g->K;
     if (k>K) return 0;
     for (i=0; i<K; ++i) {
-        f = (g->F)[i];
+        f = (g->T)[i].F;
 #if KNUTH_CONVENTION
         f = K*f-i;
 #endif        
         if (i==k) {
             p += f;
-        } else if (k == (g->A)[i]) {
+        } else if (k == (g->T)[i].A) {
             p += 1.0 - f;
         }
     }
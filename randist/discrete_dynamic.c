@@ -0,0 +1,311 @@
+/* randist/discrete_dynamic.c
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Discrete random events with weights which change between samples.
+
+   The Walker tables of gsl_ran_discrete_preproc() cost O(K) to build
+   and cannot be changed.  Here the weights are kept in a Fenwick
+   (binary indexed) tree, in which node i holds the sum of the weights
+   of the events i - lowbit(i) .. i - 1, where lowbit(i) is the lowest
+   set bit of i.  Changing a weight adds the difference to the
+   O(log K) nodes above it, and a sample descends from the top power
+   of two to the event whose partial sums bracket u W, for a uniform u
+   and total weight W, in O(log K) steps.
+
+   From: P. M. Fenwick, A new data structure for cumulative frequency
+   tables, Software: Practice and Experience 24, 327-336 (1994).
+
+   The differences accumulate rounding errors in the nodes, of the
+   order of the machine precision times the weights in each update.
+   An event of weight zero could then be picked with a probability of
+   that order, and such picks are rejected and the sample repeated.
+   The total is read from the tree after each update, and is zero when
+   no weight is positive.  After DYNAMIC_MAX_REJECT rejections, which
+   only happen when the errors are comparable to the weights, the
+   sample is drawn by a linear search of the weights themselves. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+
+#define LOWBIT(i) ((i) & (~(i) + 1))
+
+#define DYNAMIC_MAX_REJECT 64
+
+/* the total weight, as the sum of the tree nodes covering 1..K */
+
+static void
+discrete_dynamic_total (gsl_ran_discrete_dynamic_t * g)
+{
+  double total = 0;
+  size_t i;
+
+  if (g->npos == 0)
+    {
+      g->total = 0;
+      return;
+    }
+
+  for (i = g->K; i > 0; i -= LOWBIT (i))
+    {
+      total += g->tree[i];
+    }
+
+  g->total = (total > 0) ? total : 0;
+}
+
+/* a sample from the weights by a linear search, with no rounding
+   errors but the final product */
+
+static size_t
+discrete_dynamic_linear (const gsl_rng * r,
+                         const gsl_ran_discrete_dynamic_t * g)
+{
+  const size_t K = g->K;
+  double sum = 0, u;
+  size_t k, last = 0;
+
+  for (k = 0; k < K; k++)
+    {
+      sum += g->w[k];
+    }
+
+  u = gsl_rng_uniform (r) * sum;
+
+  for (k = 0; k < K; k++)
+    {
+      if (g->w[k] > 0)
+        {
+          if (u < g->w[k])
+            return k;
+
+          u -= g->w[k];
+          last = k;
+        }
+    }
+
+  return last;
+}
+
+gsl_ran_discrete_dynamic_t *
+gsl_ran_discrete_dynamic_alloc (size_t K, const double w[])
+{
+  gsl_ran_discrete_dynamic_t *g;
+  size_t i;
+
+  if (K < 1)
+    {
+      GSL_ERROR_NULL ("number of events must be a positive integer",
+                      GSL_EINVAL);
+    }
+
+  if (w != 0)
+    {
+      for (i = 0; i < K; i++)
+        {
+          if (!(w[i] >= 0))
+            {
+              GSL_ERROR_NULL ("weights must be non-negative", GSL_EINVAL);
+            }
+        }
+    }
+
+  g = (gsl_ran_discrete_dynamic_t *) malloc (sizeof (gsl_ran_discrete_dynamic_t));
+
+  if (g == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for dynamic discrete struct",
+                      GSL_ENOMEM);
+    }
+
+  g->w = (double *) malloc (K * sizeof (double));
+  g->tree = (double *) malloc ((K + 1) * sizeof (double));
+
+  if (g->w == 0 || g->tree == 0)
+    {
+      free (g->w);
+      free (g->tree);
+      free (g);
+      GSL_ERROR_NULL ("failed to allocate space for weights", GSL_ENOMEM);
+    }
+
+  g->K = K;
+
+  for (g->top = 1; g->top <= K / 2; g->top *= 2)
+    ;
+
+  gsl_ran_discrete_dynamic_set_all (g, w);
+
+  return g;
+}
+
+void
+gsl_ran_discrete_dynamic_free (gsl_ran_discrete_dynamic_t * g)
+{
+  RETURN_IF_NULL (g);
+  free (g->w);
+  free (g->tree);
+  free (g);
+}
+
+/* Rebuild the tree from all the weights (zero if w is null) in O(K),
+   which also clears the rounding errors of earlier updates */
+
+int
+gsl_ran_discrete_dynamic_set_all (gsl_ran_discrete_dynamic_t * g,
+                                  const double w[])
+{
+  const size_t K = g->K;
+  double *const tree = g->tree;
+  size_t i;
+
+  if (w != 0)
+    {
+      for (i = 0; i < K; i++)
+        {
+          if (!(w[i] >= 0))
+            {
+              GSL_ERROR ("weights must be non-negative", GSL_EINVAL);
+            }
+        }
+    }
+
+  tree[0] = 0;
+
+  for (i = 1; i <= K; i++)
+    {
+      g->w[i - 1] = (w != 0) ? w[i - 1] : 0.0;
+      tree[i] = g->w[i - 1];
+    }
+
+  for (i = 1; i <= K; i++)
+    {
+      const size_t j = i + LOWBIT (i);
+
+      if (j <= K)
+        tree[j] += tree[i];
+    }
+
+  g->npos = 0;
+
+  for (i = 0; i < K; i++)
+    {
+      if (g->w[i] > 0)
+        g->npos++;
+    }
+
+  discrete_dynamic_total (g);
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_ran_discrete_dynamic_set (gsl_ran_discrete_dynamic_t * g, size_t k,
+                              double w)
+{
+  double d;
+  size_t i;
+
+  if (k >= g->K)
+    {
+      GSL_ERROR ("index k is out of range", GSL_EINVAL);
+    }
+
+  if (!(w >= 0))
+    {
+      GSL_ERROR ("weight must be non-negative", GSL_EINVAL);
+    }
+
+  if (g->w[k] > 0)
+    g->npos--;
+
+  if (w > 0)
+    g->npos++;
+
+  d = w - g->w[k];
+  g->w[k] = w;
+
+  for (i = k + 1; i <= g->K; i += LOWBIT (i))
+    {
+      g->tree[i] += d;
+    }
+
+  discrete_dynamic_total (g);
+
+  return GSL_SUCCESS;
+}
+
+double
+gsl_ran_discrete_dynamic_get (const gsl_ran_discrete_dynamic_t * g, size_t k)
+{
+  if (k >= g->K)
+    {
+      GSL_ERROR_VAL ("index k is out of range", GSL_EINVAL, 0);
+    }
+
+  return g->w[k];
+}
+
+size_t
+gsl_ran_discrete_dynamic (const gsl_rng * r,
+                          const gsl_ran_discrete_dynamic_t * g)
+{
+  const size_t K = g->K;
+  const double *const tree = g->tree;
+
+  int n;
+
+  if (g->npos == 0)
+    {
+      GSL_ERROR_VAL ("total weight must be positive", GSL_EDOM, 0);
+    }
+
+  for (n = 0; n < DYNAMIC_MAX_REJECT && g->total > 0; n++)
+    {
+      double u = gsl_rng_uniform (r) * g->total;
+      size_t pos = 0, step;
+
+      /* find the event pos with partial sums W_pos <= u < W_(pos+1) */
+
+      for (step = g->top; step > 0; step /= 2)
+        {
+          const size_t next = pos + step;
+
+          if (next <= K && tree[next] <= u)
+            {
+              pos = next;
+              u -= tree[next];
+            }
+        }
+
+      if (pos < K && g->w[pos] > 0)
+        return pos;
+    }
+
+  return discrete_dynamic_linear (r, g);
+}
+
+double
+gsl_ran_discrete_dynamic_pdf (size_t k, const gsl_ran_discrete_dynamic_t * g)
+{
+  if (k >= g->K || g->npos == 0 || !(g->total > 0))
+    return 0;
+
+  return g->w[k] / g->total;
+}
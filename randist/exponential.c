@@ -37,6 +37,23 @@ gsl_ran_exponential (const gsl_rng * r, const double mu)
   return -mu * log1p (-u);
 }
 
+/* The array version takes the uniforms in bulk from the generator, and
+   gives the same values as n calls of gsl_ran_exponential() */
+
+void
+gsl_ran_exponential_array (const gsl_rng * r, const double mu, size_t n,
+                           double x[])
+{
+  size_t i;
+
+  gsl_rng_uniform_array (r, x, n);
+
+  for (i = 0; i < n; i++)
+    {
+      x[i] = -mu * log1p (-x[i]);
+    }
+}
+
 double
 gsl_ran_exponential_pdf (const double x, const double mu)
 {
@@ -19,10 +19,13 @@
 
 #include <config.h>
 #include <math.h>
+#include <stdlib.h>
 #include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_sf_gamma.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
+#include "vectorize.h"
 
 static double gamma_large (const gsl_rng * r, const double a);
 static double gamma_frac (const gsl_rng * r, const double a);
@@ -189,6 +192,37 @@ gsl_ran_gamma_mt (const gsl_rng * r, const double a, const double b)
   return gsl_ran_gamma (r, a, b);
 }
 
+/* The loop of the Marsaglia-Tsang method for a >= 1, with d = a - 1/3
+   and c = 1/(3 sqrt(d)), returning v such that d v is a variate of
+   order a and scale one */
+
+static inline double
+gamma_mt_loop (const gsl_rng * r, const double d, const double c)
+{
+  double x, v, u;
+
+  while (1)
+    {
+      do
+        {
+          x = gsl_ran_gaussian_ziggurat (r, 1.0);
+          v = 1.0 + c * x;
+        }
+      while (v <= 0);
+
+      v = v * v * v;
+      u = gsl_rng_uniform_pos (r);
+
+      if (u < 1 - 0.0331 * x * x * x * x) 
+        break;
+
+      if (log (u) < 0.5 * x * x + d * (1 - v + log (v)))
+        break;
+    }
+
+  return v;
+}
+
 double
 gsl_ran_gamma (const gsl_rng * r, const double a, const double b)
 {
@@ -201,29 +235,151 @@ gsl_ran_gamma (const gsl_rng * r, const double a, const double b)
     }
 
   {
-    double x, v, u;
     double d = a - 1.0 / 3.0;
     double c = (1.0 / 3.0) / sqrt (d);
+    double v = gamma_mt_loop (r, d, c);
+    
+    return b * d * v;
+  }
+}
 
-    while (1)
-      {
-        do
-          {
-            x = gsl_ran_gaussian_ziggurat (r, 1.0);
-            v = 1.0 + c * x;
-          }
-        while (v <= 0);
+/* Samplers for a fixed order and scale keep the constants of the
+   Marsaglia-Tsang method.  gsl_ran_gamma_sample() gives the same
+   values as gsl_ran_gamma(). */
 
-        v = v * v * v;
-        u = gsl_rng_uniform_pos (r);
+gsl_ran_gamma_t *
+gsl_ran_gamma_alloc (const double a, const double b)
+{
+  gsl_ran_gamma_t *g;
+  double am;
 
-        if (u < 1 - 0.0331 * x * x * x * x) 
-          break;
+  if (!(a > 0))
+    {
+      GSL_ERROR_NULL ("order a must be positive", GSL_EDOM);
+    }
 
-        if (log (u) < 0.5 * x * x + d * (1 - v + log (v)))
-          break;
-      }
-    
-    return b * d * v;
-  }
+  g = (gsl_ran_gamma_t *) malloc (sizeof (gsl_ran_gamma_t));
+
+  if (g == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for gamma sampler",
+                      GSL_ENOMEM);
+    }
+
+  am = (a < 1) ? 1.0 + a : a;
+
+  g->a = a;
+  g->b = b;
+  g->d = am - 1.0 / 3.0;
+  g->c = (1.0 / 3.0) / sqrt (g->d);
+  g->ainv = (a < 1) ? 1.0 / a : 1.0;
+
+  return g;
+}
+
+void
+gsl_ran_gamma_free (gsl_ran_gamma_t * g)
+{
+  RETURN_IF_NULL (g);
+  free (g);
+}
+
+double
+gsl_ran_gamma_sample (const gsl_rng * r, const gsl_ran_gamma_t * g)
+{
+  if (g->a < 1)
+    {
+      double u = gsl_rng_uniform_pos (r);
+      return g->b * g->d * gamma_mt_loop (r, g->d, g->c) * pow (u, g->ainv);
+    }
+
+  return g->b * g->d * gamma_mt_loop (r, g->d, g->c);
+}
+
+/* The array version takes Gaussian variates and uniforms for a block of
+   candidates at once and applies the squeeze test to all of them in
+   one loop.  The few candidates which fail it get the logarithmic
+   test afterwards, and a rejected candidate is replaced by a variate
+   from the single-value loop.  The variates have the same
+   distribution as those of gsl_ran_gamma_sample() but are not the
+   same values. */
+
+#define GAMMA_BLOCK 256
+
+static size_t gamma_block (const double z[], const double u[], const double d,
+                           const double c, const double bd, double x[],
+                           size_t slow[], size_t n) GSL_VECTORIZE;
+
+static size_t
+gamma_block (const double z[], const double u[], const double d,
+             const double c, const double bd, double x[], size_t slow[],
+             size_t n)
+{
+  unsigned char out[GAMMA_BLOCK];
+  size_t l, m = 0;
+
+  for (l = 0; l < n; l++)
+    {
+      const double v = 1.0 + c * z[l];
+      const double z2 = z[l] * z[l];
+
+      x[l] = bd * (v * v * v);
+      out[l] = !(v > 0 && u[l] < 1 - 0.0331 * z2 * z2);
+    }
+
+  for (l = 0; l < n; l++)
+    {
+      slow[m] = l;
+      m += out[l];
+    }
+
+  return m;
+}
+
+void
+gsl_ran_gamma_sample_array (const gsl_rng * r, const gsl_ran_gamma_t * g,
+                            size_t n, double x[])
+{
+  const double d = g->d, c = g->c, bd = g->b * g->d;
+  double z[GAMMA_BLOCK], u[GAMMA_BLOCK];
+  size_t slow[GAMMA_BLOCK];
+
+  while (n > 0)
+    {
+      const size_t nb = (n < GAMMA_BLOCK) ? n : GAMMA_BLOCK;
+      size_t m, q, l;
+
+      gsl_ran_gaussian_ziggurat_array (r, 1.0, nb, z);
+      gsl_rng_uniform_array (r, u, nb);
+
+      m = gamma_block (z, u, d, c, bd, x, slow, nb);
+
+      for (q = 0; q < m; q++)
+        {
+          const size_t i = slow[q];
+          const double v = 1.0 + c * z[i];
+          const double v3 = v * v * v;
+
+          if (v > 0 && u[i] > 0
+              && log (u[i]) < 0.5 * z[i] * z[i] + d * (1 - v3 + log (v3)))
+            {
+              x[i] = bd * v3;
+            }
+          else
+            {
+              x[i] = bd * gamma_mt_loop (r, d, c);
+            }
+        }
+
+      if (g->a < 1)
+        {
+          for (l = 0; l < nb; l++)
+            {
+              x[l] *= pow (gsl_rng_uniform_pos (r), g->ainv);
+            }
+        }
+
+      x += nb;
+      n -= nb;
+    }
 }
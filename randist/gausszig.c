@@ -49,6 +49,7 @@
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
+#include "vectorize.h"
 
 /* position of right-most step */
 #define PARAM_R 3.44428647676
@@ -163,12 +164,43 @@ static const double wtab[128] = {
 };
 
 
+/* The slow test for a point x = j * wtab[i] of level i outside the
+   rectangle of the level: against the density in the wedge above it
+   for i < 127, or by a new point from the exponential tail beyond
+   PARAM_R for the base strip, in which case x is replaced.  Returns
+   nonzero if x is accepted. */
+
+static int
+ziggurat_wedge (const gsl_rng * r, const unsigned long int i, double *x)
+{
+  double y;
+
+  if (i < 127)
+    {
+      double y0, y1, U1;
+      y0 = ytab[i];
+      y1 = ytab[i + 1];
+      U1 = gsl_rng_uniform (r);
+      y = y1 + (y0 - y1) * U1;
+    }
+  else
+    {
+      double U1, U2;
+      U1 = 1.0 - gsl_rng_uniform (r);
+      U2 = gsl_rng_uniform (r);
+      *x = PARAM_R - log (U1) / PARAM_R;
+      y = exp (-PARAM_R * (*x - 0.5 * PARAM_R)) * U2;
+    }
+
+  return (y < exp (-0.5 * (*x) * (*x)));
+}
+
 double
 gsl_ran_gaussian_ziggurat (const gsl_rng * r, const double sigma)
 {
   unsigned long int i, j;
   int sign;
-  double x, y;
+  double x;
 
   const unsigned long int range = r->type->max - r->type->min;
   const unsigned long int offset = r->type->min;
@@ -202,26 +234,108 @@ gsl_ran_gaussian_ziggurat (const gsl_rng * r, const double sigma)
       if (j < ktab[i])
         break;
 
-      if (i < 127)
+      if (ziggurat_wedge (r, i, &x))
+        break;
+    }
+
+  return sign * sigma * x;
+}
+
+/* The bulk version takes a block of 32-bit words from the generator
+   at once and runs the fast test of all of them in one loop without
+   branches, which vectorizes where the compiler uses gathers for the
+   table lookups.  The points outside their rectangle (about 3% of
+   them) are collected and go through the slow test afterwards, a
+   rejected point being replaced by a variate from
+   gsl_ran_gaussian_ziggurat().  The variates have the same
+   distribution but are not the same as n calls of
+   gsl_ran_gaussian_ziggurat(), since the uniforms of the slow tests
+   are taken after the whole block. */
+
+#define ZIGGURAT_BLOCK 256
+
+static size_t ziggurat_block (const unsigned long int k[],
+                              const unsigned long int offset,
+                              const double sigma, double x[],
+                              size_t slow[], size_t n) GSL_VECTORIZE;
+
+static size_t
+ziggurat_block (const unsigned long int k[], const unsigned long int offset,
+                const double sigma, double x[], size_t slow[], size_t n)
+{
+  unsigned char out[ZIGGURAT_BLOCK];
+  size_t l, m = 0;
+
+  for (l = 0; l < n; l++)
+    {
+      const unsigned long int kl = k[l] - offset;
+      const int i = (int) (kl & 0x7f);
+      const int j = (int) ((kl >> 8) & 0xFFFFFF);
+      const int sign = (int) ((kl >> 6) & 2) - 1;
+
+      x[l] = sign * sigma * (j * wtab[i]);
+      out[l] = ((unsigned long int) j >= ktab[i]);
+    }
+
+  for (l = 0; l < n; l++)
+    {
+      slow[m] = l;
+      m += out[l];
+    }
+
+  return m;
+}
+
+void
+gsl_ran_gaussian_ziggurat_array (const gsl_rng * r, const double sigma,
+                                 size_t n, double x[])
+{
+  const unsigned long int range = r->type->max - r->type->min;
+  const unsigned long int offset = r->type->min;
+  unsigned long int k[ZIGGURAT_BLOCK];
+  size_t slow[ZIGGURAT_BLOCK];
+  size_t l;
+
+  if (range < 0xFFFFFFFF)
+    {
+      /* fewer than 32 bits per call, as in gsl_ran_gaussian_ziggurat() */
+
+      for (l = 0; l < n; l++)
         {
-          double y0, y1, U1;
-          y0 = ytab[i];
-          y1 = ytab[i + 1];
-          U1 = gsl_rng_uniform (r);
-          y = y1 + (y0 - y1) * U1;
+          x[l] = gsl_ran_gaussian_ziggurat (r, sigma);
         }
-      else
+
+      return;
+    }
+
+  while (n > 0)
+    {
+      const size_t b = (n < ZIGGURAT_BLOCK) ? n : ZIGGURAT_BLOCK;
+      size_t m, q;
+
+      gsl_rng_get_array (r, k, b);
+
+      m = ziggurat_block (k, offset, sigma, x, slow, b);
+
+      for (q = 0; q < m; q++)
         {
-          double U1, U2;
-          U1 = 1.0 - gsl_rng_uniform (r);
-          U2 = gsl_rng_uniform (r);
-          x = PARAM_R - log (U1) / PARAM_R;
-          y = exp (-PARAM_R * (x - 0.5 * PARAM_R)) * U2;
+          const unsigned long int kl = k[slow[q]] - offset;
+          const unsigned long int i = kl & 0x7f;
+          const unsigned long int j = (kl >> 8) & 0xFFFFFF;
+          const int sign = (kl & 0x80) ? +1 : -1;
+          double y = j * wtab[i];
+
+          if (ziggurat_wedge (r, i, &y))
+            {
+              x[slow[q]] = sign * sigma * y;
+            }
+          else
+            {
+              x[slow[q]] = gsl_ran_gaussian_ziggurat (r, sigma);
+            }
         }
 
-      if (y < exp (-0.5 * x * x))
-        break;
+      x += b;
+      n -= b;
     }
-
-  return sign * sigma * x;
 }
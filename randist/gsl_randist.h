@@ -44,8 +44,23 @@ unsigned int gsl_ran_binomial_knuth (const gsl_rng * r, double p, unsigned int n
 unsigned int gsl_ran_binomial_tpe (const gsl_rng * r, double p, unsigned int n);
 double gsl_ran_binomial_pdf (const unsigned int k, const double p, const unsigned int n);
 
+typedef struct {                /* binomial sampler for fixed p, n */
+    unsigned int n;
+    int flipped;                /* p > 0.5, sampling n - k */
+    double p, q, s, np;
+    double f0;                  /* inverse cdf for np < 14 */
+    int m;                      /* BTPE otherwise */
+    double fm, xm, npq, p1, xl, xr, c, p2, lambda_l, lambda_r, p3, p4;
+} gsl_ran_binomial_t;
+
+gsl_ran_binomial_t * gsl_ran_binomial_alloc (double p, unsigned int n);
+void gsl_ran_binomial_free (gsl_ran_binomial_t * g);
+unsigned int gsl_ran_binomial_sample (const gsl_rng * r, const gsl_ran_binomial_t * g);
+void gsl_ran_binomial_sample_array (const gsl_rng * r, const gsl_ran_binomial_t * g, size_t n, unsigned int k[]);
+
 double gsl_ran_exponential (const gsl_rng * r, const double mu);
 double gsl_ran_exponential_pdf (const double x, const double mu);
+void gsl_ran_exponential_array (const gsl_rng * r, const double mu, size_t n, double x[]);
 
 double gsl_ran_exppow (const gsl_rng * r, const double a, const double b);
 double gsl_ran_exppow_pdf (const double x, const double a, const double b);
@@ -73,11 +88,23 @@ double gsl_ran_gamma (const gsl_rng * r, const double a, const double b);
 double gsl_ran_gamma_int (const gsl_rng * r, const unsigned int a);
 double gsl_ran_gamma_pdf (const double x, const double a, const double b);
 double gsl_ran_gamma_mt (const gsl_rng * r, const double a, const double b);
+
+typedef struct {                /* gamma sampler for fixed a, b */
+    double a, b;
+    double d, c;                /* Marsaglia-Tsang constants for max(a, 1 + a) */
+    double ainv;                /* 1/a, for a < 1 */
+} gsl_ran_gamma_t;
+
+gsl_ran_gamma_t * gsl_ran_gamma_alloc (const double a, const double b);
+void gsl_ran_gamma_free (gsl_ran_gamma_t * g);
+double gsl_ran_gamma_sample (const gsl_rng * r, const gsl_ran_gamma_t * g);
+void gsl_ran_gamma_sample_array (const gsl_rng * r, const gsl_ran_gamma_t * g, size_t n, double x[]);
 double gsl_ran_gamma_knuth (const gsl_rng * r, const double a, const double b);
 
 double gsl_ran_gaussian (const gsl_rng * r, const double sigma);
 double gsl_ran_gaussian_ratio_method (const gsl_rng * r, const double sigma);
 double gsl_ran_gaussian_ziggurat (const gsl_rng * r, const double sigma);
+void gsl_ran_gaussian_ziggurat_array (const gsl_rng * r, const double sigma, size_t n, double x[]);
 double gsl_ran_gaussian_pdf (const double x, const double sigma);
 
 double gsl_ran_ugaussian (const gsl_rng * r);
@@ -140,6 +167,17 @@ void gsl_ran_poisson_array (const gsl_rng * r, size_t n, unsigned int array[],
                             double mu);
 double gsl_ran_poisson_pdf (const unsigned int k, const double mu);
 
+typedef struct {                /* Poisson sampler for fixed mu */
+    double mu;
+    double emu;                 /* exp(-mu), for mu <= 10 */
+    double lmu, a, b, lalpha, vr;  /* transformed rejection otherwise */
+} gsl_ran_poisson_t;
+
+gsl_ran_poisson_t * gsl_ran_poisson_alloc (const double mu);
+void gsl_ran_poisson_free (gsl_ran_poisson_t * g);
+unsigned int gsl_ran_poisson_sample (const gsl_rng * r, const gsl_ran_poisson_t * g);
+void gsl_ran_poisson_sample_array (const gsl_rng * r, const gsl_ran_poisson_t * g, size_t n, unsigned int k[]);
+
 double gsl_ran_rayleigh (const gsl_rng * r, const double sigma);
 double gsl_ran_rayleigh_pdf (const double x, const double sigma);
 
@@ -168,17 +206,39 @@ int gsl_ran_choose (const gsl_rng * r, void * dest, size_t k, void * src, size_t
 void gsl_ran_sample (const gsl_rng * r, void * dest, size_t k, void * src, size_t n, size_t size) ;
 
 
+typedef struct {                /* entry k of the Walker table */
+    double F;                   /* (k + probability of k) / K */
+    size_t A;                   /* alias of k */
+} gsl_ran_discrete_entry_t;
+
 typedef struct {                /* struct for Walker algorithm */
     size_t K;
-    size_t *A;
-    double *F;
+    gsl_ran_discrete_entry_t *T;
 } gsl_ran_discrete_t;
 
 gsl_ran_discrete_t * gsl_ran_discrete_preproc (size_t K, const double *P);
 void gsl_ran_discrete_free(gsl_ran_discrete_t *g);
 size_t gsl_ran_discrete (const gsl_rng *r, const gsl_ran_discrete_t *g);
+void gsl_ran_discrete_array (const gsl_rng *r, const gsl_ran_discrete_t *g, size_t n, size_t k[]);
 double gsl_ran_discrete_pdf (size_t k, const gsl_ran_discrete_t *g);
 
+typedef struct {                /* Fenwick tree of changing weights */
+    size_t K;
+    size_t top;                 /* largest power of two <= K */
+    size_t npos;                /* number of positive weights */
+    double total;
+    double *w;                  /* weights w[k] */
+    double *tree;               /* partial sums tree[1..K] */
+} gsl_ran_discrete_dynamic_t;
+
+gsl_ran_discrete_dynamic_t * gsl_ran_discrete_dynamic_alloc (size_t K, const double w[]);
+void gsl_ran_discrete_dynamic_free (gsl_ran_discrete_dynamic_t * g);
+int gsl_ran_discrete_dynamic_set (gsl_ran_discrete_dynamic_t * g, size_t k, double w);
+int gsl_ran_discrete_dynamic_set_all (gsl_ran_discrete_dynamic_t * g, const double w[]);
+double gsl_ran_discrete_dynamic_get (const gsl_ran_discrete_dynamic_t * g, size_t k);
+size_t gsl_ran_discrete_dynamic (const gsl_rng * r, const gsl_ran_discrete_dynamic_t * g);
+double gsl_ran_discrete_dynamic_pdf (size_t k, const gsl_ran_discrete_dynamic_t * g);
+
 
 __END_DECLS
 
@@ -19,9 +19,12 @@
 
 #include <config.h>
 #include <math.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_sf_gamma.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
+#include "vectorize.h"
 
 /* The poisson distribution has the form
 
@@ -68,18 +71,229 @@ gsl_ran_poisson (const gsl_rng * r, double mu)
 
 }
 
+/* Samplers for a fixed mean.  For mu <= 10 they use the method above,
+   with exp(-mu) computed once, and give the same values as
+   gsl_ran_poisson().  For larger mu they use the transformed rejection
+   method with squeeze (PTRS) of Hormann, which takes constant time
+   whatever mu, with its constants computed once.
+
+   W. Hormann, "The transformed rejection method for generating
+   Poisson random variables", Insurance: Mathematics and Economics 12
+   (1993) 39-45. */
+
+#define PTRS_MIN_MU 10
+
+static void
+poisson_setup (gsl_ran_poisson_t * g, const double mu)
+{
+  g->mu = mu;
+  g->emu = exp (-mu);
+
+  if (mu > PTRS_MIN_MU)
+    {
+      g->lmu = log (mu);
+      g->b = 0.931 + 2.53 * sqrt (mu);
+      g->a = -0.059 + 0.02483 * g->b;
+      g->lalpha = log (1.1239 + 1.1328 / (g->b - 3.4));
+      g->vr = 0.9277 - 3.6224 / (g->b - 2);
+    }
+  else
+    {
+      g->lmu = g->a = g->b = g->lalpha = g->vr = 0;
+    }
+}
+
+/* the slow test of PTRS for a candidate k from U, V which failed the
+   fast test us >= 0.07 && V <= vr */
+
+static inline int
+ptrs_accept (const gsl_ran_poisson_t * g, const double U, const double V,
+             const double k)
+{
+  const double us = 0.5 - fabs (U);
+
+  if (k < 0 || (us < 0.013 && V > us))
+    return 0;
+
+  return (log (V) + g->lalpha - log (g->a / (us * us) + g->b)
+          <= -g->mu + k * g->lmu - gsl_sf_lnfact ((unsigned int) k));
+}
+
+gsl_ran_poisson_t *
+gsl_ran_poisson_alloc (const double mu)
+{
+  gsl_ran_poisson_t *g;
+
+  if (!(mu >= 0))
+    {
+      GSL_ERROR_NULL ("mean mu must be non-negative", GSL_EDOM);
+    }
+
+  g = (gsl_ran_poisson_t *) malloc (sizeof (gsl_ran_poisson_t));
+
+  if (g == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for poisson sampler",
+                      GSL_ENOMEM);
+    }
+
+  poisson_setup (g, mu);
+
+  return g;
+}
+
+void
+gsl_ran_poisson_free (gsl_ran_poisson_t * g)
+{
+  RETURN_IF_NULL (g);
+  free (g);
+}
+
+unsigned int
+gsl_ran_poisson_sample (const gsl_rng * r, const gsl_ran_poisson_t * g)
+{
+  if (g->mu <= PTRS_MIN_MU)
+    {
+      double prod = 1.0;
+      unsigned int k = 0;
+
+      do
+        {
+          prod *= gsl_rng_uniform (r);
+          k++;
+        }
+      while (prod > g->emu);
+
+      return k - 1;
+    }
+
+  while (1)
+    {
+      const double U = gsl_rng_uniform (r) - 0.5;
+      const double V = gsl_rng_uniform (r);
+      const double us = 0.5 - fabs (U);
+      const double k = floor ((2 * g->a / us + g->b) * U + g->mu + 0.43);
+
+      if (us >= 0.07 && V <= g->vr)
+        return (unsigned int) k;
+
+      if (ptrs_accept (g, U, V, k))
+        return (unsigned int) k;
+    }
+}
+
+/* For mu > 10 the array version takes the uniforms of a block of
+   candidates at once and applies the fast test of PTRS (which accepts
+   most of them) in one loop.  The others get the slow test
+   afterwards, a rejected candidate being replaced by a variate from
+   gsl_ran_poisson_sample().  The variates have the same distribution
+   but are not the same values as single calls. */
+
+#define POISSON_BLOCK 256
+
+static size_t poisson_block (const gsl_ran_poisson_t * g, const double uv[],
+                             unsigned int k[], size_t slow[], size_t n)
+  GSL_VECTORIZE;
+
+static size_t
+poisson_block (const gsl_ran_poisson_t * g, const double uv[],
+               unsigned int k[], size_t slow[], size_t n)
+{
+  const double a2 = 2 * g->a, b = g->b, mu = g->mu, vr = g->vr;
+  unsigned char out[POISSON_BLOCK];
+  size_t l, m = 0;
+
+  for (l = 0; l < n; l++)
+    {
+      const double U = uv[2 * l] - 0.5, V = uv[2 * l + 1];
+      const double us = 0.5 - fabs (U);
+      const double kd = floor ((a2 / us + b) * U + mu + 0.43);
+
+      k[l] = (kd > 0) ? (unsigned int) kd : 0;
+      out[l] = !(us >= 0.07 && V <= vr);
+    }
+
+  for (l = 0; l < n; l++)
+    {
+      slow[m] = l;
+      m += out[l];
+    }
+
+  return m;
+}
+
+void
+gsl_ran_poisson_sample_array (const gsl_rng * r, const gsl_ran_poisson_t * g,
+                              size_t n, unsigned int k[])
+{
+  double uv[2 * POISSON_BLOCK];
+  size_t slow[POISSON_BLOCK];
+  size_t i;
+
+  if (g->mu <= PTRS_MIN_MU)
+    {
+      for (i = 0; i < n; i++)
+        {
+          k[i] = gsl_ran_poisson_sample (r, g);
+        }
+
+      return;
+    }
+
+  while (n > 0)
+    {
+      const size_t nb = (n < POISSON_BLOCK) ? n : POISSON_BLOCK;
+      size_t m, q;
+
+      gsl_rng_uniform_array (r, uv, 2 * nb);
+
+      m = poisson_block (g, uv, k, slow, nb);
+
+      for (q = 0; q < m; q++)
+        {
+          const size_t l = slow[q];
+          const double U = uv[2 * l] - 0.5, V = uv[2 * l + 1];
+          const double us = 0.5 - fabs (U);
+          const double kd = floor ((2 * g->a / us + g->b) * U + g->mu + 0.43);
+
+          if (!ptrs_accept (g, U, V, kd))
+            {
+              k[l] = gsl_ran_poisson_sample (r, g);
+            }
+        }
+
+      k += nb;
+      n -= nb;
+    }
+}
+
+/* gsl_ran_poisson_array() gives the same values as gsl_ran_poisson(),
+   with exp(-mu) computed once when mu <= 10 */
+
 void
 gsl_ran_poisson_array (const gsl_rng * r, size_t n, unsigned int array[],
                        double mu)
 {
   size_t i;
 
+  if (mu <= PTRS_MIN_MU)
+    {
+      gsl_ran_poisson_t g;
+
+      poisson_setup (&g, mu);
+
+      for (i = 0; i < n; i++)
+        {
+          array[i] = gsl_ran_poisson_sample (r, &g);
+        }
+
+      return;
+    }
+
   for (i = 0; i < n; i++)
     {
       array[i] = gsl_ran_poisson (r, mu);
     }
-
-  return;
 }
 
 double
@@ -42,6 +42,8 @@ void testDiscretePDF (double (*f) (void), double (*pdf) (unsigned int),
 
 void test_shuffle (void);
 void test_choose (void);
+void test_prepared (void);
+void test_discrete_dynamic (void);
 double test_beta (void);
 double test_beta_pdf (double x);
 double test_bernoulli (void);
@@ -51,6 +53,10 @@ double test_binomial (void);
 double test_binomial_pdf (unsigned int n);
 double test_binomial_large (void);
 double test_binomial_large_pdf (unsigned int n);
+double test_binomial_sample (void);
+double test_binomial_sample_pdf (unsigned int n);
+double test_binomial_sample_array (void);
+double test_binomial_sample_array_pdf (unsigned int n);
 double test_binomial_huge (void);
 double test_binomial_huge_pdf (unsigned int n);
 double test_binomial_max (void);
@@ -86,10 +92,14 @@ double test_discrete2 (void);
 double test_discrete2_pdf (unsigned int n);
 double test_discrete3 (void);
 double test_discrete3_pdf (unsigned int n);
+double test_discrete_dynamic1 (void);
+double test_discrete_dynamic1_pdf (unsigned int n);
 double test_erlang (void);
 double test_erlang_pdf (double x);
 double test_exponential (void);
 double test_exponential_pdf (double x);
+double test_exponential_array (void);
+double test_exponential_array_pdf (double x);
 double test_exppow0 (void);
 double test_exppow0_pdf (double x);
 double test_exppow1 (void);
@@ -119,6 +129,12 @@ double test_gamma_large_pdf (double x);
 double test_gamma_vlarge (void);
 double test_gamma_vlarge_pdf (double x);
 double test_gamma_small (void);
+double test_gamma_sample (void);
+double test_gamma_sample_pdf (double x);
+double test_gamma_sample_array (void);
+double test_gamma_sample_array_pdf (double x);
+double test_gamma_small_sample_array (void);
+double test_gamma_small_sample_array_pdf (double x);
 double test_gamma_small_pdf (double x);
 double test_gamma_mt (void);
 double test_gamma_mt_pdf (double x);
@@ -138,6 +154,8 @@ double test_gaussian_ratio_method (void);
 double test_gaussian_ratio_method_pdf (double x);
 double test_gaussian_ziggurat (void);
 double test_gaussian_ziggurat_pdf (double x);
+double test_gaussian_ziggurat_array (void);
+double test_gaussian_ziggurat_array_pdf (double x);
 double test_gaussian_tail (void);
 double test_gaussian_tail_pdf (double x);
 double test_gaussian_tail1 (void);
@@ -221,6 +239,10 @@ double test_poisson (void);
 double test_poisson_pdf (unsigned int x);
 double test_poisson_large (void);
 double test_poisson_large_pdf (unsigned int x);
+double test_poisson_sample_large (void);
+double test_poisson_sample_large_pdf (unsigned int x);
+double test_poisson_sample_array (void);
+double test_poisson_sample_array_pdf (unsigned int x);
 double test_dir2d (void);
 double test_dir2d_pdf (double x);
 double test_dir2d_trig_method (void);
@@ -251,6 +273,15 @@ gsl_rng *r_global;
 static gsl_ran_discrete_t *g1 = NULL;
 static gsl_ran_discrete_t *g2 = NULL;
 static gsl_ran_discrete_t *g3 = NULL;
+static gsl_ran_discrete_dynamic_t *gd1 = NULL;
+static gsl_ran_gamma_t *gamma1 = NULL, *gamma2 = NULL, *gamma3 = NULL;
+static gsl_ran_poisson_t *poisson1 = NULL, *poisson2 = NULL;
+static gsl_ran_binomial_t *binomial1 = NULL, *binomial2 = NULL;
+
+/* the array samplers are tested through one value at a time from a
+   buffer of 1000, which is not a multiple of their block sizes */
+
+#define ARRAY_BUFFER 1000
 
 int
 main (void)
@@ -264,6 +295,8 @@ main (void)
 #define FUNC2(x) test_ ## x, test_ ## x ## _pdf, "test gsl_ran_" #x
 
   test_shuffle ();
+  test_prepared ();
+  test_discrete_dynamic ();
   test_choose ();
 
   testMoments (FUNC (ugaussian), 0.0, 100.0, 0.5);
@@ -295,6 +328,7 @@ main (void)
   testPDF (FUNC2 (dirichlet_small));
   testPDF (FUNC2 (erlang));
   testPDF (FUNC2 (exponential));
+  testPDF (FUNC2 (exponential_array));
 
   testPDF (FUNC2 (exppow0));
   testPDF (FUNC2 (exppow1));
@@ -313,6 +347,9 @@ main (void)
   testPDF (FUNC2 (gamma_vlarge));
   testPDF (FUNC2 (gamma_knuth_vlarge));
   testPDF (FUNC2 (gamma_small));
+  testPDF (FUNC2 (gamma_sample));
+  testPDF (FUNC2 (gamma_sample_array));
+  testPDF (FUNC2 (gamma_small_sample_array));
   testPDF (FUNC2 (gamma_mt));
   testPDF (FUNC2 (gamma_mt1));
   testPDF (FUNC2 (gamma_mt_int));
@@ -321,6 +358,7 @@ main (void)
   testPDF (FUNC2 (gaussian));
   testPDF (FUNC2 (gaussian_ratio_method));
   testPDF (FUNC2 (gaussian_ziggurat));
+  testPDF (FUNC2 (gaussian_ziggurat_array));
   testPDF (FUNC2 (ugaussian));
   testPDF (FUNC2 (ugaussian_ratio_method));
   testPDF (FUNC2 (gaussian_tail));
@@ -366,14 +404,19 @@ main (void)
   testDiscretePDF (FUNC2 (discrete1));
   testDiscretePDF (FUNC2 (discrete2));
   testDiscretePDF (FUNC2 (discrete3));
+  testDiscretePDF (FUNC2 (discrete_dynamic1));
   testDiscretePDF (FUNC2 (poisson));
   testDiscretePDF (FUNC2 (poisson_large));
+  testDiscretePDF (FUNC2 (poisson_sample_large));
+  testDiscretePDF (FUNC2 (poisson_sample_array));
   testDiscretePDF (FUNC2 (bernoulli));
   testDiscretePDF (FUNC2 (binomial));
   testDiscretePDF (FUNC2 (binomial0));
   testDiscretePDF (FUNC2 (binomial1));
   testDiscretePDF (FUNC2 (binomial_knuth));
   testDiscretePDF (FUNC2 (binomial_large));
+  testDiscretePDF (FUNC2 (binomial_sample));
+  testDiscretePDF (FUNC2 (binomial_sample_array));
   testDiscretePDF (FUNC2 (binomial_large_knuth));
   testDiscretePDF (FUNC2 (binomial_huge));
   testDiscretePDF (FUNC2 (binomial_huge_knuth));
@@ -396,6 +439,14 @@ main (void)
   gsl_ran_discrete_free (g1);
   gsl_ran_discrete_free (g2);
   gsl_ran_discrete_free (g3);
+  gsl_ran_discrete_dynamic_free (gd1);
+  gsl_ran_gamma_free (gamma1);
+  gsl_ran_gamma_free (gamma2);
+  gsl_ran_gamma_free (gamma3);
+  gsl_ran_poisson_free (poisson1);
+  gsl_ran_poisson_free (poisson2);
+  gsl_ran_binomial_free (binomial1);
+  gsl_ran_binomial_free (binomial2);
 
   exit (gsl_test_summary ());
 }
@@ -489,6 +540,177 @@ test_choose (void)
 
 }
 
+/* many random updates of a dynamic discrete distribution keep the
+   total in step with the weights, and events of weight zero are never
+   drawn */
+
+void
+test_discrete_dynamic (void)
+{
+  const size_t K = 1000;
+  gsl_ran_discrete_dynamic_t *g = gsl_ran_discrete_dynamic_alloc (K, NULL);
+  double sum = 0;
+  size_t i, k;
+  int status = 0;
+
+  for (i = 0; i < 100000; i++)
+    {
+      k = gsl_rng_uniform_int (r_global, K);
+
+      if (k % 2)
+        {
+          gsl_ran_discrete_dynamic_set (g, k, 0.0);
+        }
+      else
+        {
+          gsl_ran_discrete_dynamic_set (g, k, 1e3 * gsl_rng_uniform (r_global));
+        }
+    }
+
+  for (k = 0; k < K; k++)
+    {
+      sum += gsl_ran_discrete_dynamic_get (g, k);
+    }
+
+  gsl_test_rel (g->total, sum, 1e-10,
+                "gsl_ran_discrete_dynamic total after 100000 updates");
+
+  for (i = 0; i < 100000; i++)
+    {
+      k = gsl_ran_discrete_dynamic (r_global, g);
+      status |= (k % 2 != 0);
+    }
+
+  gsl_test (status, "gsl_ran_discrete_dynamic never draws zero weights");
+
+  gsl_ran_discrete_dynamic_set_all (g, NULL);
+  gsl_ran_discrete_dynamic_set (g, 999, 1.0);
+  gsl_test_int (gsl_ran_discrete_dynamic (r_global, g), 999,
+                "gsl_ran_discrete_dynamic with a single weight");
+
+  gsl_ran_discrete_dynamic_free (g);
+
+  /* setting every weight to zero leaves no total from the rounding
+     errors, and sampling is an error rather than an endless loop */
+
+  {
+    const double w3[] = { 0.1, 0.2, 0.3 };
+    gsl_error_handler_t *handler;
+    int status3 = 0;
+
+    g = gsl_ran_discrete_dynamic_alloc (3, w3);
+
+    for (k = 0; k < 3; k++)
+      gsl_ran_discrete_dynamic_set (g, k, 0.0);
+
+    handler = gsl_set_error_handler_off ();
+    status3 |= (g->total != 0);
+    status3 |= (gsl_ran_discrete_dynamic (r_global, g) != 0);
+    gsl_set_error_handler (handler);
+
+    gsl_test (status3, "gsl_ran_discrete_dynamic with every weight set to zero");
+
+    gsl_ran_discrete_dynamic_set (g, 1, 1e-300);
+    gsl_test_int (gsl_ran_discrete_dynamic (r_global, g), 1,
+                  "gsl_ran_discrete_dynamic with a tiny weight after zeros");
+
+    gsl_ran_discrete_dynamic_free (g);
+  }
+}
+
+/* the prepared samplers give the same values as the functions taking
+   the parameters, except for poisson with mu > 10, and so do
+   gsl_ran_exponential_array, gsl_ran_poisson_array for any mu and
+   gsl_ran_discrete_array; the Walker
+   table of a large discrete distribution gives back its
+   probabilities */
+
+void
+test_prepared (void)
+{
+  gsl_rng *r1 = gsl_rng_alloc (gsl_rng_default);
+  gsl_rng *r2 = gsl_rng_alloc (gsl_rng_default);
+  gsl_ran_gamma_t *ga = gsl_ran_gamma_alloc (2.5, 2.17);
+  gsl_ran_gamma_t *gs = gsl_ran_gamma_alloc (0.92, 2.17);
+  gsl_ran_poisson_t *po = gsl_ran_poisson_alloc (5.0);
+  gsl_ran_binomial_t *b1 = gsl_ran_binomial_alloc (0.3, 5);
+  gsl_ran_binomial_t *b2 = gsl_ran_binomial_alloc (0.7, 55);
+  gsl_ran_discrete_t *gd;
+  double x[1000], P[1000], sum = 0;
+  size_t k[1000];
+  unsigned int kp[1000];
+  int i, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, s6 = 0, s7 = 0, s8 = 0;
+  int s9 = 0;
+
+  for (i = 0; i < 1000; i++)
+    {
+      s1 |= (gsl_ran_gamma_sample (r1, ga) != gsl_ran_gamma (r2, 2.5, 2.17));
+      s2 |= (gsl_ran_gamma_sample (r1, gs) != gsl_ran_gamma (r2, 0.92, 2.17));
+      s3 |= (gsl_ran_poisson_sample (r1, po) != gsl_ran_poisson (r2, 5.0));
+      s4 |= (gsl_ran_binomial_sample (r1, b1)
+             != gsl_ran_binomial (r2, 0.3, 5));
+      s5 |= (gsl_ran_binomial_sample (r1, b2)
+             != gsl_ran_binomial (r2, 0.7, 55));
+    }
+
+  gsl_ran_exponential_array (r1, 2.0, 1000, x);
+
+  for (i = 0; i < 1000; i++)
+    {
+      s6 |= (x[i] != gsl_ran_exponential (r2, 2.0));
+    }
+
+  gsl_test (s1, "gsl_ran_gamma_sample (2.5) matches gsl_ran_gamma");
+  gsl_test (s2, "gsl_ran_gamma_sample (0.92) matches gsl_ran_gamma");
+  gsl_test (s3, "gsl_ran_poisson_sample (5) matches gsl_ran_poisson");
+  gsl_test (s4, "gsl_ran_binomial_sample (0.3, 5) matches gsl_ran_binomial");
+  gsl_test (s5, "gsl_ran_binomial_sample (0.7, 55) matches gsl_ran_binomial");
+  gsl_test (s6, "gsl_ran_exponential_array matches gsl_ran_exponential");
+
+  gsl_ran_poisson_array (r1, 500, kp, 5.0);
+  gsl_ran_poisson_array (r1, 500, kp + 500, 25.0);
+
+  for (i = 0; i < 1000; i++)
+    {
+      s9 |= (kp[i] != gsl_ran_poisson (r2, (i < 500) ? 5.0 : 25.0));
+    }
+
+  gsl_test (s9, "gsl_ran_poisson_array (5, 25) matches gsl_ran_poisson");
+
+  for (i = 0; i < 1000; i++)
+    {
+      P[i] = (i % 3 == 0) ? 0.0 : (i % 7) + 0.25;
+      sum += P[i];
+    }
+
+  gd = gsl_ran_discrete_preproc (1000, P);
+
+  for (i = 0; i < 1000; i++)
+    {
+      s7 |= (fabs (gsl_ran_discrete_pdf (i, gd) - P[i] / sum) > 1e-14);
+    }
+
+  gsl_ran_discrete_array (r1, gd, 1000, k);
+
+  for (i = 0; i < 1000; i++)
+    {
+      s8 |= (k[i] != gsl_ran_discrete (r2, gd));
+    }
+
+  gsl_test (s7, "gsl_ran_discrete_preproc (1000) table gives back P[k]");
+  gsl_test (s8, "gsl_ran_discrete_array matches gsl_ran_discrete");
+
+  gsl_ran_discrete_free (gd);
+
+  gsl_ran_gamma_free (ga);
+  gsl_ran_gamma_free (gs);
+  gsl_ran_poisson_free (po);
+  gsl_ran_binomial_free (b1);
+  gsl_ran_binomial_free (b2);
+  gsl_rng_free (r1);
+  gsl_rng_free (r2);
+}
+
 
 
 
@@ -798,6 +1020,48 @@ test_binomial_large_pdf (unsigned int n)
   return gsl_ran_binomial_pdf (n, 0.3, 55);
 }
 
+double
+test_binomial_sample (void)
+{
+  if (binomial1 == NULL)
+    {
+      binomial1 = gsl_ran_binomial_alloc (0.3, 5);
+    }
+  return gsl_ran_binomial_sample (r_global, binomial1);
+}
+
+double
+test_binomial_sample_pdf (unsigned int n)
+{
+  return gsl_ran_binomial_pdf (n, 0.3, 5);
+}
+
+double
+test_binomial_sample_array (void)
+{
+  static unsigned int k[ARRAY_BUFFER];
+  static size_t i = ARRAY_BUFFER;
+
+  if (binomial2 == NULL)
+    {
+      binomial2 = gsl_ran_binomial_alloc (0.7, 55);
+    }
+
+  if (i == ARRAY_BUFFER)
+    {
+      gsl_ran_binomial_sample_array (r_global, binomial2, ARRAY_BUFFER, k);
+      i = 0;
+    }
+
+  return k[i++];
+}
+
+double
+test_binomial_sample_array_pdf (unsigned int n)
+{
+  return gsl_ran_binomial_pdf (n, 0.7, 55);
+}
+
 double
 test_binomial_large_knuth (void)
 {
@@ -1197,6 +1461,32 @@ test_discrete3_pdf (unsigned int n)
   return gsl_ran_discrete_pdf ((size_t) n, g3);
 }
 
+/* alternating weights, some of them changed after allocation */
+
+double
+test_discrete_dynamic1 (void)
+{
+  static double P[20] = { 0.25, 0.5, 0.25, 0.5, 0.25, 0.5, 0.25, 0.5, 0.25, 0.5,
+    0.25, 0.5, 0.25, 0.5, 0.25, 0.5, 0.25, 0.5, 0.25, 0.5
+  };
+  if (gd1 == NULL)
+    {
+      gd1 = gsl_ran_discrete_dynamic_alloc (20, P);
+      gsl_ran_discrete_dynamic_set (gd1, 0, 3.0);
+      gsl_ran_discrete_dynamic_set (gd1, 7, 0.0);
+      gsl_ran_discrete_dynamic_set (gd1, 19, 1.5);
+      gsl_ran_discrete_dynamic_set (gd1, 7, 0.75);
+      gsl_ran_discrete_dynamic_set (gd1, 12, 0.0);
+    }
+  return gsl_ran_discrete_dynamic (r_global, gd1);
+}
+
+double
+test_discrete_dynamic1_pdf (unsigned int n)
+{
+  return gsl_ran_discrete_dynamic_pdf ((size_t) n, gd1);
+}
+
 
 double
 test_erlang (void)
@@ -1222,6 +1512,27 @@ test_exponential_pdf (double x)
   return gsl_ran_exponential_pdf (x, 2.0);
 }
 
+double
+test_exponential_array (void)
+{
+  static double x[ARRAY_BUFFER];
+  static size_t i = ARRAY_BUFFER;
+
+  if (i == ARRAY_BUFFER)
+    {
+      gsl_ran_exponential_array (r_global, 2.0, ARRAY_BUFFER, x);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_exponential_array_pdf (double x)
+{
+  return gsl_ran_exponential_pdf (x, 2.0);
+}
+
 double
 test_exppow0 (void)
 {
@@ -1395,6 +1706,74 @@ test_gamma_small_pdf (double x)
   return gsl_ran_gamma_pdf (x, 0.92, 2.17);
 }
 
+double
+test_gamma_sample (void)
+{
+  if (gamma1 == NULL)
+    {
+      gamma1 = gsl_ran_gamma_alloc (2.5, 2.17);
+    }
+  return gsl_ran_gamma_sample (r_global, gamma1);
+}
+
+double
+test_gamma_sample_pdf (double x)
+{
+  return gsl_ran_gamma_pdf (x, 2.5, 2.17);
+}
+
+double
+test_gamma_sample_array (void)
+{
+  static double x[ARRAY_BUFFER];
+  static size_t i = ARRAY_BUFFER;
+
+  if (gamma2 == NULL)
+    {
+      gamma2 = gsl_ran_gamma_alloc (2.5, 2.17);
+    }
+
+  if (i == ARRAY_BUFFER)
+    {
+      gsl_ran_gamma_sample_array (r_global, gamma2, ARRAY_BUFFER, x);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_gamma_sample_array_pdf (double x)
+{
+  return gsl_ran_gamma_pdf (x, 2.5, 2.17);
+}
+
+double
+test_gamma_small_sample_array (void)
+{
+  static double x[ARRAY_BUFFER];
+  static size_t i = ARRAY_BUFFER;
+
+  if (gamma3 == NULL)
+    {
+      gamma3 = gsl_ran_gamma_alloc (0.92, 2.17);
+    }
+
+  if (i == ARRAY_BUFFER)
+    {
+      gsl_ran_gamma_sample_array (r_global, gamma3, ARRAY_BUFFER, x);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_gamma_small_sample_array_pdf (double x)
+{
+  return gsl_ran_gamma_pdf (x, 0.92, 2.17);
+}
+
 double
 test_gamma_vlarge (void)
 {
@@ -1533,6 +1912,30 @@ test_gaussian_ziggurat_pdf (double x)
   return gsl_ran_gaussian_pdf (x, 3.12);
 }
 
+/* draw from blocks of 1000 values, which is not a multiple of the
+   internal block size */
+
+double
+test_gaussian_ziggurat_array (void)
+{
+  static double x[1000];
+  static size_t i = 1000;
+
+  if (i == 1000)
+    {
+      gsl_ran_gaussian_ziggurat_array (r_global, 3.12, 1000, x);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_gaussian_ziggurat_array_pdf (double x)
+{
+  return gsl_ran_gaussian_pdf (x, 3.12);
+}
+
 double
 test_gaussian_tail (void)
 {
@@ -2114,6 +2517,48 @@ test_poisson_large_pdf (unsigned int n)
   return gsl_ran_poisson_pdf (n, 30.0);
 }
 
+double
+test_poisson_sample_large (void)
+{
+  if (poisson1 == NULL)
+    {
+      poisson1 = gsl_ran_poisson_alloc (30.0);
+    }
+  return gsl_ran_poisson_sample (r_global, poisson1);
+}
+
+double
+test_poisson_sample_large_pdf (unsigned int n)
+{
+  return gsl_ran_poisson_pdf (n, 30.0);
+}
+
+double
+test_poisson_sample_array (void)
+{
+  static unsigned int k[ARRAY_BUFFER];
+  static size_t i = ARRAY_BUFFER;
+
+  if (poisson2 == NULL)
+    {
+      poisson2 = gsl_ran_poisson_alloc (30.0);
+    }
+
+  if (i == ARRAY_BUFFER)
+    {
+      gsl_ran_poisson_sample_array (r_global, poisson2, ARRAY_BUFFER, k);
+      i = 0;
+    }
+
+  return k[i++];
+}
+
+double
+test_poisson_sample_array_pdf (unsigned int n)
+{
+  return gsl_ran_poisson_pdf (n, 30.0);
+}
+
 
 double
 test_tdist1 (void)
@@ -36,6 +36,7 @@ main (void)
   benchmark(gsl_rng_borosh13);
   benchmark(gsl_rng_cmrg);
   benchmark(gsl_rng_coveyou);
+  benchmark(gsl_rng_dsfmt19937);
   benchmark(gsl_rng_fishman18);
   benchmark(gsl_rng_fishman20);
   benchmark(gsl_rng_fishman2x);
@@ -46,6 +47,9 @@ main (void)
   benchmark(gsl_rng_minstd);
   benchmark(gsl_rng_mrg);
   benchmark(gsl_rng_mt19937);
+  benchmark(gsl_rng_pcg64);
+  benchmark(gsl_rng_philox4x32);
+  benchmark(gsl_rng_philox4x64);
   benchmark(gsl_rng_r250);
   benchmark(gsl_rng_ran0);
   benchmark(gsl_rng_ran1);
@@ -81,15 +85,20 @@ main (void)
   benchmark(gsl_rng_ranlxs1);
   benchmark(gsl_rng_ranlxs2);
   benchmark(gsl_rng_ranmar);
+  benchmark(gsl_rng_sfmt19937);
   benchmark(gsl_rng_slatec);
+  benchmark(gsl_rng_splitmix64);
   benchmark(gsl_rng_taus);
   benchmark(gsl_rng_taus113);
+  benchmark(gsl_rng_threefry4x64);
   benchmark(gsl_rng_transputer);
   benchmark(gsl_rng_tt800);
   benchmark(gsl_rng_uni);
   benchmark(gsl_rng_uni32);
   benchmark(gsl_rng_vax);
   benchmark(gsl_rng_waterman14);
+  benchmark(gsl_rng_xoroshiro128plus);
+  benchmark(gsl_rng_xoshiro256starstar);
   benchmark(gsl_rng_zuf);
 
   return 0;
@@ -99,8 +108,9 @@ void
 benchmark (const gsl_rng_type * T)
 {
   int start, end;
-  int i = 0, d = 0 ;
-  double t1, t2;
+  int i = 0, d = 0, a = 0;
+  double t1, t2, t3;
+  static double block[1000];
 
   gsl_rng *r = gsl_rng_alloc (T);
 
@@ -132,9 +142,29 @@ benchmark (const gsl_rng_type * T)
 
   t2 = (end - start) / (double) CLOCKS_PER_SEC;
 
+  /* doubles from gsl_rng_uniform_array, in blocks of 1000 */
 
-  printf ("%6.0f k ints/sec, %6.0f k doubles/sec, %s\n",
-          i / t1 / 1000.0, d / t2 / 1000.0, gsl_rng_name (r));
+  start = clock ();
+  do
+    {
+      int j;
+      for (j = 0; j < N; j += 1000)
+        {
+          int k;
+          gsl_rng_uniform_array (r, block, 1000);
+          for (k = 0; k < 1000; k++)
+            dsum += block[k];
+        }
+
+      a += N;
+      end = clock ();
+    }
+  while (end < start + CLOCKS_PER_SEC/10);
+
+  t3 = (end - start) / (double) CLOCKS_PER_SEC;
+
+  printf ("%6.0f k ints/sec, %6.0f k doubles/sec, %6.0f k doubles/sec in arrays, %s\n",
+          i / t1 / 1000.0, d / t2 / 1000.0, a / t3 / 1000.0, gsl_rng_name (r));
 
   gsl_rng_free (r);
 }
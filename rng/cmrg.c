@@ -19,7 +19,9 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_rng.h>
+#include "jump.h"
 
 /* This is a combined multiple recursive generator. The sequence is,
 
@@ -74,6 +76,7 @@
 static inline unsigned long int cmrg_get (void *vstate);
 static double cmrg_get_double (void *vstate);
 static void cmrg_set (void *state, unsigned long int s);
+static int cmrg_jump (void *vstate, unsigned int log2_steps);
 
 static const long int m1 = 2147483647, m2 = 2145483479;
 
@@ -149,6 +152,46 @@ cmrg_get_double (void *vstate)
 }
 
 
+/* One step maps (x1, x2, x3) to (a2 x2 + a3 x3, x1, x2) mod m1 and
+   (y1, y2, y3) to (b1 y1 + b3 y3, y1, y2) mod m2 */
+
+static int
+cmrg_jump (void *vstate, unsigned int log2_steps)
+{
+  cmrg_state_t *state = (cmrg_state_t *) vstate;
+  uint64_t a[9] = { 0 }, b[9] = { 0 }, x[3], y[3];
+
+  a[1] = a2;
+  a[2] = m1 + a3;
+  a[3] = a[7] = 1;
+
+  b[0] = b1;
+  b[2] = m2 + b3;
+  b[3] = b[7] = 1;
+
+  jump_matrix_mod (a, 3, m1, log2_steps);
+  jump_matrix_mod (b, 3, m2, log2_steps);
+
+  x[0] = state->x1;
+  x[1] = state->x2;
+  x[2] = state->x3;
+  y[0] = state->y1;
+  y[1] = state->y2;
+  y[2] = state->y3;
+
+  jump_matrix_apply (a, 3, m1, x);
+  jump_matrix_apply (b, 3, m2, y);
+
+  state->x1 = x[0];
+  state->x2 = x[1];
+  state->x3 = x[2];
+  state->y1 = y[0];
+  state->y2 = y[1];
+  state->y3 = y[2];
+
+  return GSL_SUCCESS;
+}
+
 static void
 cmrg_set (void *vstate, unsigned long int s)
 {
@@ -192,6 +235,9 @@ static const gsl_rng_type cmrg_type =
  sizeof (cmrg_state_t),
  &cmrg_set,
  &cmrg_get,
- &cmrg_get_double};
+ &cmrg_get_double,
+ 0,
+ 0,
+ &cmrg_jump};
 
 const gsl_rng_type *gsl_rng_cmrg = &cmrg_type;
@@ -0,0 +1,139 @@
+/* rng/counter.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Keys and counters of the counter-based generators.  They are given
+   as arrays of 32-bit values, least significant first, whatever the
+   size of the words of the generator, so that the same call gives the
+   same stream on all platforms. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include "counter.h"
+
+typedef struct
+  {
+    const gsl_rng_type **type;
+    size_t key_words;           /* words of the key */
+    unsigned int bits;          /* size of the words */
+  }
+counter_type_t;
+
+static const counter_type_t counter_types[] =
+  {
+    { &gsl_rng_philox4x32, 2, 32 },
+    { &gsl_rng_philox4x64, 2, 64 },
+    { &gsl_rng_threefry4x64, 4, 64 },
+    { 0, 0, 0 }
+  };
+
+static const counter_type_t *
+counter_type (const gsl_rng_type * T)
+{
+  const counter_type_t *c;
+
+  for (c = counter_types; c->type != 0; c++)
+    {
+      if (*(c->type) == T)
+        {
+          return c;
+        }
+    }
+
+  return 0;
+}
+
+/* pack n 32-bit values into the words w[4] */
+
+static void
+counter_pack (uint64_t w[4], const unsigned long int x[], size_t n,
+              const unsigned int bits)
+{
+  size_t i;
+
+  for (i = 0; i < 4; i++)
+    {
+      w[i] = 0;
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      const uint64_t v = (uint64_t) (x[i] & 0xffffffffUL);
+
+      if (bits == 32)
+        {
+          w[i] = v;
+        }
+      else
+        {
+          w[i / 2] |= v << (32 * (i % 2));
+        }
+    }
+}
+
+int
+gsl_rng_set_key (const gsl_rng * r, const unsigned long int key[], size_t n)
+{
+  const counter_type_t *c = counter_type (r->type);
+  counter_state_t *state = (counter_state_t *) r->state;
+  int k;
+
+  if (c == 0)
+    {
+      GSL_ERROR ("generator is not counter-based", GSL_EUNSUP);
+    }
+
+  if (n > c->key_words * (c->bits / 32))
+    {
+      GSL_ERROR ("key is longer than that of the generator", GSL_EINVAL);
+    }
+
+  counter_pack (state->key, key, n, c->bits);
+
+  for (k = 0; k < 4; k++)
+    {
+      state->ctr[k] = 0;
+    }
+
+  state->idx = 4;
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_rng_set_counter (const gsl_rng * r, const unsigned long int counter[],
+                     size_t n)
+{
+  const counter_type_t *c = counter_type (r->type);
+  counter_state_t *state = (counter_state_t *) r->state;
+
+  if (c == 0)
+    {
+      GSL_ERROR ("generator is not counter-based", GSL_EUNSUP);
+    }
+
+  if (n > 4 * (c->bits / 32))
+    {
+      GSL_ERROR ("counter is longer than that of the generator", GSL_EINVAL);
+    }
+
+  counter_pack (state->ctr, counter, n, c->bits);
+  state->idx = 4;
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,100 @@
+/* rng/counter.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* State of the counter-based generators (philox.c, threefry.c), which
+   compute each block of four words as a keyed function of a counter.
+   The generators with 32-bit words use the low halves of the words
+   here.  This layout is shared with counter.c, which implements
+   gsl_rng_set_key() and gsl_rng_set_counter(). */
+
+#include <stdint.h>
+
+typedef struct
+  {
+    uint64_t key[4];
+    uint64_t ctr[4];            /* counter of the next block */
+    uint64_t out[4];            /* the current block */
+    unsigned int idx;           /* next word of out, 4 if none left */
+  }
+counter_state_t;
+
+/* the maximum number of blocks computed in parallel */
+
+#define COUNTER_BLOCKS 16
+
+/* add one to the counter, a multiword integer with words of the given
+   mask, least significant first */
+
+static inline void
+counter_increment (uint64_t ctr[4], const uint64_t mask)
+{
+  int k;
+
+  for (k = 0; k < 4; k++)
+    {
+      ctr[k] = (ctr[k] + 1) & mask;
+
+      if (ctr[k] != 0)
+        {
+          break;
+        }
+    }
+}
+
+/* subtract one from the counter */
+
+static inline void
+counter_decrement (uint64_t ctr[4], const uint64_t mask)
+{
+  int k;
+
+  for (k = 0; k < 4; k++)
+    {
+      if (ctr[k] != 0)
+        {
+          ctr[k]--;
+          break;
+        }
+
+      ctr[k] = mask;
+    }
+}
+
+/* add 2^bit to the counter, a multiword integer with words of the
+   given number of bits, modulo 2^(4 bits) */
+
+static inline void
+counter_add_pow2 (uint64_t ctr[4], const unsigned int bit,
+                  const uint64_t mask, const unsigned int bits)
+{
+  unsigned int k = bit / bits;
+  uint64_t add;
+
+  if (k >= 4)
+    {
+      return;
+    }
+
+  add = (uint64_t) 1 << (bit % bits);
+
+  for (; k < 4 && add != 0; k++)
+    {
+      const uint64_t v = (ctr[k] + add) & mask;
+      add = (v < ctr[k]);           /* carry */
+      ctr[k] = v;
+    }
+}
@@ -0,0 +1,210 @@
+/* rng/counter_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* The gsl_rng_type functions of a counter-based generator, included
+   by philox.c and threefry.c with the macros
+
+     FN(x)          the name of function x of the generator
+     BLOCKS         the function which computes nb blocks, from the
+                    counter ctr onwards, into y[4 nb] and advances ctr
+     COUNTER_BITS   the size of the words, 32 or 64
+
+   The words of a block are returned in order.  64-bit words are
+   returned as their top 32 bits by gsl_rng_get, and as their top 53
+   bits divided by 2^53 by gsl_rng_uniform.  The bulk functions compute
+   up to COUNTER_BLOCKS blocks at a time, which BLOCKS vectorizes over
+   the blocks. */
+
+#if COUNTER_BITS == 32
+#define COUNTER_MASK ((uint64_t) 0xffffffffUL)
+#define COUNTER_INT(w) ((unsigned long int) (w))
+#define COUNTER_DOUBLE(w) ((uint32_t) (w) / 4294967296.0)
+#else
+#define COUNTER_MASK (~(uint64_t) 0)
+#define COUNTER_INT(w) ((unsigned long int) ((w) >> 32))
+#define COUNTER_DOUBLE(w) ((int64_t) ((w) >> 11) / 9007199254740992.0)
+#endif
+
+static inline unsigned long int FN(get) (void *vstate);
+static double FN(get_double) (void *vstate);
+static void FN(set) (void *vstate, unsigned long int s);
+static void FN(get_array) (void *vstate, unsigned long int x[], size_t n)
+  GSL_VECTORIZE;
+static void FN(get_double_array) (void *vstate, double x[], size_t n)
+  GSL_VECTORIZE;
+static int FN(jump) (void *vstate, unsigned int log2_steps);
+
+static inline unsigned long int
+FN(get) (void *vstate)
+{
+  counter_state_t *state = (counter_state_t *) vstate;
+
+  if (state->idx >= 4)
+    {
+      BLOCKS (state->key, state->ctr, state->out, 1);
+      state->idx = 0;
+    }
+
+  return COUNTER_INT (state->out[state->idx++]);
+}
+
+static double
+FN(get_double) (void *vstate)
+{
+  counter_state_t *state = (counter_state_t *) vstate;
+
+  if (state->idx >= 4)
+    {
+      BLOCKS (state->key, state->ctr, state->out, 1);
+      state->idx = 0;
+    }
+
+  return COUNTER_DOUBLE (state->out[state->idx++]);
+}
+
+/* the seed is the first word of the key, and the stream starts from
+   the zero counter */
+
+static void
+FN(set) (void *vstate, unsigned long int s)
+{
+  counter_state_t *state = (counter_state_t *) vstate;
+  int k;
+
+  for (k = 0; k < 4; k++)
+    {
+      state->key[k] = 0;
+      state->ctr[k] = 0;
+      state->out[k] = 0;
+    }
+
+  state->key[0] = (uint64_t) s & COUNTER_MASK;
+  state->idx = 4;
+}
+
+static void
+FN(get_array) (void *vstate, unsigned long int x[], size_t n)
+{
+  counter_state_t *state = (counter_state_t *) vstate;
+  uint64_t y[4 * COUNTER_BLOCKS];
+  size_t i = 0, j;
+
+  while (i < n && state->idx < 4)
+    {
+      x[i++] = COUNTER_INT (state->out[state->idx++]);
+    }
+
+  while (n - i >= 4)
+    {
+      size_t nb = (n - i) / 4;
+
+      if (nb > COUNTER_BLOCKS)
+        {
+          nb = COUNTER_BLOCKS;
+        }
+
+      BLOCKS (state->key, state->ctr, y, nb);
+
+      for (j = 0; j < 4 * nb; j++)
+        {
+          x[i + j] = COUNTER_INT (y[j]);
+        }
+
+      i += 4 * nb;
+    }
+
+  while (i < n)
+    {
+      x[i++] = FN(get) (vstate);
+    }
+}
+
+static void
+FN(get_double_array) (void *vstate, double x[], size_t n)
+{
+  counter_state_t *state = (counter_state_t *) vstate;
+  uint64_t y[4 * COUNTER_BLOCKS];
+  size_t i = 0, j;
+
+  while (i < n && state->idx < 4)
+    {
+      x[i++] = COUNTER_DOUBLE (state->out[state->idx++]);
+    }
+
+  while (n - i >= 4)
+    {
+      size_t nb = (n - i) / 4;
+
+      if (nb > COUNTER_BLOCKS)
+        {
+          nb = COUNTER_BLOCKS;
+        }
+
+      BLOCKS (state->key, state->ctr, y, nb);
+
+      for (j = 0; j < 4 * nb; j++)
+        {
+          x[i + j] = COUNTER_DOUBLE (y[j]);
+        }
+
+      i += 4 * nb;
+    }
+
+  while (i < n)
+    {
+      x[i++] = FN(get_double) (vstate);
+    }
+}
+
+/* A jump of 2^k words with k >= 2 adds 2^(k-2) to the counter of the
+   current block, which is recomputed if it is partly used */
+
+static int
+FN(jump) (void *vstate, unsigned int log2_steps)
+{
+  counter_state_t *state = (counter_state_t *) vstate;
+
+  if (log2_steps < 2)
+    {
+      unsigned int i;
+
+      for (i = 0; i < (1U << log2_steps); i++)
+        {
+          FN(get) (vstate);
+        }
+
+      return GSL_SUCCESS;
+    }
+
+  if (state->idx < 4)
+    {
+      counter_decrement (state->ctr, COUNTER_MASK);
+    }
+
+  counter_add_pow2 (state->ctr, log2_steps - 2, COUNTER_MASK, COUNTER_BITS);
+
+  if (state->idx < 4)
+    {
+      BLOCKS (state->key, state->ctr, state->out, 1);
+    }
+
+  return GSL_SUCCESS;
+}
+
+#undef COUNTER_MASK
+#undef COUNTER_INT
+#undef COUNTER_DOUBLE
@@ -0,0 +1,341 @@
+/* rng/dsfmt.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the double precision SIMD-oriented Fast Mersenne Twister
+   dSFMT19937 of Mutsuo Saito and Makoto Matsumoto.  The recurrence
+   works directly on the bit patterns of IEEE double precision numbers
+   in [1,2), two to a 128-bit word, so that each output has a 52-bit
+   mantissa and no conversion from integers is needed.  The period is
+   a multiple of 2^19937 - 1.
+
+   Each 64-bit element is held as two 32-bit halves, low half first,
+   so the 128-bit words are four 32-bit lanes as in sfmt.c, and the
+   recurrence uses SSE2 where it is available.  gsl_rng_uniform
+   returns the mantissa m as m / 2^52, which is exactly the reference
+   output in [1,2) minus one.  gsl_rng_get returns the top 32 bits of
+   the mantissa.  The output and the seeding procedure match
+   init_gen_rand() and genrand_close_open() of dSFMT version 2.2.
+
+   From: Mutsuo Saito and Makoto Matsumoto, "A PRNG Specialized in
+   Double Precision Floating Point Numbers Using an Affine Transition",
+   Monte Carlo and Quasi-Monte Carlo Methods 2008, Springer (2009),
+   pages 589-602. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_rng.h>
+#include "vectorize.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define N 191           /* 128-bit words of state, followed by lung */
+#define N64 (2 * N)
+#define POS1 117
+#define SL1 19
+#define SR 12
+#define MASK 0xffffffffUL
+
+/* 64-bit constants as { low half, high half } pairs */
+
+static const unsigned int msk[4] =
+  { 0xfffffb3fU, 0x000ffaffU, 0xfc90fffdU, 0x000ffdffU };
+
+static const unsigned int fix[4] =
+  { 0xb32f4329U, 0x90014964U, 0x548a7c7aU, 0x3b8d12acU };
+
+static const unsigned int pcv[4] =
+  { 0x0dc82880U, 0x3d84e1acU, 0x00000001U, 0x00000000U };
+
+typedef struct
+  {
+    unsigned int w[4 * (N + 1)];
+    int idx;
+  }
+dsfmt_state_t;
+
+static inline unsigned long int dsfmt_get (void *vstate);
+static double dsfmt_get_double (void *vstate);
+static void dsfmt_set (void *state, unsigned long int s);
+static void dsfmt_generate (dsfmt_state_t * state);
+static void dsfmt_get_array (void *vstate, unsigned long int x[], size_t n)
+  GSL_VECTORIZE;
+static void dsfmt_get_double_array (void *vstate, double x[], size_t n)
+  GSL_VECTORIZE;
+
+/* generate N words at one time, updating the extra word "lung" which
+   carries the state from one word to the next.  This uses SSE2 where
+   it is available, and computes the lanes one at a time otherwise. */
+
+static void
+dsfmt_generate (dsfmt_state_t * state)
+{
+  unsigned int *const w = state->w;
+  unsigned int *const lung = w + 4 * N;
+  int i;
+
+#if defined(__SSE2__)
+  const __m128i mask = _mm_loadu_si128 ((const __m128i *) msk);
+  __m128i L = _mm_loadu_si128 ((const __m128i *) lung);
+
+  for (i = 0; i < N; i++)
+    {
+      const int j = (i < N - POS1) ? i + POS1 : i + POS1 - N;
+      const __m128i a = _mm_loadu_si128 ((const __m128i *) (w + 4 * i));
+      const __m128i b = _mm_loadu_si128 ((const __m128i *) (w + 4 * j));
+      __m128i r;
+
+      /* the shuffle reverses the four lanes, which swaps both the
+         elements of L and their halves */
+
+      L = _mm_xor_si128 (_mm_shuffle_epi32 (L, 0x1b),
+                         _mm_xor_si128 (_mm_slli_epi64 (a, SL1), b));
+
+      r = _mm_xor_si128 (_mm_srli_epi64 (L, SR), _mm_and_si128 (L, mask));
+      r = _mm_xor_si128 (r, a);
+
+      _mm_storeu_si128 ((__m128i *) (w + 4 * i), r);
+    }
+
+  _mm_storeu_si128 ((__m128i *) lung, L);
+#else
+  unsigned int L[4];
+  int k;
+
+  for (k = 0; k < 4; k++)
+    {
+      L[k] = lung[k];
+    }
+
+  for (i = 0; i < N; i++)
+    {
+      unsigned int *const a = w + 4 * i;
+      const unsigned int *const b = w + 4 * ((i < N - POS1) ? i + POS1 : i + POS1 - N);
+      unsigned int t[4];
+
+      /* L = (a << SL1) ^ swap(L) ^ b for each 64-bit element, where
+         swap exchanges the halves of the other element of L */
+
+      t[0] = ((a[0] << SL1) & MASK) ^ L[3] ^ b[0];
+      t[1] = (((a[1] << SL1) & MASK) | (a[0] >> (32 - SL1))) ^ L[2] ^ b[1];
+      t[2] = ((a[2] << SL1) & MASK) ^ L[1] ^ b[2];
+      t[3] = (((a[3] << SL1) & MASK) | (a[2] >> (32 - SL1))) ^ L[0] ^ b[3];
+
+      for (k = 0; k < 4; k++)
+        {
+          L[k] = t[k];
+        }
+
+      /* a = (L >> SR) ^ (L & msk) ^ a */
+
+      a[0] ^= (L[0] >> SR) ^ ((L[1] << (32 - SR)) & MASK) ^ (L[0] & msk[0]);
+      a[1] ^= (L[1] >> SR) ^ (L[1] & msk[1]);
+      a[2] ^= (L[2] >> SR) ^ ((L[3] << (32 - SR)) & MASK) ^ (L[2] & msk[2]);
+      a[3] ^= (L[3] >> SR) ^ (L[3] & msk[3]);
+    }
+
+  for (k = 0; k < 4; k++)
+    {
+      lung[k] = L[k];
+    }
+#endif
+
+  state->idx = 0;
+}
+
+static inline unsigned long int
+dsfmt_get (void *vstate)
+{
+  dsfmt_state_t *state = (dsfmt_state_t *) vstate;
+  const unsigned int *p;
+
+  if (state->idx >= N64)
+    {
+      dsfmt_generate (state);
+    }
+
+  p = state->w + 2 * state->idx++;
+
+  return ((p[1] & 0x000fffffUL) << 12) | (p[0] >> 20);
+}
+
+static double
+dsfmt_get_double (void *vstate)
+{
+  dsfmt_state_t *state = (dsfmt_state_t *) vstate;
+  const unsigned int *p;
+
+  if (state->idx >= N64)
+    {
+      dsfmt_generate (state);
+    }
+
+  p = state->w + 2 * state->idx++;
+
+  return ((p[1] & 0x000fffff) * 4294967296.0 + p[0]) / 4503599627370496.0;
+}
+
+static void
+dsfmt_get_array (void *vstate, unsigned long int x[], size_t n)
+{
+  dsfmt_state_t *state = (dsfmt_state_t *) vstate;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      const unsigned int *p;
+      size_t j, m;
+
+      if (state->idx >= N64)
+        {
+          dsfmt_generate (state);
+        }
+
+      p = state->w + 2 * state->idx;
+      m = N64 - state->idx;
+
+      if (m > n - i)
+        {
+          m = n - i;
+        }
+
+      for (j = 0; j < m; j++)
+        {
+          x[i + j] = ((p[2 * j + 1] & 0x000fffffUL) << 12) | (p[2 * j] >> 20);
+        }
+
+      state->idx += m;
+      i += m;
+    }
+}
+
+static void
+dsfmt_get_double_array (void *vstate, double x[], size_t n)
+{
+  dsfmt_state_t *state = (dsfmt_state_t *) vstate;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      const unsigned int *p;
+      size_t j, m;
+
+      if (state->idx >= N64)
+        {
+          dsfmt_generate (state);
+        }
+
+      p = state->w + 2 * state->idx;
+      m = N64 - state->idx;
+
+      if (m > n - i)
+        {
+          m = n - i;
+        }
+
+#if defined(__SSE2__)
+      /* the elements are the bit patterns of doubles in [1,2) */
+
+      j = 0;
+
+      if (state->idx % 2 == 1)
+        {
+          x[i] = ((p[1] & 0x000fffff) * 4294967296.0 + p[0])
+            / 4503599627370496.0;
+          j = 1;
+        }
+
+      for (; j + 2 <= m; j += 2)
+        {
+          const __m128d y = _mm_castsi128_pd (_mm_loadu_si128 ((const __m128i *) (p + 2 * j)));
+          _mm_storeu_pd (x + i + j, _mm_sub_pd (y, _mm_set1_pd (1.0)));
+        }
+#else
+      j = 0;
+#endif
+
+      for (; j < m; j++)
+        {
+          x[i + j] = ((p[2 * j + 1] & 0x000fffff) * 4294967296.0 + p[2 * j])
+            / 4503599627370496.0;
+        }
+
+      state->idx += m;
+      i += m;
+    }
+}
+
+static void
+dsfmt_set (void *vstate, unsigned long int s)
+{
+  dsfmt_state_t *state = (dsfmt_state_t *) vstate;
+  unsigned int *const w = state->w;
+  unsigned int *const lung = w + 4 * N;
+  unsigned int inner = 0;
+  int i;
+
+  /* a seed of zero is used as it is, as in the reference test output */
+
+  w[0] = s & MASK;
+
+  for (i = 1; i < 4 * (N + 1); i++)
+    {
+      w[i] = (1812433253UL * (w[i - 1] ^ (w[i - 1] >> 30)) + i) & MASK;
+    }
+
+  /* set the exponent of the elements of the state to that of [1,2) */
+
+  for (i = 0; i < N64; i++)
+    {
+      w[2 * i + 1] = (w[2 * i + 1] & 0x000fffffU) | 0x3ff00000U;
+    }
+
+  state->idx = N64;
+
+  /* period certification, which only needs to flip the lowest bit of
+     the second element of lung since that bit is set in pcv */
+
+  for (i = 0; i < 4; i++)
+    {
+      inner ^= (lung[i] ^ fix[i]) & pcv[i];
+    }
+
+  for (i = 16; i > 0; i >>= 1)
+    {
+      inner ^= inner >> i;
+    }
+
+  if ((inner & 1) == 0)
+    {
+      lung[2] ^= 1;
+    }
+}
+
+static const gsl_rng_type dsfmt_type =
+{"dsfmt19937",                  /* name */
+ 0xffffffffUL,                  /* RAND_MAX  */
+ 0,                             /* RAND_MIN  */
+ sizeof (dsfmt_state_t),
+ &dsfmt_set,
+ &dsfmt_get,
+ &dsfmt_get_double,
+ &dsfmt_get_array,
+ &dsfmt_get_double_array,
+ 0};
+
+const gsl_rng_type *gsl_rng_dsfmt19937 = &dsfmt_type;
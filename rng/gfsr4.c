@@ -51,10 +51,15 @@
 #include <config.h>
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
+#include "vectorize.h"
 
 static inline unsigned long int gfsr4_get (void *vstate);
 static double gfsr4_get_double (void *vstate);
 static void gfsr4_set (void *state, unsigned long int s);
+static void gfsr4_get_array (void *vstate, unsigned long int x[], size_t n)
+  GSL_VECTORIZE;
+static void gfsr4_get_double_array (void *vstate, double x[], size_t n)
+  GSL_VECTORIZE;
 
 /* Magic numbers */
 #define A 471
@@ -91,6 +96,95 @@ gfsr4_get_double (void * vstate)
   return gfsr4_get (vstate) / 4294967296.0 ;
 }
 
+/* The bulk versions compute up to A values at a time, which only
+   depend on values computed earlier.  The runs are also split where
+   an index would wrap around the end of ra, so that all five indices
+   are contiguous and the loop can be vectorized. */
+
+static inline size_t
+gfsr4_run (const gfsr4_state_t * state, size_t n)
+{
+  const size_t s = (state->nd + 1) & M;
+  const size_t lag[4] = { A, B, C, D };
+  size_t m = (n < A) ? n : A;
+  size_t k;
+
+  if (m > M + 1 - s)
+    {
+      m = M + 1 - s;
+    }
+
+  for (k = 0; k < 4; k++)
+    {
+      const size_t t = (s + M + 1 - lag[k]) & M;
+
+      if (m > M + 1 - t)
+        {
+          m = M + 1 - t;
+        }
+    }
+
+  return m;
+}
+
+static void
+gfsr4_get_array (void *vstate, unsigned long int x[], size_t n)
+{
+  gfsr4_state_t *state = (gfsr4_state_t *) vstate;
+  unsigned long *const ra = state->ra;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      const size_t s = (state->nd + 1) & M;
+      const size_t m = gfsr4_run (state, n - i);
+      const unsigned long *a = ra + ((s + M + 1 - A) & M);
+      const unsigned long *b = ra + ((s + M + 1 - B) & M);
+      const unsigned long *c = ra + ((s + M + 1 - C) & M);
+      const unsigned long *d = ra + ((s + M + 1 - D) & M);
+      unsigned long *y = ra + s;
+      size_t j;
+
+      for (j = 0; j < m; j++)
+        {
+          y[j] = a[j] ^ b[j] ^ c[j] ^ d[j];
+          x[i + j] = y[j];
+        }
+
+      state->nd = s + m - 1;
+      i += m;
+    }
+}
+
+static void
+gfsr4_get_double_array (void *vstate, double x[], size_t n)
+{
+  gfsr4_state_t *state = (gfsr4_state_t *) vstate;
+  unsigned long *const ra = state->ra;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      const size_t s = (state->nd + 1) & M;
+      const size_t m = gfsr4_run (state, n - i);
+      const unsigned long *a = ra + ((s + M + 1 - A) & M);
+      const unsigned long *b = ra + ((s + M + 1 - B) & M);
+      const unsigned long *c = ra + ((s + M + 1 - C) & M);
+      const unsigned long *d = ra + ((s + M + 1 - D) & M);
+      unsigned long *y = ra + s;
+      size_t j;
+
+      for (j = 0; j < m; j++)
+        {
+          y[j] = a[j] ^ b[j] ^ c[j] ^ d[j];
+          x[i + j] = (unsigned int) y[j] / 4294967296.0;  /* y[j] < 2^32 */
+        }
+
+      state->nd = s + m - 1;
+      i += m;
+    }
+}
+
 static void
 gfsr4_set (void *vstate, unsigned long int s)
 {
@@ -155,7 +249,10 @@ static const gsl_rng_type gfsr4_type =
  sizeof (gfsr4_state_t),
  &gfsr4_set,
  &gfsr4_get,
- &gfsr4_get_double};
+ &gfsr4_get_double,
+ &gfsr4_get_array,
+ &gfsr4_get_double_array,
+ 0};
 
 const gsl_rng_type *gsl_rng_gfsr4 = &gfsr4_type;
 
@@ -45,6 +45,12 @@ typedef struct
     void (*set) (void *state, unsigned long int seed);
     unsigned long int (*get) (void *state);
     double (*get_double) (void *state);
+    /* optional, fill an array with the values of n calls to get or
+       get_double; null pointers fall back to calling those in a loop */
+    void (*get_array) (void *state, unsigned long int x[], size_t n);
+    void (*get_double_array) (void *state, double x[], size_t n);
+    /* optional, advance the state by 2^log2_steps calls to get */
+    int (*jump) (void *state, unsigned int log2_steps);
   }
 gsl_rng_type;
 
@@ -62,6 +68,7 @@ gsl_rng;
 GSL_VAR const gsl_rng_type *gsl_rng_borosh13;
 GSL_VAR const gsl_rng_type *gsl_rng_coveyou;
 GSL_VAR const gsl_rng_type *gsl_rng_cmrg;
+GSL_VAR const gsl_rng_type *gsl_rng_dsfmt19937;
 GSL_VAR const gsl_rng_type *gsl_rng_fishman18;
 GSL_VAR const gsl_rng_type *gsl_rng_fishman20;
 GSL_VAR const gsl_rng_type *gsl_rng_fishman2x;
@@ -75,6 +82,9 @@ GSL_VAR const gsl_rng_type *gsl_rng_mrg;
 GSL_VAR const gsl_rng_type *gsl_rng_mt19937;
 GSL_VAR const gsl_rng_type *gsl_rng_mt19937_1999;
 GSL_VAR const gsl_rng_type *gsl_rng_mt19937_1998;
+GSL_VAR const gsl_rng_type *gsl_rng_pcg64;
+GSL_VAR const gsl_rng_type *gsl_rng_philox4x32;
+GSL_VAR const gsl_rng_type *gsl_rng_philox4x64;
 GSL_VAR const gsl_rng_type *gsl_rng_r250;
 GSL_VAR const gsl_rng_type *gsl_rng_ran0;
 GSL_VAR const gsl_rng_type *gsl_rng_ran1;
@@ -110,16 +120,21 @@ GSL_VAR const gsl_rng_type *gsl_rng_ranlxs0;
 GSL_VAR const gsl_rng_type *gsl_rng_ranlxs1;
 GSL_VAR const gsl_rng_type *gsl_rng_ranlxs2;
 GSL_VAR const gsl_rng_type *gsl_rng_ranmar;
+GSL_VAR const gsl_rng_type *gsl_rng_sfmt19937;
 GSL_VAR const gsl_rng_type *gsl_rng_slatec;
+GSL_VAR const gsl_rng_type *gsl_rng_splitmix64;
 GSL_VAR const gsl_rng_type *gsl_rng_taus;
 GSL_VAR const gsl_rng_type *gsl_rng_taus2;
 GSL_VAR const gsl_rng_type *gsl_rng_taus113;
+GSL_VAR const gsl_rng_type *gsl_rng_threefry4x64;
 GSL_VAR const gsl_rng_type *gsl_rng_transputer;
 GSL_VAR const gsl_rng_type *gsl_rng_tt800;
 GSL_VAR const gsl_rng_type *gsl_rng_uni;
 GSL_VAR const gsl_rng_type *gsl_rng_uni32;
 GSL_VAR const gsl_rng_type *gsl_rng_vax;
 GSL_VAR const gsl_rng_type *gsl_rng_waterman14;
+GSL_VAR const gsl_rng_type *gsl_rng_xoroshiro128plus;
+GSL_VAR const gsl_rng_type *gsl_rng_xoshiro256starstar;
 GSL_VAR const gsl_rng_type *gsl_rng_zuf;
 
 const gsl_rng_type ** gsl_rng_types_setup(void);
@@ -148,6 +163,18 @@ void gsl_rng_print_state (const gsl_rng * r);
 
 const gsl_rng_type * gsl_rng_env_setup (void);
 
+void gsl_rng_get_array (const gsl_rng * r, unsigned long int x[], size_t n);
+void gsl_rng_uniform_array (const gsl_rng * r, double x[], size_t n);
+
+/* length of the substreams of gsl_rng_split, as a power of two */
+#define GSL_RNG_SPLIT_LOG2 64
+
+int gsl_rng_jump (const gsl_rng * r, unsigned int log2_steps);
+gsl_rng *gsl_rng_split (const gsl_rng * r);
+
+int gsl_rng_set_key (const gsl_rng * r, const unsigned long int key[], size_t n);
+int gsl_rng_set_counter (const gsl_rng * r, const unsigned long int counter[], size_t n);
+
 INLINE_DECL unsigned long int gsl_rng_get (const gsl_rng * r);
 INLINE_DECL double gsl_rng_uniform (const gsl_rng * r);
 INLINE_DECL double gsl_rng_uniform_pos (const gsl_rng * r);
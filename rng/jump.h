@@ -0,0 +1,252 @@
+/* rng/jump.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Jumps of 2^k steps for the generators whose step is a linear map,
+   by squaring the matrix of the map k times.  The Tausworthe
+   components are linear maps of 32-bit words over GF(2), and the
+   multiple recursive generators linear maps of small vectors modulo a
+   prime below 2^31, whose products fit in 64 bits. */
+
+#include <stdint.h>
+
+/* Return z after 2^k steps of the Tausworthe component step, which
+   has a primitive characteristic polynomial of degree deg.  The
+   sequence of words then has period 2^deg - 1, so that 2^deg steps
+   are the same as one and k can be taken modulo deg. */
+
+static inline unsigned long int
+jump_gf2 (unsigned long int (*step) (unsigned long int),
+          unsigned long int z, unsigned int k, unsigned int deg)
+{
+  unsigned long int col[32], sq[32], y = 0;
+  unsigned int i, j;
+
+  if (k >= deg)
+    {
+      k %= deg;
+    }
+
+  /* the columns of the matrix of one step */
+
+  for (j = 0; j < 32; j++)
+    {
+      col[j] = step (1UL << j);
+    }
+
+  for (; k > 0; k--)
+    {
+      for (j = 0; j < 32; j++)
+        {
+          unsigned long int v = col[j], w = 0;
+
+          for (i = 0; v != 0; i++, v >>= 1)
+            {
+              if (v & 1)
+                w ^= col[i];
+            }
+
+          sq[j] = w;
+        }
+
+      for (j = 0; j < 32; j++)
+        {
+          col[j] = sq[j];
+        }
+    }
+
+  for (i = 0; z != 0; i++, z >>= 1)
+    {
+      if (z & 1)
+        y ^= col[i];
+    }
+
+  return y;
+}
+
+/* Replace the n-by-n matrix a (n <= 5, row major, entries in [0,m))
+   by a^(2^k) mod m */
+
+static inline void
+jump_matrix_mod (uint64_t a[], const size_t n, const uint64_t m,
+                 unsigned int k)
+{
+  uint64_t b[25];
+  size_t i, j, l;
+
+  for (; k > 0; k--)
+    {
+      for (i = 0; i < n; i++)
+        {
+          for (j = 0; j < n; j++)
+            {
+              uint64_t s = 0;
+
+              for (l = 0; l < n; l++)
+                {
+                  s = (s + (a[i * n + l] * a[l * n + j]) % m) % m;
+                }
+
+              b[i * n + j] = s;
+            }
+        }
+
+      for (i = 0; i < n * n; i++)
+        {
+          a[i] = b[i];
+        }
+    }
+}
+
+/* Replace the vector x by a x mod m */
+
+static inline void
+jump_matrix_apply (const uint64_t a[], const size_t n, const uint64_t m,
+                   uint64_t x[])
+{
+  uint64_t y[5];
+  size_t i, l;
+
+  for (i = 0; i < n; i++)
+    {
+      uint64_t s = 0;
+
+      for (l = 0; l < n; l++)
+        {
+          s = (s + (a[i * n + l] * x[l]) % m) % m;
+        }
+
+      y[i] = s;
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      x[i] = y[i];
+    }
+}
+
+/* Jump the state s[] of nw 64-bit words (nw <= 4) of a generator whose
+   step is a linear map over GF(2) with a primitive characteristic
+   polynomial p(t) of degree 64 nw, as for the xorshift family.  p(t)
+   is found by the Berlekamp-Massey algorithm from the low bit of the
+   first word in the steps from a fixed state, then g(t) = t^(2^k) mod
+   p(t) by squaring (k modulo 64 nw, since t^(2^deg) = t), and the new
+   state is g(T) s = sum_i g_i T^i s. */
+
+#define JUMP_GF2_MAXDEG 256
+
+static inline void
+jump_gf2_poly (void (*step) (uint64_t s[]), uint64_t s[], const size_t nw,
+               unsigned int k)
+{
+  const size_t n = 64 * nw;
+  unsigned char x[2 * JUMP_GF2_MAXDEG], c[2 * JUMP_GF2_MAXDEG + 1];
+  unsigned char b[2 * JUMP_GF2_MAXDEG + 1], t[2 * JUMP_GF2_MAXDEG + 1];
+  unsigned char p[JUMP_GF2_MAXDEG + 1], g[2 * JUMP_GF2_MAXDEG];
+  uint64_t u[4] = { 1, 0, 0, 0 }, acc[4] = { 0, 0, 0, 0 };
+  size_t i, j, L = 0, m = 1;
+
+  for (i = 0; i < 2 * n; i++)
+    {
+      step (u);
+      x[i] = (unsigned char) (u[0] & 1);
+    }
+
+  /* Berlekamp-Massey, giving the connection polynomial c(t) of degree
+     L = n, with p(t) = t^n c(1/t) */
+
+  for (j = 0; j <= 2 * n; j++)
+    c[j] = b[j] = 0;
+
+  c[0] = b[0] = 1;
+
+  for (i = 0; i < 2 * n; i++)
+    {
+      unsigned char d = x[i];
+
+      for (j = 1; j <= L; j++)
+        d ^= c[j] & x[i - j];
+
+      if (d == 0)
+        {
+          m++;
+        }
+      else if (2 * L <= i)
+        {
+          for (j = 0; j <= 2 * n; j++)
+            t[j] = c[j];
+
+          for (j = 0; j + m <= 2 * n; j++)
+            c[j + m] ^= b[j];
+
+          L = i + 1 - L;
+
+          for (j = 0; j <= 2 * n; j++)
+            b[j] = t[j];
+
+          m = 1;
+        }
+      else
+        {
+          for (j = 0; j + m <= 2 * n; j++)
+            c[j + m] ^= b[j];
+
+          m++;
+        }
+    }
+
+  for (j = 0; j <= n; j++)
+    p[j] = c[n - j];
+
+  /* g = t, squared k times modulo p */
+
+  for (j = 0; j < 2 * n; j++)
+    g[j] = 0;
+
+  g[1] = 1;
+
+  for (k %= n; k > 0; k--)
+    {
+      for (j = n; j-- > 0;)
+        {
+          g[2 * j] = g[j];
+          g[2 * j + 1] = 0;
+        }
+
+      for (j = 2 * n - 2; j >= n; j--)
+        {
+          if (g[j])
+            {
+              for (i = 0; i <= n; i++)
+                g[j - n + i] ^= p[i];
+            }
+        }
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      if (g[i])
+        {
+          for (j = 0; j < nw; j++)
+            acc[j] ^= s[j];
+        }
+
+      step (s);
+    }
+
+  for (j = 0; j < nw; j++)
+    s[j] = acc[j];
+}
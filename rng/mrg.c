@@ -19,7 +19,9 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_rng.h>
+#include "jump.h"
 
 /* This is a fifth-order multiple recursive generator. The sequence is,
 
@@ -53,6 +55,7 @@
 static inline unsigned long int mrg_get (void *vstate);
 static double mrg_get_double (void *vstate);
 static void mrg_set (void *state, unsigned long int s);
+static int mrg_jump (void *vstate, unsigned int log2_steps);
 
 static const long int m = 2147483647;
 static const long int a1 = 107374182, q1 = 20, r1 = 7;
@@ -101,6 +104,37 @@ mrg_get_double (void *vstate)
 }
 
 
+/* One step maps (x1, ..., x5) to (a1 x1 + a5 x5, x1, ..., x4) mod m */
+
+static int
+mrg_jump (void *vstate, unsigned int log2_steps)
+{
+  mrg_state_t *state = (mrg_state_t *) vstate;
+  uint64_t a[25] = { 0 }, x[5];
+
+  a[0] = a1;
+  a[4] = a5;
+  a[5] = a[11] = a[17] = a[23] = 1;
+
+  jump_matrix_mod (a, 5, m, log2_steps);
+
+  x[0] = state->x1;
+  x[1] = state->x2;
+  x[2] = state->x3;
+  x[3] = state->x4;
+  x[4] = state->x5;
+
+  jump_matrix_apply (a, 5, m, x);
+
+  state->x1 = x[0];
+  state->x2 = x[1];
+  state->x3 = x[2];
+  state->x4 = x[3];
+  state->x5 = x[4];
+
+  return GSL_SUCCESS;
+}
+
 static void
 mrg_set (void *vstate, unsigned long int s)
 {
@@ -144,6 +178,9 @@ static const gsl_rng_type mrg_type =
  sizeof (mrg_state_t),
  &mrg_set,
  &mrg_get,
- &mrg_get_double};
+ &mrg_get_double,
+ 0,
+ 0,
+ &mrg_jump};
 
 const gsl_rng_type *gsl_rng_mrg = &mrg_type;
@@ -0,0 +1,154 @@
+/* rng/mt-charpoly.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* The characteristic polynomial p(t) of the MT19937 recurrence over
+   GF(2), of degree 19937, for the jumps of mt.c.  Bit i of the table,
+   in word i / 32, is the coefficient of t^i.  It was found by the
+   Berlekamp-Massey algorithm from 2 x 19937 words of the sequence
+   with seed 4357.  This file is generated and should not be edited by
+   hand. */
+
+#define MT_CHARPOLY_WORDS 624
+
+static const unsigned long int mt_charpoly[MT_CHARPOLY_WORDS] =
+{
+  0x00000001UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000020UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000100UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00020000UL,
+  0x00000000UL, 0x00000800UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00004000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x20000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00200000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x01000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x08000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x40000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000002UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000010UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000080UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000400UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00020000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x20000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000002UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000200UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x02000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00200000UL, 0x00000000UL,
+  0x00000020UL, 0x80000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000100UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000800UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00004000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000002UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00002000UL,
+  0x00000000UL, 0x00020000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00010000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000020UL,
+  0x00000000UL, 0x00000200UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000100UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00020000UL, 0x00000000UL, 0x00200800UL, 0x00000000UL,
+  0x00008000UL, 0x00000000UL, 0x00000000UL, 0x02000000UL, 0x00000000UL,
+  0x01004000UL, 0x00000000UL, 0x00000000UL, 0x20000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x08000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000021UL, 0x00000000UL, 0x00000000UL, 0x40000000UL,
+  0x00000000UL, 0x00000200UL, 0x00000000UL, 0x00000100UL, 0x20000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00200000UL, 0x00000000UL,
+  0x00008000UL, 0x00000000UL, 0x00000200UL, 0x00000000UL, 0x00000000UL,
+  0x21000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00001000UL,
+  0x00000000UL, 0x00000002UL, 0x08000000UL, 0x00000001UL, 0x00200000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000200UL, 0x40000000UL,
+  0x00000008UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00020000UL, 0x00000000UL, 0x00000042UL, 0x08000000UL, 0x00000000UL,
+  0x00200000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000010UL,
+  0x00000000UL, 0x00000000UL, 0x21000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000080UL, 0x00000000UL, 0x00000002UL, 0x00000000UL,
+  0x00000001UL, 0x00200000UL, 0x00000000UL, 0x00000400UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00002000UL, 0x00000000UL, 0x00000080UL, 0x00000000UL, 0x00000002UL,
+  0x00000000UL, 0x00000000UL, 0x00210000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000010UL, 0x00000000UL, 0x00000000UL, 0x01080000UL,
+  0x00000000UL, 0x00002000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000002UL, 0x08400000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000200UL, 0x42000000UL, 0x00000000UL,
+  0x00080000UL, 0x00000000UL, 0x00002000UL, 0x00000000UL, 0x00000000UL,
+  0x10000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00210000UL,
+  0x00000000UL, 0x00000000UL, 0x80000000UL, 0x00000000UL, 0x02000000UL,
+  0x00000000UL, 0x01000000UL, 0x00000000UL, 0x00002000UL, 0x00000000UL,
+  0x00000004UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000020UL, 0x80000000UL, 0x00000000UL,
+  0x02000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00002100UL,
+  0x00000000UL, 0x00000000UL, 0x10000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00010800UL, 0x00000000UL, 0x00000020UL, 0x00000000UL,
+  0x00000000UL, 0x02000000UL, 0x00000000UL, 0x00084000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00420000UL, 0x00000000UL, 0x00000800UL, 0x00000000UL, 0x00000020UL,
+  0x00000000UL, 0x00000000UL, 0x00100000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000100UL, 0x00000000UL, 0x00000000UL, 0x00800000UL,
+  0x00000000UL, 0x00020000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000020UL, 0x04000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x20000000UL, 0x00000000UL,
+  0x00800000UL, 0x00000000UL, 0x00020000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000001UL, 0x00000000UL, 0x00000000UL, 0x00100000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000008UL, 0x20000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000040UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000200UL, 0x00000000UL, 0x00000008UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00001000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00008000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00040000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000000UL,
+  0x00000000UL, 0x00000000UL, 0x00000000UL, 0x00000002UL
+};
@@ -53,11 +53,20 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <stdint.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_rng.h>
+#include "vectorize.h"
+#include "mt-charpoly.h"
 
 static inline unsigned long int mt_get (void *vstate);
 static double mt_get_double (void *vstate);
 static void mt_set (void *state, unsigned long int s);
+static int mt_jump (void *vstate, unsigned int log2_steps) GSL_VECTORIZE;
+static void mt_get_array (void *vstate, unsigned long int x[], size_t n)
+  GSL_VECTORIZE;
+static void mt_get_double_array (void *vstate, double x[], size_t n)
+  GSL_VECTORIZE;
 
 #define N 624   /* Period parameters */
 #define M 397
@@ -75,46 +84,59 @@ typedef struct
   }
 mt_state_t;
 
-static inline unsigned long
-mt_get (void *vstate)
-{
-  mt_state_t *state = (mt_state_t *) vstate;
+static void mt_generate (mt_state_t * state) GSL_VECTORIZE;
 
-  unsigned long k ;
+static void
+mt_generate (mt_state_t * state)
+{
+  /* generate N words at one time */
   unsigned long int *const mt = state->mt;
+  int kk;
 
 #define MAGIC(y) (((y)&0x1) ? 0x9908b0dfUL : 0)
 
-  if (state->mti >= N)
-    {   /* generate N words at one time */
-      int kk;
+  for (kk = 0; kk < N - M; kk++)
+    {
+      unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+      mt[kk] = mt[kk + M] ^ (y >> 1) ^ MAGIC(y);
+    }
+  for (; kk < N - 1; kk++)
+    {
+      unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+      mt[kk] = mt[kk + (M - N)] ^ (y >> 1) ^ MAGIC(y);
+    }
 
-      for (kk = 0; kk < N - M; kk++)
-        {
-          unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-          mt[kk] = mt[kk + M] ^ (y >> 1) ^ MAGIC(y);
-        }
-      for (; kk < N - 1; kk++)
-        {
-          unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-          mt[kk] = mt[kk + (M - N)] ^ (y >> 1) ^ MAGIC(y);
-        }
+  {
+    unsigned long y = (mt[N - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
+    mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ MAGIC(y);
+  }
+
+  state->mti = 0;
+}
+
+/* Tempering */
 
-      {
-        unsigned long y = (mt[N - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
-        mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ MAGIC(y);
-      }
+#define TEMPER(k) do {                   \
+    k ^= (k >> 11);                      \
+    k ^= (k << 7) & 0x9d2c5680UL;        \
+    k ^= (k << 15) & 0xefc60000UL;       \
+    k ^= (k >> 18);                      \
+  } while (0)
 
-      state->mti = 0;
+static inline unsigned long
+mt_get (void *vstate)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+
+  unsigned long k ;
+
+  if (state->mti >= N)
+    {
+      mt_generate (state);
     }
 
-  /* Tempering */
-  
-  k = mt[state->mti];
-  k ^= (k >> 11);
-  k ^= (k << 7) & 0x9d2c5680UL;
-  k ^= (k << 15) & 0xefc60000UL;
-  k ^= (k >> 18);
+  k = state->mt[state->mti];
+  TEMPER (k);
 
   state->mti++;
 
@@ -127,6 +149,84 @@ mt_get_double (void * vstate)
   return mt_get (vstate) / 4294967296.0 ;
 }
 
+/* The bulk versions temper the rest of the current block of N words
+   in a loop without dependencies between iterations, which the
+   compiler can vectorize, and generate a new block as needed. */
+
+static void
+mt_get_array (void *vstate, unsigned long int x[], size_t n)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      const unsigned long int *mt;
+      size_t j, m;
+
+      if (state->mti >= N)
+        {
+          mt_generate (state);
+        }
+
+      mt = state->mt + state->mti;
+      m = N - state->mti;
+
+      if (m > n - i)
+        {
+          m = n - i;
+        }
+
+      for (j = 0; j < m; j++)
+        {
+          unsigned long k = mt[j];
+          TEMPER (k);
+          x[i + j] = k;
+        }
+
+      state->mti += m;
+      i += m;
+    }
+}
+
+static void
+mt_get_double_array (void *vstate, double x[], size_t n)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      const unsigned long int *mt;
+      size_t j, m;
+
+      if (state->mti >= N)
+        {
+          mt_generate (state);
+        }
+
+      mt = state->mt + state->mti;
+      m = N - state->mti;
+
+      if (m > n - i)
+        {
+          m = n - i;
+        }
+
+      for (j = 0; j < m; j++)
+        {
+          unsigned long k = mt[j];
+          TEMPER (k);
+          /* k < 2^32, and the conversion of a 32-bit integer can
+             be vectorized without AVX-512DQ */
+          x[i + j] = (unsigned int) k / 4294967296.0;
+        }
+
+      state->mti += m;
+      i += m;
+    }
+}
+
 static void
 mt_set (void *vstate, unsigned long int s)
 {
@@ -204,6 +304,221 @@ mt_1998_set (void *vstate, unsigned long int s)
   state->mti = i;
 }
 
+/* Jumps.  The words x_0, x_1, ... of the sequence starting at the
+   first word of the state array satisfy the linear recurrence whose
+   characteristic polynomial p(t) over GF(2) has degree 19937 (the
+   first word contributes only its top bit to the state).  With
+   g(t) = t^J mod p(t), the state array J steps later is therefore
+
+     mt'[j] = sum_i g_i x_(i+j),   j = 0 ... N-1,
+
+   and mti is unchanged.  p(t) is the table of mt-charpoly.h, and
+   t^(2^k) mod p(t) is found by squaring t k times.  Since p(t) is
+   primitive, t^(2^19937) = t mod p(t) and k can be taken modulo 19937.
+   A jump costs about half a millisecond for each squaring. */
+
+#define DEG 19937
+#define PW ((DEG + 63) / 64)    /* words of a polynomial of degree < DEG */
+
+/* the words x_0 ... x_(len-1) of the sequence from the state array */
+
+static void
+mt_sequence (const unsigned long int mt[], uint32_t x[], size_t len)
+{
+  size_t j;
+
+  for (j = 0; j < N; j++)
+    {
+      x[j] = (uint32_t) mt[j];
+    }
+
+  for (; j < len; j++)
+    {
+      uint32_t y = (x[j - N] & UPPER_MASK) | (x[j - N + 1] & LOWER_MASK);
+      x[j] = x[j - N + M] ^ (y >> 1) ^ MAGIC(y);
+    }
+}
+
+/* c = c + b t^m, for b of the given number of words */
+
+static inline void
+mt_add_shifted (uint64_t c[], const uint64_t b[], size_t nb, size_t m)
+{
+  const size_t q = m / 64, s = m % 64;
+  size_t w;
+
+  if (s == 0)
+    {
+      for (w = 0; w < nb; w++)
+        c[q + w] ^= b[w];
+    }
+  else
+    {
+      for (w = 0; w < nb; w++)
+        {
+          c[q + w] ^= b[w] << s;
+          c[q + w + 1] ^= b[w] >> (64 - s);
+        }
+    }
+}
+
+/* spread the 32 bits of v to the even bits of a 64-bit word, which
+   squares a polynomial over GF(2) */
+
+static inline uint64_t
+mt_spread (uint64_t v)
+{
+  v &= 0xffffffffUL;
+  v = (v | (v << 16)) & (((uint64_t) 0x0000ffffUL << 32) | 0x0000ffffUL);
+  v = (v | (v << 8)) & (((uint64_t) 0x00ff00ffUL << 32) | 0x00ff00ffUL);
+  v = (v | (v << 4)) & (((uint64_t) 0x0f0f0f0fUL << 32) | 0x0f0f0f0fUL);
+  v = (v | (v << 2)) & (((uint64_t) 0x33333333UL << 32) | 0x33333333UL);
+  v = (v | (v << 1)) & (((uint64_t) 0x55555555UL << 32) | 0x55555555UL);
+  return v;
+}
+
+/* g = g^2 mod p, where ps[s] is p t^s for s = 0 ... 63 */
+
+static void mt_square_mod (uint64_t g[], const uint64_t *ps, uint64_t sq[])
+  GSL_VECTORIZE;
+
+static void
+mt_square_mod (uint64_t g[], const uint64_t *ps, uint64_t sq[])
+{
+  size_t w, d;
+
+  for (w = 0; w < PW; w++)
+    {
+      sq[2 * w] = mt_spread (g[w]);
+      sq[2 * w + 1] = mt_spread (g[w] >> 32);
+    }
+
+  for (d = 2 * DEG - 2; d >= DEG; d--)
+    {
+      if (sq[d / 64] == 0)
+        {
+          d -= d % 64;          /* skip the rest of a zero word */
+          continue;
+        }
+
+      if ((sq[d / 64] >> (d % 64)) & 1)
+        {
+          const size_t e = d - DEG;
+          const uint64_t *q = ps + (e % 64) * (PW + 1);
+          uint64_t *s = sq + e / 64;
+
+          for (w = 0; w < PW + 1; w++)
+            s[w] ^= q[w];
+        }
+    }
+
+  for (w = 0; w < PW; w++)
+    g[w] = sq[w];
+}
+
+static int
+mt_jump (void *vstate, unsigned int log2_steps)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+  const size_t nx = N + DEG;
+  unsigned int k = log2_steps % DEG;
+  uint32_t *x, acc[N];
+  uint64_t *g, *sq, *ps, *p;
+  size_t i, j;
+
+  x = (uint32_t *) malloc (nx * sizeof (uint32_t));
+
+  if (x == 0)
+    {
+      GSL_ERROR ("failed to allocate space for sequence", GSL_ENOMEM);
+    }
+
+  if (k < 15)
+    {
+      /* 2^k < DEG, so g(t) = t^(2^k) and the new state array is part
+         of the sequence */
+
+      const size_t J = (size_t) 1 << k;
+
+      mt_sequence (state->mt, x, J + N);
+
+      for (j = 0; j < N; j++)
+        state->mt[j] = x[J + j];
+
+      free (x);
+      return GSL_SUCCESS;
+    }
+
+  /* g, its square, the shifts of p and p */
+
+  g = (uint64_t *) malloc ((PW + 2 * PW + 64 * (PW + 1) + PW + 1)
+                           * sizeof (uint64_t));
+
+  if (g == 0)
+    {
+      free (x);
+      GSL_ERROR ("failed to allocate space for polynomials", GSL_ENOMEM);
+    }
+
+  sq = g + PW;
+  ps = sq + 2 * PW;
+  p = ps + 64 * (PW + 1);
+
+  for (j = 0; j < PW + 1; j++)
+    p[j] = 0;
+
+  for (j = 0; j < MT_CHARPOLY_WORDS; j++)
+    p[j / 2] |= (uint64_t) mt_charpoly[j] << (32 * (j % 2));
+
+  for (i = 0; i < 64; i++)
+    {
+      uint64_t *q = ps + i * (PW + 1);
+
+      for (j = 0; j < PW + 1; j++)
+        q[j] = 0;
+
+      mt_add_shifted (q, p, PW, i);
+    }
+
+  /* g = t^(2^14), then square */
+
+  for (j = 0; j < PW; j++)
+    g[j] = 0;
+
+  g[(1 << 14) / 64] = (uint64_t) 1 << ((1 << 14) % 64);
+
+  for (i = 14; i < k; i++)
+    {
+      mt_square_mod (g, ps, sq);
+    }
+
+  /* the new state array */
+
+  mt_sequence (state->mt, x, DEG + N);
+
+  for (j = 0; j < N; j++)
+    acc[j] = 0;
+
+  for (i = 0; i < DEG; i++)
+    {
+      if ((g[i / 64] >> (i % 64)) & 1)
+        {
+          const uint32_t *xi = x + i;
+
+          for (j = 0; j < N; j++)
+            acc[j] ^= xi[j];
+        }
+    }
+
+  for (j = 0; j < N; j++)
+    state->mt[j] = acc[j];
+
+  free (g);
+  free (x);
+
+  return GSL_SUCCESS;
+}
+
 static const gsl_rng_type mt_type =
 {"mt19937",                     /* name */
  0xffffffffUL,                  /* RAND_MAX  */
@@ -211,7 +526,10 @@ static const gsl_rng_type mt_type =
  sizeof (mt_state_t),
  &mt_set,
  &mt_get,
- &mt_get_double};
+ &mt_get_double,
+ &mt_get_array,
+ &mt_get_double_array,
+ &mt_jump};
 
 static const gsl_rng_type mt_1999_type =
 {"mt19937_1999",                /* name */
@@ -220,7 +538,10 @@ static const gsl_rng_type mt_1999_type =
  sizeof (mt_state_t),
  &mt_1999_set,
  &mt_get,
- &mt_get_double};
+ &mt_get_double,
+ &mt_get_array,
+ &mt_get_double_array,
+ &mt_jump};
 
 static const gsl_rng_type mt_1998_type =
 {"mt19937_1998",                /* name */
@@ -229,7 +550,10 @@ static const gsl_rng_type mt_1998_type =
  sizeof (mt_state_t),
  &mt_1998_set,
  &mt_get,
- &mt_get_double};
+ &mt_get_double,
+ &mt_get_array,
+ &mt_get_double_array,
+ &mt_jump};
 
 const gsl_rng_type *gsl_rng_mt19937 = &mt_type;
 const gsl_rng_type *gsl_rng_mt19937_1999 = &mt_1999_type;
@@ -0,0 +1,177 @@
+/* rng/pcg.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the PCG64 generator of O'Neill (PCG XSL RR 128/64), a
+   128-bit linear congruential generator
+
+     x_n = (a x_{n-1} + c) mod 2^128
+
+   whose output is the exclusive or of the two halves of x_n rotated
+   right by the top 6 bits of x_n.  The period is 2^128.  The
+   multiplier a = 0x2360ed051fc65da44385df649fccf645 and increment
+   c = 0x5851f42d4c957f2d14057b7ef767814f are the defaults of the
+   reference implementation, and the seed s is used as in its
+   pcg64_srandom_r (x_0 = 0, one step, add s, one step), so that the
+   sequences are those of pcg64_oneseq_128_xsl_rr_64 in the reference
+   library.  gsl_rng_get returns the top 32 bits of each output, and
+   gsl_rng_uniform the top 53 bits divided by 2^53.  A jump of 2^k
+   steps squares the affine map of one step k times.
+
+   From: Melissa E. O'Neill, "PCG: A Family of Simple Fast
+   Space-Efficient Statistically Good Algorithms for Random Number
+   Generation", Harvey Mudd College technical report HMC-CS-2014-0905
+   (2014). */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+
+#define U64(hi,lo) (((uint64_t) (hi) << 32) | (uint64_t) (lo))
+
+typedef struct
+  {
+    uint64_t hi, lo;
+  }
+pcg128_t;
+
+typedef struct
+  {
+    pcg128_t x;
+  }
+pcg64_state_t;
+
+static const pcg128_t pcg_mult = { U64 (0x2360ed05UL, 0x1fc65da4UL),
+                                   U64 (0x4385df64UL, 0x9fccf645UL) };
+static const pcg128_t pcg_inc = { U64 (0x5851f42dUL, 0x4c957f2dUL),
+                                  U64 (0x14057b7eUL, 0xf767814fUL) };
+
+static inline pcg128_t
+pcg_add (const pcg128_t a, const pcg128_t b)
+{
+  pcg128_t r;
+  r.lo = a.lo + b.lo;
+  r.hi = a.hi + b.hi + (r.lo < a.lo);
+  return r;
+}
+
+/* the low 128 bits of a b */
+
+static inline pcg128_t
+pcg_mul (const pcg128_t a, const pcg128_t b)
+{
+  pcg128_t r;
+#if defined(__SIZEOF_INT128__)
+  __extension__ typedef unsigned __int128 uint128;
+  const uint128 p = (uint128) a.lo * b.lo;
+  r.lo = (uint64_t) p;
+  r.hi = (uint64_t) (p >> 64) + a.hi * b.lo + a.lo * b.hi;
+#else
+  const uint64_t a0 = a.lo & 0xffffffffUL, a1 = a.lo >> 32;
+  const uint64_t b0 = b.lo & 0xffffffffUL, b1 = b.lo >> 32;
+  const uint64_t p01 = a0 * b1, p10 = a1 * b0;
+  const uint64_t mid = ((a0 * b0) >> 32) + (p01 & 0xffffffffUL)
+    + (p10 & 0xffffffffUL);
+  r.lo = a.lo * b.lo;
+  r.hi = a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32)
+    + a.hi * b.lo + a.lo * b.hi;
+#endif
+  return r;
+}
+
+static inline uint64_t
+pcg64_next (pcg64_state_t * state)
+{
+  uint64_t x;
+  unsigned int rot;
+
+  state->x = pcg_add (pcg_mul (state->x, pcg_mult), pcg_inc);
+
+  x = state->x.hi ^ state->x.lo;
+  rot = (unsigned int) (state->x.hi >> 58);
+
+  return (x >> rot) | (x << ((64 - rot) & 63));
+}
+
+static unsigned long int
+pcg64_get (void *vstate)
+{
+  return (unsigned long int) (pcg64_next ((pcg64_state_t *) vstate) >> 32);
+}
+
+static double
+pcg64_get_double (void *vstate)
+{
+  const uint64_t x = pcg64_next ((pcg64_state_t *) vstate);
+  return (int64_t) (x >> 11) / 9007199254740992.0;
+}
+
+static void
+pcg64_set (void *vstate, unsigned long int s)
+{
+  pcg64_state_t *state = (pcg64_state_t *) vstate;
+  pcg128_t seed;
+
+  seed.hi = 0;
+  seed.lo = s;
+
+  state->x.hi = 0;
+  state->x.lo = 0;
+  pcg64_next (state);
+  state->x = pcg_add (state->x, seed);
+  pcg64_next (state);
+}
+
+/* The map x -> a x + c applied 2^k times is x -> A x + C, found by
+   squaring: (A, C) -> (A^2, (A + 1) C) */
+
+static int
+pcg64_jump (void *vstate, unsigned int log2_steps)
+{
+  pcg64_state_t *state = (pcg64_state_t *) vstate;
+  pcg128_t A = pcg_mult, C = pcg_inc;
+  const pcg128_t one = { 0, 1 };
+  unsigned int k;
+
+  for (k = 0; k < log2_steps && k < 128; k++)
+    {
+      C = pcg_mul (pcg_add (A, one), C);
+      A = pcg_mul (A, A);
+    }
+
+  if (log2_steps < 128)
+    {
+      state->x = pcg_add (pcg_mul (A, state->x), C);
+    }
+
+  return GSL_SUCCESS;
+}
+
+static const gsl_rng_type pcg64_type =
+{"pcg64",                       /* name */
+ 0xffffffffUL,                  /* RAND_MAX */
+ 0,                             /* RAND_MIN */
+ sizeof (pcg64_state_t),
+ &pcg64_set,
+ &pcg64_get,
+ &pcg64_get_double,
+ 0,
+ 0,
+ &pcg64_jump};
+
+const gsl_rng_type *gsl_rng_pcg64 = &pcg64_type;
@@ -0,0 +1,245 @@
+/* rng/philox.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* These are the counter-based generators Philox4x32-10 and
+   Philox4x64-10 of Salmon, Moraes, Dror and Shaw.  Each block of four
+   32-bit or 64-bit words is computed from a 128-bit or 256-bit counter
+   by ten rounds of multiplications and exclusive ors keyed by a 64-bit
+   or 128-bit key, and successive blocks use successive counters.  The
+   key selects one of 2^64 (2^128) independent streams, and the
+   counter gives the position in the stream directly, see
+   gsl_rng_set_key() and gsl_rng_set_counter().  The blocks match the
+   known answer tests of the Random123 library.
+
+   From: John K. Salmon, Mark A. Moraes, Ron O. Dror and David
+   E. Shaw, "Parallel Random Numbers: As Easy as 1, 2, 3", Proceedings
+   of the International Conference for High Performance Computing,
+   Networking, Storage and Analysis (SC11), 2011. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include "vectorize.h"
+#include "counter.h"
+
+#define PHILOX_ROUNDS 10
+
+/* Philox4x32: the blocks are computed in parallel, one lane each, and
+   the 32x32-bit products fit in 64 bits */
+
+#define M4x32_0 0xD2511F53UL
+#define M4x32_1 0xCD9E8D57UL
+#define W32_0 0x9E3779B9UL
+#define W32_1 0xBB67AE85UL
+
+static void philox4x32_blocks (const uint64_t key[4], uint64_t ctr[4],
+                               uint64_t y[], size_t nb) GSL_VECTORIZE;
+
+static void
+philox4x32_blocks (const uint64_t key[4], uint64_t ctr[4], uint64_t y[],
+                   size_t nb)
+{
+  uint32_t x0[COUNTER_BLOCKS], x1[COUNTER_BLOCKS];
+  uint32_t x2[COUNTER_BLOCKS], x3[COUNTER_BLOCKS];
+  uint32_t k0 = (uint32_t) key[0], k1 = (uint32_t) key[1];
+  size_t l;
+  int r;
+
+  if (ctr[0] <= 0xffffffffUL - nb)
+    {
+      /* no carry out of the low word */
+
+      for (l = 0; l < nb; l++)
+        {
+          x0[l] = (uint32_t) (ctr[0] + l);
+          x1[l] = (uint32_t) ctr[1];
+          x2[l] = (uint32_t) ctr[2];
+          x3[l] = (uint32_t) ctr[3];
+        }
+
+      ctr[0] += nb;
+    }
+  else
+    {
+      for (l = 0; l < nb; l++)
+        {
+          x0[l] = (uint32_t) ctr[0];
+          x1[l] = (uint32_t) ctr[1];
+          x2[l] = (uint32_t) ctr[2];
+          x3[l] = (uint32_t) ctr[3];
+          counter_increment (ctr, 0xffffffffUL);
+        }
+    }
+
+  for (r = 0; r < PHILOX_ROUNDS; r++)
+    {
+      for (l = 0; l < nb; l++)
+        {
+          const uint64_t p0 = (uint64_t) M4x32_0 * x0[l];
+          const uint64_t p1 = (uint64_t) M4x32_1 * x2[l];
+
+          x0[l] = (uint32_t) (p1 >> 32) ^ x1[l] ^ k0;
+          x1[l] = (uint32_t) p1;
+          x2[l] = (uint32_t) (p0 >> 32) ^ x3[l] ^ k1;
+          x3[l] = (uint32_t) p0;
+        }
+
+      k0 += (uint32_t) W32_0;
+      k1 += (uint32_t) W32_1;
+    }
+
+  for (l = 0; l < nb; l++)
+    {
+      y[4 * l] = x0[l];
+      y[4 * l + 1] = x1[l];
+      y[4 * l + 2] = x2[l];
+      y[4 * l + 3] = x3[l];
+    }
+}
+
+/* Philox4x64: the high half of the 64x64-bit products uses a 128-bit
+   type where the compiler has one */
+
+#define M4x64_0 (((uint64_t) 0xD2E7470EUL << 32) | 0xE14C6C93UL)
+#define M4x64_1 (((uint64_t) 0xCA5A8263UL << 32) | 0x95121157UL)
+#define W64_0 (((uint64_t) 0x9E3779B9UL << 32) | 0x7F4A7C15UL)
+#define W64_1 (((uint64_t) 0xBB67AE85UL << 32) | 0x84CAA73BUL)
+
+static inline uint64_t
+mulhi64 (const uint64_t a, const uint64_t b)
+{
+#if defined(__SIZEOF_INT128__)
+  __extension__ typedef unsigned __int128 uint128;
+  return (uint64_t) (((uint128) a * b) >> 64);
+#else
+  const uint64_t a0 = a & 0xffffffffUL, a1 = a >> 32;
+  const uint64_t b0 = b & 0xffffffffUL, b1 = b >> 32;
+  const uint64_t p01 = a0 * b1, p10 = a1 * b0;
+  const uint64_t mid = ((a0 * b0) >> 32) + (p01 & 0xffffffffUL)
+    + (p10 & 0xffffffffUL);
+  return a1 * b1 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+#endif
+}
+
+static void philox4x64_blocks (const uint64_t key[4], uint64_t ctr[4],
+                               uint64_t y[], size_t nb) GSL_VECTORIZE;
+
+static void
+philox4x64_blocks (const uint64_t key[4], uint64_t ctr[4], uint64_t y[],
+                   size_t nb)
+{
+  uint64_t x0[COUNTER_BLOCKS], x1[COUNTER_BLOCKS];
+  uint64_t x2[COUNTER_BLOCKS], x3[COUNTER_BLOCKS];
+  uint64_t k0 = key[0], k1 = key[1];
+  size_t l;
+  int r;
+
+  if (ctr[0] <= ~(uint64_t) 0 - nb)
+    {
+      for (l = 0; l < nb; l++)
+        {
+          x0[l] = ctr[0] + l;
+          x1[l] = ctr[1];
+          x2[l] = ctr[2];
+          x3[l] = ctr[3];
+        }
+
+      ctr[0] += nb;
+    }
+  else
+    {
+      for (l = 0; l < nb; l++)
+        {
+          x0[l] = ctr[0];
+          x1[l] = ctr[1];
+          x2[l] = ctr[2];
+          x3[l] = ctr[3];
+          counter_increment (ctr, ~(uint64_t) 0);
+        }
+    }
+
+  for (r = 0; r < PHILOX_ROUNDS; r++)
+    {
+      for (l = 0; l < nb; l++)
+        {
+          const uint64_t h0 = mulhi64 (M4x64_0, x0[l]);
+          const uint64_t h1 = mulhi64 (M4x64_1, x2[l]);
+          const uint64_t l0 = M4x64_0 * x0[l];
+          const uint64_t l1 = M4x64_1 * x2[l];
+
+          x0[l] = h1 ^ x1[l] ^ k0;
+          x1[l] = l1;
+          x2[l] = h0 ^ x3[l] ^ k1;
+          x3[l] = l0;
+        }
+
+      k0 += W64_0;
+      k1 += W64_1;
+    }
+
+  for (l = 0; l < nb; l++)
+    {
+      y[4 * l] = x0[l];
+      y[4 * l + 1] = x1[l];
+      y[4 * l + 2] = x2[l];
+      y[4 * l + 3] = x3[l];
+    }
+}
+
+#define FN(x) philox4x32_ ## x
+#define BLOCKS philox4x32_blocks
+#define COUNTER_BITS 32
+#include "counter_source.c"
+#undef FN
+#undef BLOCKS
+#undef COUNTER_BITS
+
+#define FN(x) philox4x64_ ## x
+#define BLOCKS philox4x64_blocks
+#define COUNTER_BITS 64
+#include "counter_source.c"
+#undef FN
+#undef BLOCKS
+#undef COUNTER_BITS
+
+static const gsl_rng_type philox4x32_type =
+{"philox4x32",                  /* name */
+ 0xffffffffUL,                  /* RAND_MAX */
+ 0,                             /* RAND_MIN */
+ sizeof (counter_state_t),
+ &philox4x32_set,
+ &philox4x32_get,
+ &philox4x32_get_double,
+ &philox4x32_get_array,
+ &philox4x32_get_double_array,
+ &philox4x32_jump};
+
+static const gsl_rng_type philox4x64_type =
+{"philox4x64",                  /* name */
+ 0xffffffffUL,                  /* RAND_MAX */
+ 0,                             /* RAND_MIN */
+ sizeof (counter_state_t),
+ &philox4x64_set,
+ &philox4x64_get,
+ &philox4x64_get_double,
+ &philox4x64_get_array,
+ &philox4x64_get_double_array,
+ &philox4x64_jump};
+
+const gsl_rng_type *gsl_rng_philox4x32 = &philox4x32_type;
+const gsl_rng_type *gsl_rng_philox4x64 = &philox4x64_type;
@@ -34,6 +34,8 @@ static double ranlxd_get_double (void *vstate);
 static void ranlxd_set_lux (void *state, unsigned long int s, unsigned int luxury);
 static void ranlxd1_set (void *state, unsigned long int s);
 static void ranlxd2_set (void *state, unsigned long int s);
+static void ranlxd_get_array (void *vstate, unsigned long int x[], size_t n);
+static void ranlxd_get_double_array (void *vstate, double x[], size_t n);
 
 static const int next[12] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0};
 
@@ -167,6 +169,82 @@ ranlxd_get_double (void *vstate)
   return state->xdbl[state->ir];
 }
 
+/* The bulk versions copy out the values left in xdbl before the next
+   call to increment_state, (ir_old - ir - 1) mod 12 of them, without
+   testing for the end of the block at each value. */
+
+static void
+ranlxd_get_array (void *vstate, unsigned long int x[], size_t n)
+{
+  ranlxd_state_t *state = (ranlxd_state_t *) vstate;
+  const double *xdbl = state->xdbl;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      unsigned int ir = state->ir;
+      size_t j, m = (state->ir_old + 11 - ir) % 12;
+
+      if (m == 0)
+        {
+          state->ir = state->ir_old;
+          increment_state (state);
+          x[i++] = xdbl[state->ir] * 4294967296.0;      /* 2^32 */
+          continue;
+        }
+
+      if (m > n - i)
+        {
+          m = n - i;
+        }
+
+      for (j = 0; j < m; j++)
+        {
+          ir = next[ir];
+          x[i + j] = xdbl[ir] * 4294967296.0;
+        }
+
+      state->ir = ir;
+      i += m;
+    }
+}
+
+static void
+ranlxd_get_double_array (void *vstate, double x[], size_t n)
+{
+  ranlxd_state_t *state = (ranlxd_state_t *) vstate;
+  const double *xdbl = state->xdbl;
+  size_t i = 0;
+
+  while (i < n)
+    {
+      unsigned int ir = state->ir;
+      size_t j, m = (state->ir_old + 11 - ir) % 12;
+
+      if (m == 0)
+        {
+          state->ir = state->ir_old;
+          increment_state (state);
+          x[i++] = xdbl[state->ir];
+          continue;
+        }
+
+      if (m > n - i)
+        {
+          m = n - i;
+        }
+
+      for (j = 0; j < m; j++)
+        {
+          ir = next[ir];
+          x[i + j] = xdbl[ir];
+        }
+
+      state->ir = ir;
+      i += m;
+    }
+}
+
 static void
 ranlxd_set_lux (void *vstate, unsigned long int s, unsigned int luxury)
 {
@@ -234,7 +312,10 @@ static const gsl_rng_type ranlxd1_type =
  sizeof (ranlxd_state_t),
  &ranlxd1_set,
  &ranlxd_get,
- &ranlxd_get_double};
+ &ranlxd_get_double,
+ &ranlxd_get_array,
+ &ranlxd_get_double_array,
+ 0};
 
 static const gsl_rng_type ranlxd2_type =
 {"ranlxd2",                     /* name */
@@ -243,7 +324,10 @@ static const gsl_rng_type ranlxd2_type =
  sizeof (ranlxd_state_t),
  &ranlxd2_set,
  &ranlxd_get,
- &ranlxd_get_double};
+ &ranlxd_get_double,
+ &ranlxd_get_array,
+ &ranlxd_get_double_array,
+ 0};
 
 const gsl_rng_type *gsl_rng_ranlxd1 = &ranlxd1_type;
 const gsl_rng_type *gsl_rng_ranlxd2 = &ranlxd2_type;
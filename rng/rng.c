@@ -100,6 +100,89 @@ gsl_rng_set (const gsl_rng * r, unsigned long int seed)
   (r->type->set) (r->state, seed);
 }
 
+void
+gsl_rng_get_array (const gsl_rng * r, unsigned long int x[], size_t n)
+{
+  if (r->type->get_array != 0)
+    {
+      (r->type->get_array) (r->state, x, n);
+    }
+  else
+    {
+      unsigned long int (*get) (void *) = r->type->get;
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        {
+          x[i] = get (r->state);
+        }
+    }
+}
+
+void
+gsl_rng_uniform_array (const gsl_rng * r, double x[], size_t n)
+{
+  if (r->type->get_double_array != 0)
+    {
+      (r->type->get_double_array) (r->state, x, n);
+    }
+  else
+    {
+      double (*get_double) (void *) = r->type->get_double;
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        {
+          x[i] = get_double (r->state);
+        }
+    }
+}
+
+int
+gsl_rng_jump (const gsl_rng * r, unsigned int log2_steps)
+{
+  if (r->type->jump == 0)
+    {
+      GSL_ERROR ("generator does not support jumps", GSL_EUNSUP);
+    }
+
+  return (r->type->jump) (r->state, log2_steps);
+}
+
+/* The new generator continues from the current state of r, and r
+   jumps past the substream of 2^GSL_RNG_SPLIT_LOG2 values given to
+   it.  The k-th generator split from r therefore always starts at
+   the same place in the stream of r. */
+
+gsl_rng *
+gsl_rng_split (const gsl_rng * r)
+{
+  gsl_rng *s;
+  int status;
+
+  if (r->type->jump == 0)
+    {
+      GSL_ERROR_NULL ("generator does not support jumps", GSL_EUNSUP);
+    }
+
+  s = gsl_rng_clone (r);
+
+  if (s == 0)
+    {
+      return 0;
+    }
+
+  status = (r->type->jump) (r->state, GSL_RNG_SPLIT_LOG2);
+
+  if (status)
+    {
+      gsl_rng_free (s);
+      GSL_ERROR_NULL ("failed to jump past the substream", status);
+    }
+
+  return s;
+}
+
 unsigned long int
 gsl_rng_max (const gsl_rng * r)
 {
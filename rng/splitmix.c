@@ -0,0 +1,94 @@
+/* rng/splitmix.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the splitmix64 generator of Steele, Lea and Flood, the
+   generator of java.util.SplittableRandom with a fixed increment.  The
+   state is a 64-bit counter which is incremented by the golden ratio
+   constant 0x9e3779b97f4a7c15 at each step, and the output is the
+   counter passed through Stafford's Mix13 variant of the 64-bit
+   finalizer of MurmurHash3.  The period is 2^64.  The seed
+   is the initial value of the counter, and a jump of 2^k steps adds
+   2^k times the increment.  A jump of 2^64 steps or more would wrap
+   around the whole period, so it is an error.
+
+   From: Guy L. Steele Jr., Doug Lea and Christine H. Flood, "Fast
+   Splittable Pseudorandom Number Generators", Proceedings of OOPSLA
+   2014, pp 453-472. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include "splitmix.h"
+
+typedef struct
+  {
+    uint64_t z;
+  }
+splitmix64_state_t;
+
+static unsigned long int
+splitmix64_get (void *vstate)
+{
+  splitmix64_state_t *state = (splitmix64_state_t *) vstate;
+  return (unsigned long int) (splitmix64_next (&state->z) >> 32);
+}
+
+static double
+splitmix64_get_double (void *vstate)
+{
+  splitmix64_state_t *state = (splitmix64_state_t *) vstate;
+  const uint64_t x = splitmix64_next (&state->z);
+  return (int64_t) (x >> 11) / 9007199254740992.0;
+}
+
+static void
+splitmix64_set (void *vstate, unsigned long int s)
+{
+  splitmix64_state_t *state = (splitmix64_state_t *) vstate;
+  state->z = s;
+}
+
+static int
+splitmix64_jump (void *vstate, unsigned int log2_steps)
+{
+  splitmix64_state_t *state = (splitmix64_state_t *) vstate;
+
+  if (log2_steps >= 64)
+    {
+      GSL_ERROR ("jump must be shorter than the period of 2^64 steps",
+                 GSL_EINVAL);
+    }
+
+  state->z += SPLITMIX64_GAMMA << log2_steps;
+
+  return GSL_SUCCESS;
+}
+
+static const gsl_rng_type splitmix64_type =
+{"splitmix64",                  /* name */
+ 0xffffffffUL,                  /* RAND_MAX */
+ 0,                             /* RAND_MIN */
+ sizeof (splitmix64_state_t),
+ &splitmix64_set,
+ &splitmix64_get,
+ &splitmix64_get_double,
+ 0,
+ 0,
+ &splitmix64_jump};
+
+const gsl_rng_type *gsl_rng_splitmix64 = &splitmix64_type;
@@ -0,0 +1,34 @@
+/* rng/splitmix.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* The splitmix64 step, used by splitmix.c and to seed the generators
+   with larger states */
+
+#include <stdint.h>
+
+#define SPLITMIX64_GAMMA (((uint64_t) 0x9e3779b9UL << 32) | 0x7f4a7c15UL)
+
+static inline uint64_t
+splitmix64_next (uint64_t * z)
+{
+  uint64_t x = (*z += SPLITMIX64_GAMMA);
+
+  x = (x ^ (x >> 30)) * (((uint64_t) 0xbf58476dUL << 32) | 0x1ce4e5b9UL);
+  x = (x ^ (x >> 27)) * (((uint64_t) 0x94d049bbUL << 32) | 0x133111ebUL);
+
+  return x ^ (x >> 31);
+}
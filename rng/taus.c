@@ -19,7 +19,9 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_rng.h>
+#include "jump.h"
 
 /* This is a maximally equidistributed combined Tausworthe
    generator. The sequence is,
@@ -83,6 +85,7 @@
 static inline unsigned long int taus_get (void *vstate);
 static double taus_get_double (void *vstate);
 static void taus_set (void *state, unsigned long int s);
+static int taus_jump (void *vstate, unsigned int log2_steps);
 
 typedef struct
   {
@@ -111,6 +114,39 @@ taus_get_double (void *vstate)
   return taus_get (vstate) / 4294967296.0 ;
 }
 
+/* The three components are linear maps of 31, 29 and 28 bits of
+   their words, and jump separately */
+
+static unsigned long int
+taus_step1 (unsigned long int s)
+{
+  return TAUSWORTHE (s, 13, 19, 4294967294UL, 12);
+}
+
+static unsigned long int
+taus_step2 (unsigned long int s)
+{
+  return TAUSWORTHE (s, 2, 25, 4294967288UL, 4);
+}
+
+static unsigned long int
+taus_step3 (unsigned long int s)
+{
+  return TAUSWORTHE (s, 3, 11, 4294967280UL, 17);
+}
+
+static int
+taus_jump (void *vstate, unsigned int log2_steps)
+{
+  taus_state_t *state = (taus_state_t *) vstate;
+
+  state->s1 = jump_gf2 (&taus_step1, state->s1, log2_steps, 31);
+  state->s2 = jump_gf2 (&taus_step2, state->s2, log2_steps, 29);
+  state->s3 = jump_gf2 (&taus_step3, state->s3, log2_steps, 28);
+
+  return GSL_SUCCESS;
+}
+
 static void
 taus_set (void *vstate, unsigned long int s)
 {
@@ -168,7 +204,10 @@ static const gsl_rng_type taus_type =
  sizeof (taus_state_t),
  &taus_set,
  &taus_get,
- &taus_get_double};
+ &taus_get_double,
+ 0,
+ 0,
+ &taus_jump};
 
 const gsl_rng_type *gsl_rng_taus = &taus_type;
 
@@ -179,6 +218,9 @@ static const gsl_rng_type taus2_type =
  sizeof (taus_state_t),
  &taus2_set,
  &taus_get,
- &taus_get_double};
+ &taus_get_double,
+ 0,
+ 0,
+ &taus_jump};
 
 const gsl_rng_type *gsl_rng_taus2 = &taus2_type;
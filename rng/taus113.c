@@ -57,7 +57,9 @@
 
 #include <config.h>
 #include <stdlib.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_rng.h>
+#include "jump.h"
 
 #define LCG(n) ((69069UL * n) & 0xffffffffUL)
 #define MASK 0xffffffffUL
@@ -65,6 +67,9 @@
 static inline unsigned long int taus113_get (void *vstate);
 static double taus113_get_double (void *vstate);
 static void taus113_set (void *state, unsigned long int s);
+static void taus113_get_array (void *vstate, unsigned long int x[], size_t n);
+static void taus113_get_double_array (void *vstate, double x[], size_t n);
+static int taus113_jump (void *vstate, unsigned int log2_steps);
 
 typedef struct
 {
@@ -100,6 +105,103 @@ taus113_get_double (void *vstate)
   return taus113_get (vstate) / 4294967296.0;
 }
 
+/* Each value depends on the previous state, so the bulk versions
+   cannot be vectorized across values, but they keep the four
+   components in registers rather than in the state struct. */
+
+#define TAUS113_STEP(z1,z2,z3,z4) do {                                  \
+    z1 = ((((z1 & 4294967294UL) << 18UL) & MASK)                        \
+          ^ ((((z1 << 6UL) & MASK) ^ z1) >> 13UL));                     \
+    z2 = ((((z2 & 4294967288UL) << 2UL) & MASK)                         \
+          ^ ((((z2 << 2UL) & MASK) ^ z2) >> 27UL));                     \
+    z3 = ((((z3 & 4294967280UL) << 7UL) & MASK)                         \
+          ^ ((((z3 << 13UL) & MASK) ^ z3) >> 21UL));                    \
+    z4 = ((((z4 & 4294967168UL) << 13UL) & MASK)                        \
+          ^ ((((z4 << 3UL) & MASK) ^ z4) >> 12UL));                     \
+  } while (0)
+
+static void
+taus113_get_array (void *vstate, unsigned long int x[], size_t n)
+{
+  taus113_state_t *state = (taus113_state_t *) vstate;
+  unsigned long z1 = state->z1, z2 = state->z2, z3 = state->z3, z4 = state->z4;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      TAUS113_STEP (z1, z2, z3, z4);
+      x[i] = z1 ^ z2 ^ z3 ^ z4;
+    }
+
+  state->z1 = z1;
+  state->z2 = z2;
+  state->z3 = z3;
+  state->z4 = z4;
+}
+
+static void
+taus113_get_double_array (void *vstate, double x[], size_t n)
+{
+  taus113_state_t *state = (taus113_state_t *) vstate;
+  unsigned long z1 = state->z1, z2 = state->z2, z3 = state->z3, z4 = state->z4;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      TAUS113_STEP (z1, z2, z3, z4);
+      x[i] = (z1 ^ z2 ^ z3 ^ z4) / 4294967296.0;
+    }
+
+  state->z1 = z1;
+  state->z2 = z2;
+  state->z3 = z3;
+  state->z4 = z4;
+}
+
+/* The four components are linear maps of 31, 29, 28 and 25 bits of
+   their words, and jump separately */
+
+static unsigned long int
+taus113_step1 (unsigned long int z)
+{
+  return ((((z & 4294967294UL) << 18UL) & MASK)
+          ^ ((((z << 6UL) & MASK) ^ z) >> 13UL));
+}
+
+static unsigned long int
+taus113_step2 (unsigned long int z)
+{
+  return ((((z & 4294967288UL) << 2UL) & MASK)
+          ^ ((((z << 2UL) & MASK) ^ z) >> 27UL));
+}
+
+static unsigned long int
+taus113_step3 (unsigned long int z)
+{
+  return ((((z & 4294967280UL) << 7UL) & MASK)
+          ^ ((((z << 13UL) & MASK) ^ z) >> 21UL));
+}
+
+static unsigned long int
+taus113_step4 (unsigned long int z)
+{
+  return ((((z & 4294967168UL) << 13UL) & MASK)
+          ^ ((((z << 3UL) & MASK) ^ z) >> 12UL));
+}
+
+static int
+taus113_jump (void *vstate, unsigned int log2_steps)
+{
+  taus113_state_t *state = (taus113_state_t *) vstate;
+
+  state->z1 = jump_gf2 (&taus113_step1, state->z1, log2_steps, 31);
+  state->z2 = jump_gf2 (&taus113_step2, state->z2, log2_steps, 29);
+  state->z3 = jump_gf2 (&taus113_step3, state->z3, log2_steps, 28);
+  state->z4 = jump_gf2 (&taus113_step4, state->z4, log2_steps, 25);
+
+  return GSL_SUCCESS;
+}
+
 static void
 taus113_set (void *vstate, unsigned long int s)
 {
@@ -143,7 +245,10 @@ static const gsl_rng_type taus113_type = {
   sizeof (taus113_state_t),
   &taus113_set,
   &taus113_get,
-  &taus113_get_double
+  &taus113_get_double,
+  &taus113_get_array,
+  &taus113_get_double_array,
+  &taus113_jump
 };
 
 const gsl_rng_type *gsl_rng_taus113 = &taus113_type;
@@ -32,6 +32,11 @@ void generic_rng_test (const gsl_rng_type * T);
 void rng_state_test (const gsl_rng_type * T);
 void rng_parallel_state_test (const gsl_rng_type * T);
 void rng_read_write_test (const gsl_rng_type * T);
+void rng_array_test (const gsl_rng_type * T);
+void rng_jump_test (const gsl_rng_type * T);
+void rng_counter_test (const gsl_rng_type * T, const unsigned long int key[],
+                       size_t nkey, const unsigned long int counter[],
+                       size_t ncounter, const unsigned long int x[4]);
 int rng_max_test (gsl_rng * r, unsigned long int *kmax, unsigned long int ran_max) ;
 int rng_min_test (gsl_rng * r, unsigned long int *kmin, unsigned long int ran_min, unsigned long int ran_max) ;
 int rng_sum_test (gsl_rng * r, double *sigma);
@@ -145,8 +150,66 @@ main (void)
   rng_test (gsl_rng_mt19937, 4357, 1000, 1186927261);
   rng_test (gsl_rng_mt19937_1999, 4357, 1000, 1030650439);
   rng_test (gsl_rng_mt19937_1998, 4357, 1000, 1309179303);
+
+  /* SFMT and dSFMT first values from the reference test output,
+     SFMT.19937.out.txt (seed 1234) and dSFMT.19937.out.txt (seed 0,
+     1.030581026769374 in [1,2), of which the generator returns the
+     top 32 bits of the mantissa) */
+  rng_test (gsl_rng_sfmt19937, 1234, 1, 3440181298UL);
+  rng_test (gsl_rng_sfmt19937, 1, 10000, 1779530869UL);
+  rng_test (gsl_rng_dsfmt19937, 0, 1, 131344509UL);
+  rng_test (gsl_rng_dsfmt19937, 1, 10000, 706684752UL);
   rng_test (gsl_rng_tt800, 0, 10000, 2856609219UL);
 
+  /* splitmix64 from zero gives 0xe220a8397b1dcdaf first, and
+     xoroshiro128plus and xoshiro256starstar are seeded from it */
+  rng_test (gsl_rng_splitmix64, 0, 1, 0xe220a839UL);
+  rng_test (gsl_rng_splitmix64, 1, 10000, 3167836491UL);
+  rng_test (gsl_rng_xoroshiro128plus, 0, 1, 0x509946a4UL);
+  rng_test (gsl_rng_xoroshiro128plus, 1, 10000, 903173191UL);
+  rng_test (gsl_rng_xoshiro256starstar, 0, 1, 0x99ec5f36UL);
+  rng_test (gsl_rng_xoshiro256starstar, 1, 10000, 1363609523UL);
+  rng_test (gsl_rng_pcg64, 0, 1, 0x01070196UL);
+  rng_test (gsl_rng_pcg64, 1, 10000, 963326789UL);
+
+  /* Philox and Threefry known answer tests from the Random123 library
+     (kat_vectors), with keys and counters of zeros, of ones and of the
+     digits of pi.  The 64-bit generators return the top 32 bits of
+     each word. */
+  {
+    static const unsigned long int zero[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    static const unsigned long int ones[8] = {
+      0xffffffffUL, 0xffffffffUL, 0xffffffffUL, 0xffffffffUL,
+      0xffffffffUL, 0xffffffffUL, 0xffffffffUL, 0xffffffffUL };
+    static const unsigned long int pi_ctr[4] = {
+      0x243f6a88UL, 0x85a308d3UL, 0x13198a2eUL, 0x03707344UL };
+    static const unsigned long int pi_key[2] = {
+      0xa4093822UL, 0x299f31d0UL };
+
+    static const unsigned long int p32_zero[4] = {
+      0x6627e8d5UL, 0xe169c58dUL, 0xbc57ac4cUL, 0x9b00dbd8UL };
+    static const unsigned long int p32_ones[4] = {
+      0x408f276dUL, 0x41c83b0eUL, 0xa20bc7c6UL, 0x6d5451fdUL };
+    static const unsigned long int p32_pi[4] = {
+      0xd16cfe09UL, 0x94fdccebUL, 0x5001e420UL, 0x24126ea1UL };
+    static const unsigned long int p64_zero[4] = {
+      0x16554d9eUL, 0xdb20fe9dUL, 0xd7e772ceUL, 0x7e68b68aUL };
+    static const unsigned long int p64_ones[4] = {
+      0x87b092c3UL, 0x438c3c67UL, 0x9cc7d7c6UL, 0xa09caebfUL };
+    static const unsigned long int t64_zero[4] = {
+      0x09218ebdUL, 0x55941f52UL, 0x4bd25e16UL, 0xee29ec84UL };
+    static const unsigned long int t64_ones[4] = {
+      0x29c24097UL, 0x0371bbfbUL, 0x3c231ffaUL, 0xcd29113fUL };
+
+    rng_counter_test (gsl_rng_philox4x32, zero, 2, zero, 4, p32_zero);
+    rng_counter_test (gsl_rng_philox4x32, ones, 2, ones, 4, p32_ones);
+    rng_counter_test (gsl_rng_philox4x32, pi_key, 2, pi_ctr, 4, p32_pi);
+    rng_counter_test (gsl_rng_philox4x64, zero, 4, zero, 8, p64_zero);
+    rng_counter_test (gsl_rng_philox4x64, ones, 4, ones, 8, p64_ones);
+    rng_counter_test (gsl_rng_threefry4x64, zero, 8, zero, 8, t64_zero);
+    rng_counter_test (gsl_rng_threefry4x64, ones, 8, ones, 8, t64_ones);
+  }
+
   rng_test (gsl_rng_ran0, 0, 10000, 1115320064);
   rng_test (gsl_rng_ran1, 0, 10000, 1491066076);
   rng_test (gsl_rng_ran2, 0, 10000, 1701364455);
@@ -197,6 +260,17 @@ main (void)
   for (r = rngs ; *r != 0; r++)
     rng_read_write_test (*r);
 
+  /* Test the bulk functions against single values */
+
+  for (r = rngs ; *r != 0; r++)
+    rng_array_test (*r);
+
+  /* Test jumps against single steps */
+
+  for (r = rngs ; *r != 0; r++)
+    if ((*r)->jump != 0)
+      rng_jump_test (*r);
+
   /* generic statistical tests (these are just to make sure that we
      don't get any crazy results back from the generator, i.e. they
      aren't a test of the algorithm, just the implementation) */
@@ -335,6 +409,237 @@ rng_state_test (const gsl_rng_type * T)
 }
 
 
+/* fill arrays in pieces of varying length, which start and end at
+   different points of the block structure of the generators, and
+   compare with the values from gsl_rng_get and gsl_rng_uniform */
+
+void
+rng_array_test (const gsl_rng_type * T)
+{
+  static const size_t len[] = { 1, 2, 11, 470, 471, 623, 625, 1000, 4096 };
+  const size_t nlen = sizeof (len) / sizeof (len[0]);
+  const size_t n = 2 * N;
+  unsigned long int *a = (unsigned long int *) malloc (n * sizeof (unsigned long int));
+  double *u = (double *) malloc (n * sizeof (double));
+
+  gsl_rng *r1 = gsl_rng_alloc (T);
+  gsl_rng *r2 = gsl_rng_alloc (T);
+  gsl_rng *r3 = gsl_rng_alloc (T);
+
+  size_t i, k;
+  int status_int = 0, status_double = 0;
+
+  for (i = 0, k = 0; i < n; k++)
+    {
+      size_t m = len[k % nlen];
+
+      if (m > n - i)
+        m = n - i;
+
+      gsl_rng_get_array (r2, a + i, m);
+      gsl_rng_uniform_array (r3, u + i, m);
+      i += m;
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      status_int |= (a[i] != gsl_rng_get (r1));
+    }
+
+  gsl_rng_set (r1, gsl_rng_default_seed);
+
+  for (i = 0; i < n; i++)
+    {
+      status_double |= (u[i] != gsl_rng_uniform (r1));
+    }
+
+  /* the generators continue from the same state */
+
+  status_int |= (gsl_rng_get (r2) != gsl_rng_get (r3));
+
+  gsl_test (status_int, "%s, gsl_rng_get_array", gsl_rng_name (r1));
+  gsl_test (status_double, "%s, gsl_rng_uniform_array", gsl_rng_name (r1));
+
+  gsl_rng_free (r1);
+  gsl_rng_free (r2);
+  gsl_rng_free (r3);
+  free (a);
+  free (u);
+}
+
+/* Compare jumps of 2^k steps with single steps, for values of k which
+   are small enough, and with two jumps of half the size otherwise.
+   Then check that gsl_rng_split gives the current substream and jumps
+   past it.  The generators are advanced by a few steps first so that
+   jumps start in the middle of a block. */
+
+void
+rng_jump_test (const gsl_rng_type * T)
+{
+  static const unsigned int ksteps[] = { 0, 1, 2, 5, 12, 15 };
+  const size_t nk = sizeof (ksteps) / sizeof (ksteps[0]);
+  gsl_rng *r1 = gsl_rng_alloc (T);
+  gsl_rng *r2 = gsl_rng_alloc (T);
+  gsl_rng *s;
+  unsigned long int i, j;
+  int status = 0, status_split = 0;
+  size_t nequal = 0;
+
+  for (j = 0; j < nk; j++)
+    {
+      gsl_rng_set (r1, j + 1);
+      gsl_rng_set (r2, j + 1);
+
+      for (i = 0; i < j; i++)
+        {
+          gsl_rng_get (r1);
+          gsl_rng_get (r2);
+        }
+
+      gsl_rng_jump (r1, ksteps[j]);
+
+      for (i = 0; i < (1UL << ksteps[j]); i++)
+        {
+          gsl_rng_get (r2);
+        }
+
+      for (i = 0; i < 1000; i++)
+        {
+          status |= (gsl_rng_get (r1) != gsl_rng_get (r2));
+        }
+    }
+
+  /* a generator with a period of 2^64 or less must refuse to jump
+     by 2^64 steps, and so cannot be split */
+
+  {
+    gsl_error_handler_t *handler = gsl_set_error_handler_off ();
+    gsl_rng *t = gsl_rng_clone (r1);
+    int jump_status = gsl_rng_jump (t, GSL_RNG_SPLIT_LOG2);
+
+    if (jump_status != GSL_SUCCESS)
+      {
+        s = gsl_rng_split (r1);
+        gsl_set_error_handler (handler);
+
+        gsl_test (status, "%s, gsl_rng_jump", gsl_rng_name (r1));
+        gsl_test (jump_status != GSL_EINVAL || s != 0,
+                  "%s, gsl_rng_split fails for a short period",
+                  gsl_rng_name (r1));
+
+        gsl_rng_free (t);
+        gsl_rng_free (r1);
+        gsl_rng_free (r2);
+        return;
+      }
+
+    gsl_set_error_handler (handler);
+    gsl_rng_free (t);
+  }
+
+  gsl_rng_jump (r1, 70);
+  gsl_rng_jump (r1, 70);
+  gsl_rng_jump (r2, 71);
+
+  for (i = 0; i < 1000; i++)
+    {
+      status |= (gsl_rng_get (r1) != gsl_rng_get (r2));
+    }
+
+  gsl_test (status, "%s, gsl_rng_jump", gsl_rng_name (r1));
+
+  /* s continues from the state of r1, and r1 jumps by 2^64 */
+
+  s = gsl_rng_split (r1);
+
+  /* the substream of s must differ from the continuation of r1 */
+
+  {
+    gsl_rng *s0 = gsl_rng_clone (s);
+    gsl_rng *r0 = gsl_rng_clone (r1);
+
+    for (i = 0; i < 1000; i++)
+      {
+        nequal += (gsl_rng_get (s0) == gsl_rng_get (r0));
+      }
+
+    status_split |= (nequal > 10);
+
+    gsl_rng_free (s0);
+    gsl_rng_free (r0);
+  }
+
+  for (i = 0; i < 1000; i++)
+    {
+      status_split |= (gsl_rng_get (s) != gsl_rng_get (r2));
+    }
+
+  gsl_rng_jump (r2, GSL_RNG_SPLIT_LOG2);
+
+  for (i = 0; i < 1000; i++)
+    {
+      gsl_rng_get (r1);
+    }
+
+  for (i = 0; i < 1000; i++)
+    {
+      status_split |= (gsl_rng_get (r1) != gsl_rng_get (r2));
+    }
+
+  gsl_test (status_split, "%s, gsl_rng_split", gsl_rng_name (r1));
+
+  gsl_rng_free (r1);
+  gsl_rng_free (r2);
+  gsl_rng_free (s);
+}
+
+/* Set the key and counter of a counter-based generator and compare
+   the first block with the known answer x[], then check that setting
+   the counter to k positions the stream after k blocks */
+
+void
+rng_counter_test (const gsl_rng_type * T, const unsigned long int key[],
+                  size_t nkey, const unsigned long int counter[],
+                  size_t ncounter, const unsigned long int x[4])
+{
+  const unsigned long int k = 1000;
+  gsl_rng *r1 = gsl_rng_alloc (T);
+  gsl_rng *r2 = gsl_rng_alloc (T);
+  unsigned long int i;
+  int status = 0, status_ctr = 0;
+
+  gsl_rng_set_key (r1, key, nkey);
+  gsl_rng_set_counter (r1, counter, ncounter);
+
+  for (i = 0; i < 4; i++)
+    {
+      status |= (gsl_rng_get (r1) != x[i]);
+    }
+
+  gsl_test (status, "%s, known answer for key %08lx and counter %08lx",
+            gsl_rng_name (r1), key[0], counter[0]);
+
+  gsl_rng_set_key (r1, key, nkey);
+  gsl_rng_set_key (r2, key, nkey);
+  gsl_rng_set_counter (r2, &k, 1);
+
+  for (i = 0; i < 4 * k; i++)
+    {
+      gsl_rng_get (r1);
+    }
+
+  for (i = 0; i < 8; i++)
+    {
+      status_ctr |= (gsl_rng_get (r1) != gsl_rng_get (r2));
+    }
+
+  gsl_test (status_ctr, "%s, gsl_rng_set_counter positions the stream",
+            gsl_rng_name (r1));
+
+  gsl_rng_free (r1);
+  gsl_rng_free (r2);
+}
+
 void
 rng_parallel_state_test (const gsl_rng_type * T)
 {
@@ -0,0 +1,197 @@
+/* rng/xoshiro.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* These are the xoshiro256** and xoroshiro128+ generators of
+   Blackman and Vigna, version 1.0 (2018).  The state of 256 or 128
+   bits is updated by shifts, rotations and exclusive ors, with periods
+   of 2^256 - 1 and 2^128 - 1, and the output is a scrambled function
+   of the state words.  Both produce 64-bit words, of which gsl_rng_get
+   returns the top 32 bits and gsl_rng_uniform the top 53 bits divided
+   by 2^53.  The low bits of xoroshiro128+ fail linearity tests, which
+   the top bits used here do not.
+
+   The state is seeded with successive values of splitmix64 started
+   from the seed, as recommended by the authors, so that any seed
+   (including zero) gives a nonzero state.
+
+   From: David Blackman and Sebastiano Vigna, "Scrambled Linear
+   Pseudorandom Number Generators", ACM Transactions on Mathematical
+   Software 47, 36 (2021).  The reference implementations are at
+   http://prng.di.unimi.it/ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include "jump.h"
+#include "splitmix.h"
+
+#define ROTL(x,k) (((x) << (k)) | ((x) >> (64 - (k))))
+
+typedef struct
+  {
+    uint64_t s[4];
+  }
+xoshiro_state_t;
+
+/* xoshiro256** */
+
+static inline void
+xoshiro256_step (uint64_t s[])
+{
+  const uint64_t t = s[1] << 17;
+
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = ROTL (s[3], 45);
+}
+
+static inline uint64_t
+xoshiro256ss_next (xoshiro_state_t * state)
+{
+  const uint64_t x = state->s[1] * 5;
+  const uint64_t result = ROTL (x, 7) * 9;
+
+  xoshiro256_step (state->s);
+
+  return result;
+}
+
+static unsigned long int
+xoshiro256ss_get (void *vstate)
+{
+  return (unsigned long int) (xoshiro256ss_next ((xoshiro_state_t *) vstate)
+                              >> 32);
+}
+
+static double
+xoshiro256ss_get_double (void *vstate)
+{
+  const uint64_t x = xoshiro256ss_next ((xoshiro_state_t *) vstate);
+  return (int64_t) (x >> 11) / 9007199254740992.0;
+}
+
+static void
+xoshiro256_set (void *vstate, unsigned long int s)
+{
+  xoshiro_state_t *state = (xoshiro_state_t *) vstate;
+  uint64_t z = s;
+  int k;
+
+  for (k = 0; k < 4; k++)
+    {
+      state->s[k] = splitmix64_next (&z);
+    }
+}
+
+static int
+xoshiro256_jump (void *vstate, unsigned int log2_steps)
+{
+  xoshiro_state_t *state = (xoshiro_state_t *) vstate;
+
+  jump_gf2_poly (&xoshiro256_step, state->s, 4, log2_steps);
+
+  return GSL_SUCCESS;
+}
+
+/* xoroshiro128+ */
+
+static inline void
+xoroshiro128_step (uint64_t s[])
+{
+  const uint64_t s0 = s[0];
+  const uint64_t s1 = s[1] ^ s0;
+
+  s[0] = ROTL (s0, 24) ^ s1 ^ (s1 << 16);
+  s[1] = ROTL (s1, 37);
+}
+
+static inline uint64_t
+xoroshiro128p_next (xoshiro_state_t * state)
+{
+  const uint64_t result = state->s[0] + state->s[1];
+
+  xoroshiro128_step (state->s);
+
+  return result;
+}
+
+static unsigned long int
+xoroshiro128p_get (void *vstate)
+{
+  return (unsigned long int) (xoroshiro128p_next ((xoshiro_state_t *) vstate)
+                              >> 32);
+}
+
+static double
+xoroshiro128p_get_double (void *vstate)
+{
+  const uint64_t x = xoroshiro128p_next ((xoshiro_state_t *) vstate);
+  return (int64_t) (x >> 11) / 9007199254740992.0;
+}
+
+static void
+xoroshiro128_set (void *vstate, unsigned long int s)
+{
+  xoshiro_state_t *state = (xoshiro_state_t *) vstate;
+  uint64_t z = s;
+
+  state->s[0] = splitmix64_next (&z);
+  state->s[1] = splitmix64_next (&z);
+  state->s[2] = 0;
+  state->s[3] = 0;
+}
+
+static int
+xoroshiro128_jump (void *vstate, unsigned int log2_steps)
+{
+  xoshiro_state_t *state = (xoshiro_state_t *) vstate;
+
+  jump_gf2_poly (&xoroshiro128_step, state->s, 2, log2_steps);
+
+  return GSL_SUCCESS;
+}
+
+static const gsl_rng_type xoshiro256ss_type =
+{"xoshiro256starstar",          /* name */
+ 0xffffffffUL,                  /* RAND_MAX */
+ 0,                             /* RAND_MIN */
+ sizeof (xoshiro_state_t),
+ &xoshiro256_set,
+ &xoshiro256ss_get,
+ &xoshiro256ss_get_double,
+ 0,
+ 0,
+ &xoshiro256_jump};
+
+static const gsl_rng_type xoroshiro128p_type =
+{"xoroshiro128plus",            /* name */
+ 0xffffffffUL,                  /* RAND_MAX */
+ 0,                             /* RAND_MIN */
+ sizeof (xoshiro_state_t),
+ &xoroshiro128_set,
+ &xoroshiro128p_get,
+ &xoroshiro128p_get_double,
+ 0,
+ 0,
+ &xoroshiro128_jump};
+
+const gsl_rng_type *gsl_rng_xoshiro256starstar = &xoshiro256ss_type;
+const gsl_rng_type *gsl_rng_xoroshiro128plus = &xoroshiro128p_type;
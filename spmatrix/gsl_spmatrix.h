@@ -154,6 +154,9 @@ void gsl_spmatrix_cumsum(const size_t n, size_t *c);
 int gsl_spmatrix_fprintf(FILE *stream, const gsl_spmatrix *m,
                          const char *format);
 gsl_spmatrix * gsl_spmatrix_fscanf(FILE *stream);
+gsl_spmatrix * gsl_spmatrix_fscanf_crs(FILE *stream);
+gsl_spmatrix * gsl_spmatrix_fscanf_crs_parallel(FILE *stream,
+                                                const size_t nthreads);
 int gsl_spmatrix_fwrite(FILE *stream, const gsl_spmatrix *m);
 int gsl_spmatrix_fread(FILE *stream, gsl_spmatrix *m);
 
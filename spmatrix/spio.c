@@ -0,0 +1,981 @@
+/* spio.c
+ *
+ * Copyright (C) 2016 Patrick Alken
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_spmatrix.h>
+
+#include "parallel.h"
+
+#define SPIO_LINE_LEN  1024
+#define SPIO_BATCH     256 /* lines parsed by each thread at a time */
+
+/* a batch of lines and their parsed entries */
+typedef struct
+{
+  size_t size;   /* maximum number of lines */
+  size_t nlines; /* number of lines read */
+  char *lines;   /* line k starts at lines + k * SPIO_LINE_LEN */
+  size_t *i;
+  size_t *j;
+  double *x;
+  int *status;   /* status of spio_parse_entry() for each line */
+} spio_batch;
+
+/* the arrays shared by the threads placing and sorting rows */
+typedef struct
+{
+  size_t *Ti;
+  size_t *Cj;
+  double *Cd;
+  const size_t *Cp;
+  size_t *w;
+  const size_t *rb; /* block b holds rows rb[b] .. rb[b+1]-1 */
+} spio_rows_params;
+
+static int spio_read_header(FILE *stream, size_t *size1, size_t *size2,
+                            size_t *nz);
+static int spio_parse_entry(const char *buf, size_t *i, size_t *j,
+                            double *x);
+static void spio_sift_down(size_t *j, double *x, size_t k, const size_t n);
+static void spio_sort_row(size_t *j, double *x, const size_t n);
+static spio_batch *spio_batch_alloc(const size_t size);
+static void spio_batch_free(spio_batch *batch);
+static size_t spio_batch_read(spio_batch *batch, FILE *stream);
+static int spio_parse_lines(void *vbatch, size_t thread, size_t begin,
+                            size_t end);
+static size_t spio_block(const size_t *rb, const size_t nblocks,
+                         const size_t row);
+static void spio_swap(size_t *Ti, size_t *Cj, double *Cd, const size_t a,
+                      const size_t b);
+static int spio_place_rows(void *vparams, size_t thread, size_t begin,
+                           size_t end);
+
+/*
+gsl_spmatrix_fprintf()
+  Print sparse matrix to file in MatrixMarket format
+
+Inputs: stream - output stream
+        m      - matrix (triplet, CCS or CRS)
+        format - printf format string for matrix elements
+
+Return: success or error
+*/
+
+int
+gsl_spmatrix_fprintf(FILE *stream, const gsl_spmatrix *m,
+                     const char *format)
+{
+  int status;
+
+  /* print header */
+  status = fprintf(stream, "%%%%MatrixMarket matrix coordinate real general\n");
+  if (status < 0)
+    {
+      GSL_ERROR("fprintf failed for header", GSL_EFAILED);
+    }
+
+  /* print rows,columns,nnz */
+  status = fprintf(stream, "%u\t%u\t%u\n",
+                   (unsigned int) m->size1,
+                   (unsigned int) m->size2,
+                   (unsigned int) m->nz);
+  if (status < 0)
+    {
+      GSL_ERROR("fprintf failed for dimension header", GSL_EFAILED);
+    }
+
+  if (GSL_SPMATRIX_ISTRIPLET(m))
+    {
+      size_t n;
+
+      for (n = 0; n < m->nz; ++n)
+        {
+          status = fprintf(stream, "%u\t%u\t",
+                           (unsigned int) m->i[n] + 1,
+                           (unsigned int) m->p[n] + 1);
+          if (status < 0)
+            {
+              GSL_ERROR("fprintf failed", GSL_EFAILED);
+            }
+
+          status = fprintf(stream, format, m->data[n]);
+          if (status < 0)
+            {
+              GSL_ERROR("fprintf failed", GSL_EFAILED);
+            }
+
+          status = putc('\n', stream);
+          if (status == EOF)
+            {
+              GSL_ERROR("putc failed", GSL_EFAILED);
+            }
+        }
+    }
+  else if (GSL_SPMATRIX_ISCCS(m))
+    {
+      size_t j, p;
+
+      for (j = 0; j < m->size2; ++j)
+        {
+          for (p = m->p[j]; p < m->p[j + 1]; ++p)
+            {
+              status = fprintf(stream, "%u\t%u\t",
+                               (unsigned int) m->i[p] + 1,
+                               (unsigned int) j + 1);
+              if (status < 0)
+                {
+                  GSL_ERROR("fprintf failed", GSL_EFAILED);
+                }
+
+              status = fprintf(stream, format, m->data[p]);
+              if (status < 0)
+                {
+                  GSL_ERROR("fprintf failed", GSL_EFAILED);
+                }
+
+              status = putc('\n', stream);
+              if (status == EOF)
+                {
+                  GSL_ERROR("putc failed", GSL_EFAILED);
+                }
+            }
+        }
+    }
+  else if (GSL_SPMATRIX_ISCRS(m))
+    {
+      size_t i, p;
+
+      for (i = 0; i < m->size1; ++i)
+        {
+          for (p = m->p[i]; p < m->p[i + 1]; ++p)
+            {
+              status = fprintf(stream, "%u\t%u\t",
+                               (unsigned int) i + 1,
+                               (unsigned int) m->i[p] + 1);
+              if (status < 0)
+                {
+                  GSL_ERROR("fprintf failed", GSL_EFAILED);
+                }
+
+              status = fprintf(stream, format, m->data[p]);
+              if (status < 0)
+                {
+                  GSL_ERROR("fprintf failed", GSL_EFAILED);
+                }
+
+              status = putc('\n', stream);
+              if (status == EOF)
+                {
+                  GSL_ERROR("putc failed", GSL_EFAILED);
+                }
+            }
+        }
+    }
+  else
+    {
+      GSL_ERROR("unknown sparse matrix type", GSL_EINVAL);
+    }
+
+  return GSL_SUCCESS;
+} /* gsl_spmatrix_fprintf() */
+
+/*
+gsl_spmatrix_fscanf()
+  Read a MatrixMarket file into a newly allocated triplet matrix
+
+Inputs: stream - input stream
+
+Return: pointer to new matrix in triplet format (should be freed
+when finished with it)
+*/
+
+gsl_spmatrix *
+gsl_spmatrix_fscanf(FILE *stream)
+{
+  gsl_spmatrix *m;
+  size_t size1, size2, nz;
+  char buf[SPIO_LINE_LEN];
+  int status;
+
+  status = spio_read_header(stream, &size1, &size2, &nz);
+  if (status)
+    {
+      GSL_ERROR_NULL ("fscanf failed reading header", GSL_EFAILED);
+    }
+
+  m = gsl_spmatrix_alloc_nzmax(size1, size2, nz, GSL_SPMATRIX_TRIPLET);
+  if (!m)
+    {
+      GSL_ERROR_NULL ("error allocating m", GSL_ENOMEM);
+    }
+
+  while (fgets(buf, SPIO_LINE_LEN, stream) != NULL)
+    {
+      size_t i, j;
+      double val;
+
+      status = spio_parse_entry(buf, &i, &j, &val);
+      if (status == GSL_CONTINUE)
+        continue; /* blank line */
+
+      if (status || i == 0 || j == 0)
+        {
+          gsl_spmatrix_free(m);
+          GSL_ERROR_NULL ("error in input file format", GSL_EFAILED);
+        }
+      else if (i > size1 || j > size2)
+        {
+          gsl_spmatrix_free(m);
+          GSL_ERROR_NULL ("element exceeds matrix dimensions", GSL_EBADLEN);
+        }
+
+      /* subtract 1 from (i,j) since indexing starts at 1 */
+      gsl_spmatrix_set(m, i - 1, j - 1, val);
+    }
+
+  return m;
+} /* gsl_spmatrix_fscanf() */
+
+/*
+gsl_spmatrix_fscanf_crs()
+  Read a MatrixMarket file directly into a newly allocated
+compressed row matrix, without going through an intermediate
+triplet matrix
+
+Inputs: stream - input stream
+
+Return: pointer to new matrix in CRS format (should be freed
+when finished with it)
+*/
+
+gsl_spmatrix *
+gsl_spmatrix_fscanf_crs(FILE *stream)
+{
+  return gsl_spmatrix_fscanf_crs_parallel(stream, 1);
+} /* gsl_spmatrix_fscanf_crs() */
+
+/*
+gsl_spmatrix_fscanf_crs_parallel()
+  Read a MatrixMarket file directly into a newly allocated
+compressed row matrix, using nthreads threads
+
+Inputs: stream   - input stream
+        nthreads - number of threads
+
+Return: pointer to new matrix in CRS format (should be freed
+when finished with it)
+
+Notes:
+1) The lines are read in batches of SPIO_BATCH lines per thread,
+and the lines of a batch are parsed in parallel. Reading the stream
+and checking the parsed entries stays serial, so errors are reported
+for the first bad line as in gsl_spmatrix_fscanf().
+
+2) The entries are parsed straight into the column index and data
+arrays of the output matrix, with a temporary array holding the row
+index of each entry. The entries are then moved into their rows with
+an in-place bucket permutation, and each row is sorted by column. Peak
+memory is therefore 3*nz words plus the row pointers and one batch of
+lines, compared to the triplet arrays, the AVL tree nodes and the CRS
+copy for gsl_spmatrix_crs(gsl_spmatrix_fscanf(stream)).
+
+3) With several threads, the rows are split into one block per thread
+holding about nz/nthreads entries. A serial bucket permutation moves
+each entry into its block, and the threads then place and sort the
+rows of their own blocks.
+
+4) Zero entries are dropped, as in gsl_spmatrix_set(). Duplicate
+(i,j) entries are not merged; MatrixMarket coordinate files should
+not contain them
+*/
+
+gsl_spmatrix *
+gsl_spmatrix_fscanf_crs_parallel(FILE *stream, const size_t nthreads)
+{
+  const size_t nt = (nthreads == 0) ? 1 : nthreads;
+  gsl_spmatrix *m;
+  size_t size1, size2, nz;
+  size_t *Ti; /* row index of each entry */
+  size_t *Cj, *Cp, *w, *rb;
+  double *Cd;
+  size_t nb; /* number of row blocks */
+  size_t n, k, b;
+  spio_batch *batch;
+  spio_rows_params rows;
+  const char *reason = NULL;
+  int status;
+
+  status = spio_read_header(stream, &size1, &size2, &nz);
+  if (status)
+    {
+      GSL_ERROR_NULL ("fscanf failed reading header", GSL_EFAILED);
+    }
+
+  m = gsl_spmatrix_alloc_nzmax(size1, size2, nz, GSL_SPMATRIX_CRS);
+  if (!m)
+    {
+      GSL_ERROR_NULL ("error allocating m", GSL_ENOMEM);
+    }
+
+  Ti = malloc(m->nzmax * sizeof(size_t));
+  nb = GSL_MAX(GSL_MIN(nt, size1), 1);
+  rb = malloc((nb + 1) * sizeof(size_t));
+  batch = spio_batch_alloc(nt * SPIO_BATCH);
+  if (!Ti || !rb || !batch)
+    {
+      free(Ti);
+      free(rb);
+      spio_batch_free(batch);
+      gsl_spmatrix_free(m);
+      GSL_ERROR_NULL ("failed to allocate space for row indices", GSL_ENOMEM);
+    }
+
+  Cj = m->i;
+  Cp = m->p;
+  Cd = m->data;
+
+  for (n = 0; n < size1 + 1; ++n)
+    Cp[n] = 0;
+
+  /* parse entries and count the number of elements in each row */
+  n = 0;
+  while (spio_batch_read(batch, stream) > 0)
+    {
+      parallel_for(nt, batch->nlines, spio_parse_lines, batch);
+
+      for (k = 0; k < batch->nlines; ++k)
+        {
+          const size_t i = batch->i[k];
+          const size_t j = batch->j[k];
+          const double val = batch->x[k];
+
+          status = batch->status[k];
+          if (status == GSL_CONTINUE)
+            continue; /* blank line */
+
+          if (status || i == 0 || j == 0)
+            {
+              reason = "error in input file format";
+              status = GSL_EFAILED;
+            }
+          else if (i > size1 || j > size2)
+            {
+              reason = "element exceeds matrix dimensions";
+              status = GSL_EBADLEN;
+            }
+          else if (n >= m->nzmax)
+            {
+              reason = "file contains more elements than header nz";
+              status = GSL_EBADLEN;
+            }
+
+          if (status)
+            {
+              free(Ti);
+              free(rb);
+              spio_batch_free(batch);
+              gsl_spmatrix_free(m);
+              GSL_ERROR_NULL (reason, status);
+            }
+
+          if (val == 0.0)
+            continue;
+
+          Ti[n] = i - 1;
+          Cj[n] = j - 1;
+          Cd[n] = val;
+          Cp[i - 1]++;
+          ++n;
+        }
+    }
+
+  spio_batch_free(batch);
+
+  m->nz = n;
+
+  /* compute row pointers: p[i] = p[i-1] + nnz[i-1] */
+  gsl_spmatrix_cumsum(size1, Cp);
+
+  /* split the rows into blocks of about nz/nb entries each */
+  rb[0] = 0;
+  for (b = 1, k = 0; b < nb; ++b)
+    {
+      const size_t target = (b * m->nz) / nb;
+
+      while (k < size1 && Cp[k] < target)
+        ++k;
+
+      rb[b] = k;
+    }
+  rb[nb] = size1;
+
+  /* w[i] = next free slot in row i */
+  w = (size_t *) m->work;
+
+  if (nb > 1)
+    {
+      /* move each entry into the block of its row, using the first
+       * nb elements of w as the next free slot of each block */
+      for (b = 0; b < nb; ++b)
+        w[b] = Cp[rb[b]];
+
+      for (b = 0; b < nb; ++b)
+        {
+          while (w[b] < Cp[rb[b + 1]])
+            {
+              size_t dest;
+
+              k = w[b];
+              dest = spio_block(rb, nb, Ti[k]);
+
+              if (dest == b)
+                {
+                  ++w[b];
+                }
+              else
+                {
+                  spio_swap(Ti, Cj, Cd, w[dest]++, k);
+                }
+            }
+        }
+    }
+
+  for (n = 0; n < size1; ++n)
+    w[n] = Cp[n];
+
+  /* place and sort the rows of each block */
+  rows.Ti = Ti;
+  rows.Cj = Cj;
+  rows.Cd = Cd;
+  rows.Cp = Cp;
+  rows.w = w;
+  rows.rb = rb;
+
+  parallel_for(nb, nb, spio_place_rows, &rows);
+
+  free(Ti);
+  free(rb);
+
+  return m;
+} /* gsl_spmatrix_fscanf_crs_parallel() */
+
+/*
+gsl_spmatrix_fwrite()
+  Write sparse matrix to file in native binary format
+
+Inputs: stream - output stream
+        m      - matrix
+
+Return: success or error
+*/
+
+int
+gsl_spmatrix_fwrite(FILE *stream, const gsl_spmatrix *m)
+{
+  size_t items;
+
+  /* write header: size1, size2, nz */
+
+  items = fwrite(&(m->size1), sizeof(size_t), 1, stream);
+  if (items != 1)
+    {
+      GSL_ERROR("fwrite failed on size1", GSL_EFAILED);
+    }
+
+  items = fwrite(&(m->size2), sizeof(size_t), 1, stream);
+  if (items != 1)
+    {
+      GSL_ERROR("fwrite failed on size2", GSL_EFAILED);
+    }
+
+  items = fwrite(&(m->nz), sizeof(size_t), 1, stream);
+  if (items != 1)
+    {
+      GSL_ERROR("fwrite failed on nz", GSL_EFAILED);
+    }
+
+  /* write m->i and m->data which are size nz in all storage formats */
+
+  items = fwrite(m->i, sizeof(size_t), m->nz, stream);
+  if (items != m->nz)
+    {
+      GSL_ERROR("fwrite failed on row indices", GSL_EFAILED);
+    }
+
+  items = fwrite(m->data, sizeof(double), m->nz, stream);
+  if (items != m->nz)
+    {
+      GSL_ERROR("fwrite failed on data", GSL_EFAILED);
+    }
+
+  if (GSL_SPMATRIX_ISTRIPLET(m))
+    {
+      items = fwrite(m->p, sizeof(size_t), m->nz, stream);
+      if (items != m->nz)
+        {
+          GSL_ERROR("fwrite failed on column indices", GSL_EFAILED);
+        }
+    }
+  else if (GSL_SPMATRIX_ISCCS(m))
+    {
+      items = fwrite(m->p, sizeof(size_t), m->size2 + 1, stream);
+      if (items != m->size2 + 1)
+        {
+          GSL_ERROR("fwrite failed on column pointers", GSL_EFAILED);
+        }
+    }
+  else if (GSL_SPMATRIX_ISCRS(m))
+    {
+      items = fwrite(m->p, sizeof(size_t), m->size1 + 1, stream);
+      if (items != m->size1 + 1)
+        {
+          GSL_ERROR("fwrite failed on row pointers", GSL_EFAILED);
+        }
+    }
+
+  return GSL_SUCCESS;
+} /* gsl_spmatrix_fwrite() */
+
+/*
+gsl_spmatrix_fread()
+  Read sparse matrix in native binary format into a preallocated
+matrix of the correct type, dimensions and sufficient nzmax
+
+Inputs: stream - input stream
+        m      - (output) matrix
+
+Return: success or error
+*/
+
+int
+gsl_spmatrix_fread(FILE *stream, gsl_spmatrix *m)
+{
+  size_t size1, size2, nz;
+  size_t items;
+
+  /* read header: size1, size2, nz */
+
+  items = fread(&size1, sizeof(size_t), 1, stream);
+  if (items != 1)
+    {
+      GSL_ERROR("fread failed on size1", GSL_EFAILED);
+    }
+
+  items = fread(&size2, sizeof(size_t), 1, stream);
+  if (items != 1)
+    {
+      GSL_ERROR("fread failed on size2", GSL_EFAILED);
+    }
+
+  items = fread(&nz, sizeof(size_t), 1, stream);
+  if (items != 1)
+    {
+      GSL_ERROR("fread failed on nz", GSL_EFAILED);
+    }
+
+  if (m->size1 != size1)
+    {
+      GSL_ERROR("matrix has wrong size1", GSL_EBADLEN);
+    }
+  else if (m->size2 != size2)
+    {
+      GSL_ERROR("matrix has wrong size2", GSL_EBADLEN);
+    }
+  else if (nz > m->nzmax)
+    {
+      GSL_ERROR("matrix nzmax is too small", GSL_EBADLEN);
+    }
+  else
+    {
+      /* read into m->i and m->data arrays, which are size nz for all formats */
+
+      items = fread(m->i, sizeof(size_t), nz, stream);
+      if (items != nz)
+        {
+          GSL_ERROR("fread failed on row indices", GSL_EFAILED);
+        }
+
+      items = fread(m->data, sizeof(double), nz, stream);
+      if (items != nz)
+        {
+          GSL_ERROR("fread failed on data", GSL_EFAILED);
+        }
+
+      m->nz = nz;
+
+      if (GSL_SPMATRIX_ISTRIPLET(m))
+        {
+          int status;
+
+          items = fread(m->p, sizeof(size_t), nz, stream);
+          if (items != nz)
+            {
+              GSL_ERROR("fread failed on column indices", GSL_EFAILED);
+            }
+
+          /* build binary tree for triplet matrix */
+          status = gsl_spmatrix_tree_rebuild(m);
+          if (status)
+            return status;
+        }
+      else if (GSL_SPMATRIX_ISCCS(m))
+        {
+          items = fread(m->p, sizeof(size_t), size2 + 1, stream);
+          if (items != size2 + 1)
+            {
+              GSL_ERROR("fread failed on column pointers", GSL_EFAILED);
+            }
+        }
+      else if (GSL_SPMATRIX_ISCRS(m))
+        {
+          items = fread(m->p, sizeof(size_t), size1 + 1, stream);
+          if (items != size1 + 1)
+            {
+              GSL_ERROR("fread failed on row pointers", GSL_EFAILED);
+            }
+        }
+    }
+
+  return GSL_SUCCESS;
+} /* gsl_spmatrix_fread() */
+
+/*
+spio_read_header()
+  Skip MatrixMarket comment lines and read the "rows cols nz"
+size line
+
+Inputs: stream - input stream
+        size1  - (output) number of rows
+        size2  - (output) number of columns
+        nz     - (output) number of entries
+
+Return: success or GSL_EFAILED if no size line was found
+*/
+
+static int
+spio_read_header(FILE *stream, size_t *size1, size_t *size2, size_t *nz)
+{
+  char buf[SPIO_LINE_LEN];
+
+  while (fgets(buf, SPIO_LINE_LEN, stream) != NULL)
+    {
+      unsigned long n1, n2, nnz;
+      int c;
+
+      /* skip comments */
+      if (*buf == '%')
+        continue;
+
+      c = sscanf(buf, "%lu %lu %lu", &n1, &n2, &nnz);
+      if (c == 3)
+        {
+          *size1 = (size_t) n1;
+          *size2 = (size_t) n2;
+          *nz = (size_t) nnz;
+          return GSL_SUCCESS;
+        }
+    }
+
+  return GSL_EFAILED;
+} /* spio_read_header() */
+
+/*
+spio_parse_entry()
+  Parse an "i j x" coordinate line. This is the inner loop of
+both readers, so strtoul/strtod are used directly rather than
+sscanf
+
+Return: success, GSL_CONTINUE for a blank line, or GSL_EFAILED
+*/
+
+static int
+spio_parse_entry(const char *buf, size_t *i, size_t *j, double *x)
+{
+  char *end;
+  const char *s = buf;
+
+  while (*s == ' ' || *s == '\t')
+    ++s;
+
+  if (*s == '\n' || *s == '\r' || *s == '\0')
+    return GSL_CONTINUE;
+
+  *i = (size_t) strtoul(s, &end, 10);
+  if (end == s)
+    return GSL_EFAILED;
+
+  s = end;
+  *j = (size_t) strtoul(s, &end, 10);
+  if (end == s)
+    return GSL_EFAILED;
+
+  s = end;
+  *x = strtod(s, &end);
+  if (end == s)
+    return GSL_EFAILED;
+
+  return GSL_SUCCESS;
+} /* spio_parse_entry() */
+
+/*
+spio_sort_row()
+  Sort the column indices of a single CRS row, carrying the data
+along. Short rows use insertion sort; long (nearly dense) rows use
+heapsort to avoid quadratic behavior
+*/
+
+static void
+spio_sift_down(size_t *j, double *x, size_t k, const size_t n)
+{
+  while (2 * k + 1 < n)
+    {
+      size_t c = 2 * k + 1;
+      size_t tmpj;
+      double tmpx;
+
+      if (c + 1 < n && j[c + 1] > j[c])
+        ++c;
+
+      if (j[k] >= j[c])
+        break;
+
+      tmpj = j[k]; j[k] = j[c]; j[c] = tmpj;
+      tmpx = x[k]; x[k] = x[c]; x[c] = tmpx;
+      k = c;
+    }
+} /* spio_sift_down() */
+
+static void
+spio_sort_row(size_t *j, double *x, const size_t n)
+{
+  size_t k;
+
+  if (n > 32)
+    {
+      for (k = n / 2; k-- > 0; )
+        spio_sift_down(j, x, k, n);
+
+      for (k = n - 1; k > 0; --k)
+        {
+          size_t tmpj = j[0];
+          double tmpx = x[0];
+
+          j[0] = j[k]; j[k] = tmpj;
+          x[0] = x[k]; x[k] = tmpx;
+          spio_sift_down(j, x, 0, k);
+        }
+
+      return;
+    }
+
+  for (k = 1; k < n; ++k)
+    {
+      size_t jk = j[k];
+      double xk = x[k];
+      size_t l = k;
+
+      while (l > 0 && j[l - 1] > jk)
+        {
+          j[l] = j[l - 1];
+          x[l] = x[l - 1];
+          --l;
+        }
+
+      j[l] = jk;
+      x[l] = xk;
+    }
+} /* spio_sort_row() */
+
+/*
+spio_batch_alloc()
+  Allocate space for a batch of size lines and their entries
+*/
+
+static spio_batch *
+spio_batch_alloc(const size_t size)
+{
+  spio_batch *batch = malloc(sizeof(spio_batch));
+
+  if (!batch)
+    return NULL;
+
+  batch->size = size;
+  batch->nlines = 0;
+  batch->lines = malloc(size * SPIO_LINE_LEN);
+  batch->i = malloc(size * sizeof(size_t));
+  batch->j = malloc(size * sizeof(size_t));
+  batch->x = malloc(size * sizeof(double));
+  batch->status = malloc(size * sizeof(int));
+
+  if (!batch->lines || !batch->i || !batch->j || !batch->x || !batch->status)
+    {
+      spio_batch_free(batch);
+      return NULL;
+    }
+
+  return batch;
+} /* spio_batch_alloc() */
+
+static void
+spio_batch_free(spio_batch *batch)
+{
+  if (!batch)
+    return;
+
+  free(batch->lines);
+  free(batch->i);
+  free(batch->j);
+  free(batch->x);
+  free(batch->status);
+  free(batch);
+} /* spio_batch_free() */
+
+/*
+spio_batch_read()
+  Read the next batch of lines from the stream
+
+Return: number of lines read, 0 at the end of the stream
+*/
+
+static size_t
+spio_batch_read(spio_batch *batch, FILE *stream)
+{
+  size_t k = 0;
+
+  while (k < batch->size &&
+         fgets(batch->lines + k * SPIO_LINE_LEN, SPIO_LINE_LEN, stream) != NULL)
+    ++k;
+
+  batch->nlines = k;
+
+  return k;
+} /* spio_batch_read() */
+
+/*
+spio_parse_lines()
+  Parse lines begin .. end-1 of a batch; called by parallel_for()
+*/
+
+static int
+spio_parse_lines(void *vbatch, size_t thread, size_t begin, size_t end)
+{
+  spio_batch *batch = (spio_batch *) vbatch;
+  size_t k;
+
+  (void) thread;
+
+  for (k = begin; k < end; ++k)
+    {
+      batch->status[k] = spio_parse_entry(batch->lines + k * SPIO_LINE_LEN,
+                                          &batch->i[k], &batch->j[k],
+                                          &batch->x[k]);
+    }
+
+  return GSL_SUCCESS;
+} /* spio_parse_lines() */
+
+/*
+spio_block()
+  Find the block b with rb[b] <= row < rb[b+1]
+*/
+
+static size_t
+spio_block(const size_t *rb, const size_t nblocks, const size_t row)
+{
+  size_t lo = 0, hi = nblocks;
+
+  while (hi - lo > 1)
+    {
+      const size_t mid = (lo + hi) / 2;
+
+      if (rb[mid] <= row)
+        lo = mid;
+      else
+        hi = mid;
+    }
+
+  return lo;
+} /* spio_block() */
+
+static void
+spio_swap(size_t *Ti, size_t *Cj, double *Cd, const size_t a,
+          const size_t b)
+{
+  size_t tmpi;
+  double tmpd;
+
+  tmpi = Ti[a]; Ti[a] = Ti[b]; Ti[b] = tmpi;
+  tmpi = Cj[a]; Cj[a] = Cj[b]; Cj[b] = tmpi;
+  tmpd = Cd[a]; Cd[a] = Cd[b]; Cd[b] = tmpd;
+} /* spio_swap() */
+
+/*
+spio_place_rows()
+  Move the entries of blocks begin .. end-1 into their rows and sort
+each row by column; called by parallel_for(). The entries of a block
+must already lie in the slots of its rows.
+
+The entry at position k belongs to row Ti[k]; swap it into the next
+free slot of that row until the slot at k holds an entry of the row
+currently being filled
+*/
+
+static int
+spio_place_rows(void *vparams, size_t thread, size_t begin, size_t end)
+{
+  spio_rows_params *params = (spio_rows_params *) vparams;
+  size_t *Ti = params->Ti;
+  size_t *Cj = params->Cj;
+  double *Cd = params->Cd;
+  const size_t *Cp = params->Cp;
+  size_t *w = params->w;
+  size_t b, n;
+
+  (void) thread;
+
+  for (b = begin; b < end; ++b)
+    {
+      const size_t r0 = params->rb[b];
+      const size_t r1 = params->rb[b + 1];
+
+      for (n = r0; n < r1; ++n)
+        {
+          while (w[n] < Cp[n + 1])
+            {
+              const size_t k = w[n];
+              const size_t row = Ti[k];
+
+              if (row == n)
+                ++w[n];
+              else
+                spio_swap(Ti, Cj, Cd, w[row]++, k);
+            }
+        }
+
+      for (n = r0; n < r1; ++n)
+        spio_sort_row(Cj + Cp[n], Cd + Cp[n], Cp[n + 1] - Cp[n]);
+    }
+
+  return GSL_SUCCESS;
+} /* spio_place_rows() */
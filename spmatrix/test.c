@@ -20,6 +20,7 @@
 #include <config.h>
 #include <stdlib.h>
 #include <math.h>
+#include <string.h>
 #include <unistd.h>
 
 #include <gsl/gsl_math.h>
@@ -573,6 +574,62 @@ test_io_ascii(const size_t M, const size_t N,
     gsl_spmatrix_free(B);
   }
 
+  /* test direct MatrixMarket to CRS read */
+  {
+    FILE *f = fopen(filename, "r");
+    gsl_spmatrix *B = gsl_spmatrix_fscanf_crs(f);
+    size_t i, j, p;
+
+    status = !GSL_SPMATRIX_ISCRS(B) || B->nz != A->nz;
+
+    for (i = 0; i < M; ++i)
+      {
+        for (j = 0; j < N; ++j)
+          {
+            if (gsl_spmatrix_get(A, i, j) != gsl_spmatrix_get(B, i, j))
+              status = 1;
+          }
+
+        /* columns must be sorted within each row */
+        for (p = B->p[i] + 1; p < B->p[i + 1]; ++p)
+          {
+            if (B->i[p - 1] >= B->i[p])
+              status = 1;
+          }
+      }
+
+    gsl_test(status, "test_io_ascii: fprintf/fscanf_crs M=%zu N=%zu", M, N);
+
+    fclose(f);
+    gsl_spmatrix_free(B);
+  }
+
+  /* the threaded reader must give the same matrix */
+  {
+    const size_t nthreads[] = { 3, 7 };
+    size_t t;
+
+    for (t = 0; t < 2; ++t)
+      {
+        FILE *f = fopen(filename, "r");
+        gsl_spmatrix *B = gsl_spmatrix_fscanf_crs(f);
+        gsl_spmatrix *C;
+
+        rewind(f);
+        C = gsl_spmatrix_fscanf_crs_parallel(f, nthreads[t]);
+
+        status = gsl_spmatrix_equal(B, C) != 1 ||
+                 memcmp(B->p, C->p, (M + 1) * sizeof(size_t)) != 0 ||
+                 memcmp(B->i, C->i, B->nz * sizeof(size_t)) != 0;
+        gsl_test(status, "test_io_ascii: fscanf_crs_parallel M=%zu N=%zu nthreads=%zu",
+                 M, N, nthreads[t]);
+
+        fclose(f);
+        gsl_spmatrix_free(B);
+        gsl_spmatrix_free(C);
+      }
+  }
+
   /* test CCS I/O */
   {
     FILE *f = fopen(filename, "w");
@@ -744,6 +801,7 @@ main()
   test_io_ascii(20, 10, 0.2, r);
   test_io_ascii(10, 20, 0.2, r);
   test_io_ascii(34, 78, 0.3, r);
+  test_io_ascii(5, 300, 0.5, r);
 
   test_io_binary(50, 50, 0.3, r);
   test_io_binary(25, 10, 0.2, r);
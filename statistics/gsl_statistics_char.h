@@ -71,9 +71,21 @@ void gsl_stats_char_minmax (char * min, char * max, const char data[], const siz
 size_t gsl_stats_char_max_index (const char data[], const size_t stride, const size_t n);
 size_t gsl_stats_char_min_index (const char data[], const size_t stride, const size_t n);
 void gsl_stats_char_minmax_index (size_t * min_index, size_t * max_index, const char data[], const size_t stride, const size_t n);
+void gsl_stats_char_moments (double * mean, double * M2, double * M3, double * M4, char * min, char * max, const char data[], const size_t stride, const size_t n);
+
+double gsl_stats_char_mean_parallel (const char data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_char_variance_parallel (const char data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_char_sd_parallel (const char data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_char_covariance_parallel (const char data1[], const size_t stride1, const char data2[], const size_t stride2, const size_t n, const size_t nthreads);
+double gsl_stats_char_correlation_parallel (const char data1[], const size_t stride1, const char data2[], const size_t stride2, const size_t n, const size_t nthreads);
+void gsl_stats_char_minmax_parallel (char * min, char * max, const char data[], const size_t stride, const size_t n, const size_t nthreads);
+void gsl_stats_char_moments_parallel (double * mean, double * M2, double * M3, double * M4, char * min, char * max, const char data[], const size_t stride, const size_t n, const size_t nthreads);
 
 double gsl_stats_char_median_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_char_quantile_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n, const double f) ;
+char gsl_stats_char_select (char data[], const size_t stride, const size_t n, const size_t k);
+double gsl_stats_char_median (char data[], const size_t stride, const size_t n);
+int gsl_stats_char_quantiles (char data[], const size_t stride, const size_t n, const double p[], const size_t np, double q[]);
 
 __END_DECLS
 
@@ -91,9 +91,21 @@ void gsl_stats_minmax (double * min, double * max, const double data[], const si
 size_t gsl_stats_max_index (const double data[], const size_t stride, const size_t n);
 size_t gsl_stats_min_index (const double data[], const size_t stride, const size_t n);
 void gsl_stats_minmax_index (size_t * min_index, size_t * max_index, const double data[], const size_t stride, const size_t n);
+void gsl_stats_moments (double * mean, double * M2, double * M3, double * M4, double * min, double * max, const double data[], const size_t stride, const size_t n);
+
+double gsl_stats_mean_parallel (const double data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_variance_parallel (const double data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_sd_parallel (const double data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_covariance_parallel (const double data1[], const size_t stride1, const double data2[], const size_t stride2, const size_t n, const size_t nthreads);
+double gsl_stats_correlation_parallel (const double data1[], const size_t stride1, const double data2[], const size_t stride2, const size_t n, const size_t nthreads);
+void gsl_stats_minmax_parallel (double * min, double * max, const double data[], const size_t stride, const size_t n, const size_t nthreads);
+void gsl_stats_moments_parallel (double * mean, double * M2, double * M3, double * M4, double * min, double * max, const double data[], const size_t stride, const size_t n, const size_t nthreads);
 
 double gsl_stats_median_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_quantile_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n, const double f) ;
+double gsl_stats_select (double data[], const size_t stride, const size_t n, const size_t k);
+double gsl_stats_median (double data[], const size_t stride, const size_t n);
+int gsl_stats_quantiles (double data[], const size_t stride, const size_t n, const double p[], const size_t np, double q[]);
 
 __END_DECLS
 
@@ -91,9 +91,21 @@ void gsl_stats_float_minmax (float * min, float * max, const float data[], const
 size_t gsl_stats_float_max_index (const float data[], const size_t stride, const size_t n);
 size_t gsl_stats_float_min_index (const float data[], const size_t stride, const size_t n);
 void gsl_stats_float_minmax_index (size_t * min_index, size_t * max_index, const float data[], const size_t stride, const size_t n);
+void gsl_stats_float_moments (double * mean, double * M2, double * M3, double * M4, float * min, float * max, const float data[], const size_t stride, const size_t n);
+
+double gsl_stats_float_mean_parallel (const float data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_float_variance_parallel (const float data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_float_sd_parallel (const float data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_float_covariance_parallel (const float data1[], const size_t stride1, const float data2[], const size_t stride2, const size_t n, const size_t nthreads);
+double gsl_stats_float_correlation_parallel (const float data1[], const size_t stride1, const float data2[], const size_t stride2, const size_t n, const size_t nthreads);
+void gsl_stats_float_minmax_parallel (float * min, float * max, const float data[], const size_t stride, const size_t n, const size_t nthreads);
+void gsl_stats_float_moments_parallel (double * mean, double * M2, double * M3, double * M4, float * min, float * max, const float data[], const size_t stride, const size_t n, const size_t nthreads);
 
 double gsl_stats_float_median_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_float_quantile_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n, const double f) ;
+float gsl_stats_float_select (float data[], const size_t stride, const size_t n, const size_t k);
+double gsl_stats_float_median (float data[], const size_t stride, const size_t n);
+int gsl_stats_float_quantiles (float data[], const size_t stride, const size_t n, const double p[], const size_t np, double q[]);
 
 __END_DECLS
 
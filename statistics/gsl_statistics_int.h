@@ -71,9 +71,21 @@ void gsl_stats_int_minmax (int * min, int * max, const int data[], const size_t
 size_t gsl_stats_int_max_index (const int data[], const size_t stride, const size_t n);
 size_t gsl_stats_int_min_index (const int data[], const size_t stride, const size_t n);
 void gsl_stats_int_minmax_index (size_t * min_index, size_t * max_index, const int data[], const size_t stride, const size_t n);
+void gsl_stats_int_moments (double * mean, double * M2, double * M3, double * M4, int * min, int * max, const int data[], const size_t stride, const size_t n);
+
+double gsl_stats_int_mean_parallel (const int data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_int_variance_parallel (const int data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_int_sd_parallel (const int data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_int_covariance_parallel (const int data1[], const size_t stride1, const int data2[], const size_t stride2, const size_t n, const size_t nthreads);
+double gsl_stats_int_correlation_parallel (const int data1[], const size_t stride1, const int data2[], const size_t stride2, const size_t n, const size_t nthreads);
+void gsl_stats_int_minmax_parallel (int * min, int * max, const int data[], const size_t stride, const size_t n, const size_t nthreads);
+void gsl_stats_int_moments_parallel (double * mean, double * M2, double * M3, double * M4, int * min, int * max, const int data[], const size_t stride, const size_t n, const size_t nthreads);
 
 double gsl_stats_int_median_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_int_quantile_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_int_select (int data[], const size_t stride, const size_t n, const size_t k);
+double gsl_stats_int_median (int data[], const size_t stride, const size_t n);
+int gsl_stats_int_quantiles (int data[], const size_t stride, const size_t n, const double p[], const size_t np, double q[]);
 
 __END_DECLS
 
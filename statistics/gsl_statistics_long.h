@@ -71,9 +71,21 @@ void gsl_stats_long_minmax (long * min, long * max, const long data[], const siz
 size_t gsl_stats_long_max_index (const long data[], const size_t stride, const size_t n);
 size_t gsl_stats_long_min_index (const long data[], const size_t stride, const size_t n);
 void gsl_stats_long_minmax_index (size_t * min_index, size_t * max_index, const long data[], const size_t stride, const size_t n);
+void gsl_stats_long_moments (double * mean, double * M2, double * M3, double * M4, long * min, long * max, const long data[], const size_t stride, const size_t n);
+
+double gsl_stats_long_mean_parallel (const long data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_long_variance_parallel (const long data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_long_sd_parallel (const long data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_long_covariance_parallel (const long data1[], const size_t stride1, const long data2[], const size_t stride2, const size_t n, const size_t nthreads);
+double gsl_stats_long_correlation_parallel (const long data1[], const size_t stride1, const long data2[], const size_t stride2, const size_t n, const size_t nthreads);
+void gsl_stats_long_minmax_parallel (long * min, long * max, const long data[], const size_t stride, const size_t n, const size_t nthreads);
+void gsl_stats_long_moments_parallel (double * mean, double * M2, double * M3, double * M4, long * min, long * max, const long data[], const size_t stride, const size_t n, const size_t nthreads);
 
 double gsl_stats_long_median_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_quantile_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n, const double f) ;
+long gsl_stats_long_select (long data[], const size_t stride, const size_t n, const size_t k);
+double gsl_stats_long_median (long data[], const size_t stride, const size_t n);
+int gsl_stats_long_quantiles (long data[], const size_t stride, const size_t n, const double p[], const size_t np, double q[]);
 
 __END_DECLS
 
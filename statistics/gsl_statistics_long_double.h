@@ -91,9 +91,21 @@ void gsl_stats_long_double_minmax (long double * min, long double * max, const l
 size_t gsl_stats_long_double_max_index (const long double data[], const size_t stride, const size_t n);
 size_t gsl_stats_long_double_min_index (const long double data[], const size_t stride, const size_t n);
 void gsl_stats_long_double_minmax_index (size_t * min_index, size_t * max_index, const long double data[], const size_t stride, const size_t n);
+void gsl_stats_long_double_moments (double * mean, double * M2, double * M3, double * M4, long double * min, long double * max, const long double data[], const size_t stride, const size_t n);
+
+double gsl_stats_long_double_mean_parallel (const long double data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_long_double_variance_parallel (const long double data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_long_double_sd_parallel (const long double data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_long_double_covariance_parallel (const long double data1[], const size_t stride1, const long double data2[], const size_t stride2, const size_t n, const size_t nthreads);
+double gsl_stats_long_double_correlation_parallel (const long double data1[], const size_t stride1, const long double data2[], const size_t stride2, const size_t n, const size_t nthreads);
+void gsl_stats_long_double_minmax_parallel (long double * min, long double * max, const long double data[], const size_t stride, const size_t n, const size_t nthreads);
+void gsl_stats_long_double_moments_parallel (double * mean, double * M2, double * M3, double * M4, long double * min, long double * max, const long double data[], const size_t stride, const size_t n, const size_t nthreads);
 
 double gsl_stats_long_double_median_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_double_quantile_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n, const double f) ;
+long double gsl_stats_long_double_select (long double data[], const size_t stride, const size_t n, const size_t k);
+double gsl_stats_long_double_median (long double data[], const size_t stride, const size_t n);
+int gsl_stats_long_double_quantiles (long double data[], const size_t stride, const size_t n, const double p[], const size_t np, double q[]);
 
 __END_DECLS
 
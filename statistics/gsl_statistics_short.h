@@ -71,9 +71,21 @@ void gsl_stats_short_minmax (short * min, short * max, const short data[], const
 size_t gsl_stats_short_max_index (const short data[], const size_t stride, const size_t n);
 size_t gsl_stats_short_min_index (const short data[], const size_t stride, const size_t n);
 void gsl_stats_short_minmax_index (size_t * min_index, size_t * max_index, const short data[], const size_t stride, const size_t n);
+void gsl_stats_short_moments (double * mean, double * M2, double * M3, double * M4, short * min, short * max, const short data[], const size_t stride, const size_t n);
+
+double gsl_stats_short_mean_parallel (const short data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_short_variance_parallel (const short data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_short_sd_parallel (const short data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_short_covariance_parallel (const short data1[], const size_t stride1, const short data2[], const size_t stride2, const size_t n, const size_t nthreads);
+double gsl_stats_short_correlation_parallel (const short data1[], const size_t stride1, const short data2[], const size_t stride2, const size_t n, const size_t nthreads);
+void gsl_stats_short_minmax_parallel (short * min, short * max, const short data[], const size_t stride, const size_t n, const size_t nthreads);
+void gsl_stats_short_moments_parallel (double * mean, double * M2, double * M3, double * M4, short * min, short * max, const short data[], const size_t stride, const size_t n, const size_t nthreads);
 
 double gsl_stats_short_median_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_short_quantile_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n, const double f) ;
+short gsl_stats_short_select (short data[], const size_t stride, const size_t n, const size_t k);
+double gsl_stats_short_median (short data[], const size_t stride, const size_t n);
+int gsl_stats_short_quantiles (short data[], const size_t stride, const size_t n, const double p[], const size_t np, double q[]);
 
 __END_DECLS
 
@@ -71,9 +71,21 @@ void gsl_stats_uchar_minmax (unsigned char * min, unsigned char * max, const uns
 size_t gsl_stats_uchar_max_index (const unsigned char data[], const size_t stride, const size_t n);
 size_t gsl_stats_uchar_min_index (const unsigned char data[], const size_t stride, const size_t n);
 void gsl_stats_uchar_minmax_index (size_t * min_index, size_t * max_index, const unsigned char data[], const size_t stride, const size_t n);
+void gsl_stats_uchar_moments (double * mean, double * M2, double * M3, double * M4, unsigned char * min, unsigned char * max, const unsigned char data[], const size_t stride, const size_t n);
+
+double gsl_stats_uchar_mean_parallel (const unsigned char data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_uchar_variance_parallel (const unsigned char data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_uchar_sd_parallel (const unsigned char data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_uchar_covariance_parallel (const unsigned char data1[], const size_t stride1, const unsigned char data2[], const size_t stride2, const size_t n, const size_t nthreads);
+double gsl_stats_uchar_correlation_parallel (const unsigned char data1[], const size_t stride1, const unsigned char data2[], const size_t stride2, const size_t n, const size_t nthreads);
+void gsl_stats_uchar_minmax_parallel (unsigned char * min, unsigned char * max, const unsigned char data[], const size_t stride, const size_t n, const size_t nthreads);
+void gsl_stats_uchar_moments_parallel (double * mean, double * M2, double * M3, double * M4, unsigned char * min, unsigned char * max, const unsigned char data[], const size_t stride, const size_t n, const size_t nthreads);
 
 double gsl_stats_uchar_median_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uchar_quantile_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n, const double f) ;
+unsigned char gsl_stats_uchar_select (unsigned char data[], const size_t stride, const size_t n, const size_t k);
+double gsl_stats_uchar_median (unsigned char data[], const size_t stride, const size_t n);
+int gsl_stats_uchar_quantiles (unsigned char data[], const size_t stride, const size_t n, const double p[], const size_t np, double q[]);
 
 __END_DECLS
 
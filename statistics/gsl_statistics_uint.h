@@ -71,9 +71,21 @@ void gsl_stats_uint_minmax (unsigned int * min, unsigned int * max, const unsign
 size_t gsl_stats_uint_max_index (const unsigned int data[], const size_t stride, const size_t n);
 size_t gsl_stats_uint_min_index (const unsigned int data[], const size_t stride, const size_t n);
 void gsl_stats_uint_minmax_index (size_t * min_index, size_t * max_index, const unsigned int data[], const size_t stride, const size_t n);
+void gsl_stats_uint_moments (double * mean, double * M2, double * M3, double * M4, unsigned int * min, unsigned int * max, const unsigned int data[], const size_t stride, const size_t n);
+
+double gsl_stats_uint_mean_parallel (const unsigned int data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_uint_variance_parallel (const unsigned int data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_uint_sd_parallel (const unsigned int data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_uint_covariance_parallel (const unsigned int data1[], const size_t stride1, const unsigned int data2[], const size_t stride2, const size_t n, const size_t nthreads);
+double gsl_stats_uint_correlation_parallel (const unsigned int data1[], const size_t stride1, const unsigned int data2[], const size_t stride2, const size_t n, const size_t nthreads);
+void gsl_stats_uint_minmax_parallel (unsigned int * min, unsigned int * max, const unsigned int data[], const size_t stride, const size_t n, const size_t nthreads);
+void gsl_stats_uint_moments_parallel (double * mean, double * M2, double * M3, double * M4, unsigned int * min, unsigned int * max, const unsigned int data[], const size_t stride, const size_t n, const size_t nthreads);
 
 double gsl_stats_uint_median_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uint_quantile_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n, const double f) ;
+unsigned int gsl_stats_uint_select (unsigned int data[], const size_t stride, const size_t n, const size_t k);
+double gsl_stats_uint_median (unsigned int data[], const size_t stride, const size_t n);
+int gsl_stats_uint_quantiles (unsigned int data[], const size_t stride, const size_t n, const double p[], const size_t np, double q[]);
 
 __END_DECLS
 
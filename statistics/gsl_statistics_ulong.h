@@ -71,9 +71,21 @@ void gsl_stats_ulong_minmax (unsigned long * min, unsigned long * max, const uns
 size_t gsl_stats_ulong_max_index (const unsigned long data[], const size_t stride, const size_t n);
 size_t gsl_stats_ulong_min_index (const unsigned long data[], const size_t stride, const size_t n);
 void gsl_stats_ulong_minmax_index (size_t * min_index, size_t * max_index, const unsigned long data[], const size_t stride, const size_t n);
+void gsl_stats_ulong_moments (double * mean, double * M2, double * M3, double * M4, unsigned long * min, unsigned long * max, const unsigned long data[], const size_t stride, const size_t n);
+
+double gsl_stats_ulong_mean_parallel (const unsigned long data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_ulong_variance_parallel (const unsigned long data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_ulong_sd_parallel (const unsigned long data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_ulong_covariance_parallel (const unsigned long data1[], const size_t stride1, const unsigned long data2[], const size_t stride2, const size_t n, const size_t nthreads);
+double gsl_stats_ulong_correlation_parallel (const unsigned long data1[], const size_t stride1, const unsigned long data2[], const size_t stride2, const size_t n, const size_t nthreads);
+void gsl_stats_ulong_minmax_parallel (unsigned long * min, unsigned long * max, const unsigned long data[], const size_t stride, const size_t n, const size_t nthreads);
+void gsl_stats_ulong_moments_parallel (double * mean, double * M2, double * M3, double * M4, unsigned long * min, unsigned long * max, const unsigned long data[], const size_t stride, const size_t n, const size_t nthreads);
 
 double gsl_stats_ulong_median_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ulong_quantile_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n, const double f) ;
+unsigned long gsl_stats_ulong_select (unsigned long data[], const size_t stride, const size_t n, const size_t k);
+double gsl_stats_ulong_median (unsigned long data[], const size_t stride, const size_t n);
+int gsl_stats_ulong_quantiles (unsigned long data[], const size_t stride, const size_t n, const double p[], const size_t np, double q[]);
 
 __END_DECLS
 
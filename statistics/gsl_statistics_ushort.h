@@ -71,9 +71,21 @@ void gsl_stats_ushort_minmax (unsigned short * min, unsigned short * max, const
 size_t gsl_stats_ushort_max_index (const unsigned short data[], const size_t stride, const size_t n);
 size_t gsl_stats_ushort_min_index (const unsigned short data[], const size_t stride, const size_t n);
 void gsl_stats_ushort_minmax_index (size_t * min_index, size_t * max_index, const unsigned short data[], const size_t stride, const size_t n);
+void gsl_stats_ushort_moments (double * mean, double * M2, double * M3, double * M4, unsigned short * min, unsigned short * max, const unsigned short data[], const size_t stride, const size_t n);
+
+double gsl_stats_ushort_mean_parallel (const unsigned short data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_ushort_variance_parallel (const unsigned short data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_ushort_sd_parallel (const unsigned short data[], const size_t stride, const size_t n, const size_t nthreads);
+double gsl_stats_ushort_covariance_parallel (const unsigned short data1[], const size_t stride1, const unsigned short data2[], const size_t stride2, const size_t n, const size_t nthreads);
+double gsl_stats_ushort_correlation_parallel (const unsigned short data1[], const size_t stride1, const unsigned short data2[], const size_t stride2, const size_t n, const size_t nthreads);
+void gsl_stats_ushort_minmax_parallel (unsigned short * min, unsigned short * max, const unsigned short data[], const size_t stride, const size_t n, const size_t nthreads);
+void gsl_stats_ushort_moments_parallel (double * mean, double * M2, double * M3, double * M4, unsigned short * min, unsigned short * max, const unsigned short data[], const size_t stride, const size_t n, const size_t nthreads);
 
 double gsl_stats_ushort_median_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ushort_quantile_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n, const double f) ;
+unsigned short gsl_stats_ushort_select (unsigned short data[], const size_t stride, const size_t n, const size_t k);
+double gsl_stats_ushort_median (unsigned short data[], const size_t stride, const size_t n);
+int gsl_stats_ushort_quantiles (unsigned short data[], const size_t stride, const size_t n, const double p[], const size_t np, double q[]);
 
 __END_DECLS
 
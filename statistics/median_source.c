@@ -42,3 +42,40 @@ FUNCTION(gsl_stats,median_from_sorted_data) (const BASE sorted_data[],
   return median ;
 }
 
+
+double
+FUNCTION(gsl_stats,median) (BASE data[], const size_t stride, const size_t n)
+{
+  double median ;
+  const size_t lhs = (n - 1) / 2 ;
+  const size_t rhs = n / 2 ;
+  BASE x, y ;
+  size_t i ;
+
+  if (n == 0)
+    return 0.0 ;
+
+  y = FUNCTION(gsl_stats,select) (data, stride, n, rhs) ;
+
+  if (lhs == rhs)
+    {
+      median = y ;
+    }
+  else
+    {
+      /* the elements before rhs are the smallest, and the largest of
+         them is the lhs-th */
+
+      x = data[0] ;
+
+      for (i = 1; i < rhs; i++)
+        {
+          if (data[i * stride] > x)
+            x = data[i * stride] ;
+        }
+
+      median = (x + y)/2.0 ;
+    }
+
+  return median ;
+}
@@ -0,0 +1,67 @@
+/* statistics/moments.h
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* the data are reduced in blocks of MOMENTS_BLOCK values, each summed
+   in MOMENTS_LANES independent partial sums */
+
+#define MOMENTS_BLOCK 256
+#define MOMENTS_LANES 8
+
+/* Combine the mean and the sums of powers of the deviations m[] of na
+   values with those mb[] of nb further values, as in
+     Chan, Golub and LeVeque, Updating Formulae and a Pairwise Algorithm
+       for Computing Sample Variances, Stanford CS-79-773 (1979)
+     Pebay, Formulas for Robust, One-Pass Parallel Computation of
+       Covariances and Arbitrary-Order Statistical Moments, Sandia
+       SAND2008-6212 (2008)
+   The higher sums are updated first since they use the lower ones. */
+
+static inline void
+moments_merge (long double m[4], const size_t na, const long double mb[4],
+               const size_t nb)
+{
+  const long double a = na, b = nb, n = a + b;
+  const long double delta = mb[0] - m[0];
+  const long double dn = delta / n, dn2 = dn * dn;
+  const long double t = delta * dn * a * b;
+
+  m[3] += mb[3] + t * dn2 * (a * a - a * b + b * b)
+    + 6 * dn2 * (a * a * mb[1] + b * b * m[1])
+    + 4 * dn * (a * mb[2] - b * m[2]);
+  m[2] += mb[2] + t * dn * (a - b) + 3 * dn * (a * mb[1] - b * m[1]);
+  m[1] += mb[1] + t;
+  m[0] += b * dn;
+}
+
+/* Combine the means and the sums of squares and products of the
+   deviations c[] = (mean1, mean2, M2_1, M2_2, C_12) of na pairs of
+   values with those cb[] of nb further pairs, in the same way. */
+
+static inline void
+comoments_merge (long double c[5], const size_t na, const long double cb[5],
+                 const size_t nb)
+{
+  const long double a = na, b = nb, n = a + b;
+  const long double delta1 = cb[0] - c[0], delta2 = cb[1] - c[1];
+  const long double f = a * b / n;
+
+  c[4] += cb[4] + delta1 * delta2 * f;
+  c[3] += cb[3] + delta2 * delta2 * f;
+  c[2] += cb[2] + delta1 * delta1 * f;
+  c[1] += delta2 * b / n;
+  c[0] += delta1 * b / n;
+}
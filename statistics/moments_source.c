@@ -0,0 +1,213 @@
+/* statistics/moments_source.c
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* the blocks are reduced in double precision, or in long double
+   precision for long double data */
+
+#ifdef BASE_LONG_DOUBLE
+#define MOMENTS_REAL long double
+#else
+#define MOMENTS_REAL double
+#endif
+
+static void FUNCTION (moments,block) (long double m[4], BASE * min_out,
+                                      BASE * max_out, const BASE data[],
+                                      const size_t stride,
+                                      const size_t n) GSL_VECTORIZE;
+
+static void
+FUNCTION (moments,block) (long double m[4], BASE * min_out, BASE * max_out,
+                          const BASE data[], const size_t stride,
+                          const size_t n)
+{
+  /* finds the mean m[0], the sums of the second, third and fourth
+     powers of the deviations m[1], m[2], m[3], and the extremes of a
+     block of 0 < n <= MOMENTS_BLOCK values, by two passes over a copy
+     of the block */
+
+  MOMENTS_REAL x[MOMENTS_BLOCK];
+  MOMENTS_REAL s1[MOMENTS_LANES], s2[MOMENTS_LANES];
+  MOMENTS_REAL s3[MOMENTS_LANES], s4[MOMENTS_LANES];
+  BASE lo[MOMENTS_LANES], hi[MOMENTS_LANES];
+  MOMENTS_REAL mean;
+  size_t i;
+  int l;
+
+  for (l = 0; l < MOMENTS_LANES; l++)
+    {
+      s1[l] = 0;
+      s2[l] = 0;
+      s3[l] = 0;
+      s4[l] = 0;
+      lo[l] = data[0];
+      hi[l] = data[0];
+    }
+
+  /* copy the block, with the extremes and the sum of the values */
+
+  for (i = 0; i + MOMENTS_LANES <= n; i += MOMENTS_LANES)
+    {
+      for (l = 0; l < MOMENTS_LANES; l++)
+        {
+          const BASE xi = data[(i + l) * stride];
+
+          x[i + l] = xi;
+          lo[l] = (xi < lo[l]) ? xi : lo[l];
+          hi[l] = (xi > hi[l]) ? xi : hi[l];
+          s1[l] += xi;
+        }
+    }
+
+  for (; i < n; i++)
+    {
+      const BASE xi = data[i * stride];
+
+      x[i] = xi;
+      lo[0] = (xi < lo[0]) ? xi : lo[0];
+      hi[0] = (xi > hi[0]) ? xi : hi[0];
+      s1[0] += xi;
+    }
+
+  for (l = 1; l < MOMENTS_LANES; l++)
+    {
+      s1[0] += s1[l];
+      lo[0] = (lo[l] < lo[0]) ? lo[l] : lo[0];
+      hi[0] = (hi[l] > hi[0]) ? hi[l] : hi[0];
+    }
+
+  mean = s1[0] / n;
+
+  /* the sums of powers of the deviations */
+
+  for (i = 0; i + MOMENTS_LANES <= n; i += MOMENTS_LANES)
+    {
+      for (l = 0; l < MOMENTS_LANES; l++)
+        {
+          const MOMENTS_REAL d = x[i + l] - mean;
+          const MOMENTS_REAL d2 = d * d;
+
+          s2[l] += d2;
+          s3[l] += d2 * d;
+          s4[l] += d2 * d2;
+        }
+    }
+
+  for (; i < n; i++)
+    {
+      const MOMENTS_REAL d = x[i] - mean;
+      const MOMENTS_REAL d2 = d * d;
+
+      s2[0] += d2;
+      s3[0] += d2 * d;
+      s4[0] += d2 * d2;
+    }
+
+  for (l = 1; l < MOMENTS_LANES; l++)
+    {
+      s2[0] += s2[l];
+      s3[0] += s3[l];
+      s4[0] += s4[l];
+    }
+
+  m[0] = mean;
+  m[1] = s2[0];
+  m[2] = s3[0];
+  m[3] = s4[0];
+
+#ifdef FP
+  /* a nan in the block makes the sum a nan, as do infinities of both
+     signs, in which case the block is searched for the nan */
+
+  if (isnan (mean))
+    {
+      for (i = 0; i < n; i++)
+        {
+          if (isnan (x[i]))
+            {
+              lo[0] = data[i * stride];
+              hi[0] = data[i * stride];
+              break;
+            }
+        }
+    }
+#endif
+
+  *min_out = lo[0];
+  *max_out = hi[0];
+}
+
+void
+FUNCTION (gsl_stats,moments) (double * mean_out, double * M2_out,
+                              double * M3_out, double * M4_out,
+                              BASE * min_out, BASE * max_out,
+                              const BASE data[], const size_t stride,
+                              const size_t n)
+{
+  /* finds the mean, the sums of the second, third and fourth powers of
+     the deviations from the mean, and the smallest and largest members
+     of a dataset in a single pass, merging the results of successive
+     blocks */
+
+  long double m[4] = { 0, 0, 0, 0 };
+  BASE min = 0, max = 0;
+  size_t i;
+
+  for (i = 0; i < n; i += MOMENTS_BLOCK)
+    {
+      const size_t nb = (n - i < MOMENTS_BLOCK) ? n - i : MOMENTS_BLOCK;
+      long double mb[4];
+      BASE lo, hi;
+
+      FUNCTION (moments,block) (mb, &lo, &hi, data + i * stride, stride, nb);
+
+      if (i == 0)
+        {
+          m[0] = mb[0];
+          m[1] = mb[1];
+          m[2] = mb[2];
+          m[3] = mb[3];
+          min = lo;
+          max = hi;
+          continue;
+        }
+
+      moments_merge (m, i, mb, nb);
+
+      if (lo < min)
+        min = lo;
+
+      if (hi > max)
+        max = hi;
+
+#ifdef FP
+      if (isnan (lo))
+        {
+          min = lo;
+          max = hi;
+        }
+#endif
+    }
+
+  *mean_out = m[0];
+  *M2_out = m[1];
+  *M3_out = m[2];
+  *M4_out = m[3];
+  *min_out = min;
+  *max_out = max;
+}
+
+#undef MOMENTS_REAL
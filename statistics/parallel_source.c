@@ -0,0 +1,591 @@
+/* statistics/parallel_source.c
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifdef BASE_LONG_DOUBLE
+#define PARALLEL_REAL long double
+#else
+#define PARALLEL_REAL double
+#endif
+
+/* the data of a threaded reduction, with the results m[] of each chunk
+   (four or five values per chunk) and their extremes */
+
+typedef struct
+  {
+    const BASE * data1;
+    size_t stride1;
+    const BASE * data2;
+    size_t stride2;
+    size_t n;
+    long double * m;
+    BASE * min;
+    BASE * max;
+  }
+FUNCTION (stats_parallel,ctx);
+
+static void
+FUNCTION (stats_parallel,moments_chunk) (long double m[4], BASE * min,
+                                         BASE * max, const BASE data[],
+                                         const size_t stride, const size_t n,
+                                         const size_t c)
+{
+  /* finds the moments of chunk c with gsl_stats_moments */
+
+  const size_t offset = c * PARALLEL_CHUNK;
+  const size_t nc = (n - offset < PARALLEL_CHUNK) ? n - offset : PARALLEL_CHUNK;
+  double mean, M2, M3, M4;
+
+  FUNCTION (gsl_stats,moments) (&mean, &M2, &M3, &M4, min, max,
+                                data + offset * stride, stride, nc);
+
+  m[0] = mean;
+  m[1] = M2;
+  m[2] = M3;
+  m[3] = M4;
+}
+
+static int
+FUNCTION (stats_parallel,moments_range) (void * vctx, size_t thread,
+                                         size_t begin, size_t end)
+{
+  FUNCTION (stats_parallel,ctx) * ctx = (FUNCTION (stats_parallel,ctx) *) vctx;
+  size_t c;
+
+  for (c = begin; c < end; c++)
+    {
+      FUNCTION (stats_parallel,moments_chunk) (ctx->m + 4 * c, ctx->min + c,
+                                               ctx->max + c, ctx->data1,
+                                               ctx->stride1, ctx->n, c);
+    }
+
+  return GSL_SUCCESS;
+}
+
+static void
+FUNCTION (stats_parallel,moments) (long double m[4], BASE * min_out,
+                                   BASE * max_out, const BASE data[],
+                                   const size_t stride, const size_t n,
+                                   const size_t nthreads)
+{
+  /* finds the moments of each chunk, in nthreads threads when they can
+     be stored, and merges them in order */
+
+  const size_t nchunks = (n + PARALLEL_CHUNK - 1) / PARALLEL_CHUNK;
+  FUNCTION (stats_parallel,ctx) ctx;
+  BASE min = 0, max = 0;
+  size_t c;
+
+  ctx.data1 = data;
+  ctx.stride1 = stride;
+  ctx.n = n;
+  ctx.m = NULL;
+  ctx.min = NULL;
+  ctx.max = NULL;
+
+  if (nthreads > 1 && nchunks > 1)
+    {
+      ctx.m = (long double *) malloc (4 * nchunks * sizeof (long double));
+      ctx.min = (BASE *) malloc (nchunks * sizeof (BASE));
+      ctx.max = (BASE *) malloc (nchunks * sizeof (BASE));
+
+      if (ctx.m == NULL || ctx.min == NULL || ctx.max == NULL)
+        {
+          /* merge the chunks as they are computed instead */
+
+          free (ctx.m);
+          free (ctx.min);
+          free (ctx.max);
+          ctx.m = NULL;
+        }
+      else
+        {
+          parallel_for (nthreads, nchunks,
+                        FUNCTION (stats_parallel,moments_range), &ctx);
+        }
+    }
+
+  m[0] = 0;
+  m[1] = 0;
+  m[2] = 0;
+  m[3] = 0;
+
+  for (c = 0; c < nchunks; c++)
+    {
+      long double mc[4];
+      BASE lo, hi;
+
+      if (ctx.m != NULL)
+        {
+          mc[0] = ctx.m[4 * c];
+          mc[1] = ctx.m[4 * c + 1];
+          mc[2] = ctx.m[4 * c + 2];
+          mc[3] = ctx.m[4 * c + 3];
+          lo = ctx.min[c];
+          hi = ctx.max[c];
+        }
+      else
+        {
+          FUNCTION (stats_parallel,moments_chunk) (mc, &lo, &hi, data, stride,
+                                                   n, c);
+        }
+
+      if (c == 0)
+        {
+          m[0] = mc[0];
+          m[1] = mc[1];
+          m[2] = mc[2];
+          m[3] = mc[3];
+          min = lo;
+          max = hi;
+          continue;
+        }
+
+      moments_merge (m, c * PARALLEL_CHUNK, mc,
+                     GSL_MIN (n - c * PARALLEL_CHUNK, PARALLEL_CHUNK));
+
+      if (lo < min)
+        min = lo;
+
+      if (hi > max)
+        max = hi;
+
+#ifdef FP
+      if (isnan (lo))
+        {
+          min = lo;
+          max = hi;
+        }
+#endif
+    }
+
+  if (ctx.m != NULL)
+    {
+      free (ctx.m);
+      free (ctx.min);
+      free (ctx.max);
+    }
+
+  *min_out = min;
+  *max_out = max;
+}
+
+static int
+FUNCTION (stats_parallel,minmax_range) (void * vctx, size_t thread,
+                                        size_t begin, size_t end)
+{
+  FUNCTION (stats_parallel,ctx) * ctx = (FUNCTION (stats_parallel,ctx) *) vctx;
+  size_t c;
+
+  for (c = begin; c < end; c++)
+    {
+      const size_t offset = c * PARALLEL_CHUNK;
+      const size_t nc = GSL_MIN (ctx->n - offset, PARALLEL_CHUNK);
+
+      FUNCTION (gsl_stats,minmax) (ctx->min + c, ctx->max + c,
+                                   ctx->data1 + offset * ctx->stride1,
+                                   ctx->stride1, nc);
+    }
+
+  return GSL_SUCCESS;
+}
+
+static void
+FUNCTION (stats_parallel,minmax) (BASE * min_out, BASE * max_out,
+                                  const BASE data[], const size_t stride,
+                                  const size_t n, const size_t nthreads)
+{
+  /* finds the extremes of each chunk in nthreads threads, or of the
+     whole data in this thread if they cannot be stored */
+
+  const size_t nchunks = (n + PARALLEL_CHUNK - 1) / PARALLEL_CHUNK;
+  FUNCTION (stats_parallel,ctx) ctx;
+  BASE min, max;
+  size_t c;
+
+  if (n == 0)
+    {
+      *min_out = 0;
+      *max_out = 0;
+      return;
+    }
+
+  ctx.data1 = data;
+  ctx.stride1 = stride;
+  ctx.n = n;
+  ctx.min = NULL;
+  ctx.max = NULL;
+
+  if (nthreads > 1 && nchunks > 1)
+    {
+      ctx.min = (BASE *) malloc (nchunks * sizeof (BASE));
+      ctx.max = (BASE *) malloc (nchunks * sizeof (BASE));
+    }
+
+  if (ctx.min == NULL || ctx.max == NULL)
+    {
+      free (ctx.min);
+      free (ctx.max);
+
+      FUNCTION (gsl_stats,minmax) (min_out, max_out, data, stride, n);
+      return;
+    }
+
+  parallel_for (nthreads, nchunks, FUNCTION (stats_parallel,minmax_range),
+                &ctx);
+
+  min = ctx.min[0];
+  max = ctx.max[0];
+
+  for (c = 1; c < nchunks; c++)
+    {
+      if (ctx.min[c] < min)
+        min = ctx.min[c];
+
+      if (ctx.max[c] > max)
+        max = ctx.max[c];
+
+#ifdef FP
+      if (isnan (ctx.min[c]))
+        {
+          min = ctx.min[c];
+          max = ctx.max[c];
+        }
+#endif
+    }
+
+  free (ctx.min);
+  free (ctx.max);
+
+  *min_out = min;
+  *max_out = max;
+}
+
+static void FUNCTION (stats_parallel,comoments_block) (long double m[5],
+                                                       const BASE data1[],
+                                                       const size_t stride1,
+                                                       const BASE data2[],
+                                                       const size_t stride2,
+                                                       const size_t n) GSL_VECTORIZE;
+
+static void
+FUNCTION (stats_parallel,comoments_block) (long double m[5],
+                                           const BASE data1[],
+                                           const size_t stride1,
+                                           const BASE data2[],
+                                           const size_t stride2,
+                                           const size_t n)
+{
+  /* finds the means, the sums of squares of the deviations and the sum
+     of their products of a block of 0 < n <= MOMENTS_BLOCK pairs, by
+     two passes over a copy of the block as in gsl_stats_moments */
+
+  PARALLEL_REAL x[MOMENTS_BLOCK], y[MOMENTS_BLOCK];
+  PARALLEL_REAL sx[MOMENTS_LANES], sy[MOMENTS_LANES];
+  PARALLEL_REAL sxx[MOMENTS_LANES], syy[MOMENTS_LANES], sxy[MOMENTS_LANES];
+  PARALLEL_REAL mean_x, mean_y;
+  size_t i;
+  int l;
+
+  for (l = 0; l < MOMENTS_LANES; l++)
+    {
+      sx[l] = 0;
+      sy[l] = 0;
+      sxx[l] = 0;
+      syy[l] = 0;
+      sxy[l] = 0;
+    }
+
+  for (i = 0; i + MOMENTS_LANES <= n; i += MOMENTS_LANES)
+    {
+      for (l = 0; l < MOMENTS_LANES; l++)
+        {
+          x[i + l] = data1[(i + l) * stride1];
+          y[i + l] = data2[(i + l) * stride2];
+          sx[l] += x[i + l];
+          sy[l] += y[i + l];
+        }
+    }
+
+  for (; i < n; i++)
+    {
+      x[i] = data1[i * stride1];
+      y[i] = data2[i * stride2];
+      sx[0] += x[i];
+      sy[0] += y[i];
+    }
+
+  for (l = 1; l < MOMENTS_LANES; l++)
+    {
+      sx[0] += sx[l];
+      sy[0] += sy[l];
+    }
+
+  mean_x = sx[0] / n;
+  mean_y = sy[0] / n;
+
+  for (i = 0; i + MOMENTS_LANES <= n; i += MOMENTS_LANES)
+    {
+      for (l = 0; l < MOMENTS_LANES; l++)
+        {
+          const PARALLEL_REAL dx = x[i + l] - mean_x;
+          const PARALLEL_REAL dy = y[i + l] - mean_y;
+
+          sxx[l] += dx * dx;
+          syy[l] += dy * dy;
+          sxy[l] += dx * dy;
+        }
+    }
+
+  for (; i < n; i++)
+    {
+      const PARALLEL_REAL dx = x[i] - mean_x;
+      const PARALLEL_REAL dy = y[i] - mean_y;
+
+      sxx[0] += dx * dx;
+      syy[0] += dy * dy;
+      sxy[0] += dx * dy;
+    }
+
+  for (l = 1; l < MOMENTS_LANES; l++)
+    {
+      sxx[0] += sxx[l];
+      syy[0] += syy[l];
+      sxy[0] += sxy[l];
+    }
+
+  m[0] = mean_x;
+  m[1] = mean_y;
+  m[2] = sxx[0];
+  m[3] = syy[0];
+  m[4] = sxy[0];
+}
+
+static void
+FUNCTION (stats_parallel,comoments_chunk) (long double m[5],
+                                           const BASE data1[],
+                                           const size_t stride1,
+                                           const BASE data2[],
+                                           const size_t stride2,
+                                           const size_t n, const size_t c)
+{
+  /* merges the blocks of chunk c */
+
+  const size_t offset = c * PARALLEL_CHUNK;
+  const size_t nc = (n - offset < PARALLEL_CHUNK) ? n - offset : PARALLEL_CHUNK;
+  size_t i;
+
+  for (i = 0; i < nc; i += MOMENTS_BLOCK)
+    {
+      const size_t nb = (nc - i < MOMENTS_BLOCK) ? nc - i : MOMENTS_BLOCK;
+      long double mb[5];
+
+      FUNCTION (stats_parallel,comoments_block) (mb,
+                                                 data1 + (offset + i) * stride1,
+                                                 stride1,
+                                                 data2 + (offset + i) * stride2,
+                                                 stride2, nb);
+
+      if (i == 0)
+        {
+          int k;
+
+          for (k = 0; k < 5; k++)
+            m[k] = mb[k];
+        }
+      else
+        {
+          comoments_merge (m, i, mb, nb);
+        }
+    }
+}
+
+static int
+FUNCTION (stats_parallel,comoments_range) (void * vctx, size_t thread,
+                                           size_t begin, size_t end)
+{
+  FUNCTION (stats_parallel,ctx) * ctx = (FUNCTION (stats_parallel,ctx) *) vctx;
+  size_t c;
+
+  for (c = begin; c < end; c++)
+    {
+      FUNCTION (stats_parallel,comoments_chunk) (ctx->m + 5 * c, ctx->data1,
+                                                 ctx->stride1, ctx->data2,
+                                                 ctx->stride2, ctx->n, c);
+    }
+
+  return GSL_SUCCESS;
+}
+
+static void
+FUNCTION (stats_parallel,comoments) (long double m[5], const BASE data1[],
+                                     const size_t stride1,
+                                     const BASE data2[],
+                                     const size_t stride2, const size_t n,
+                                     const size_t nthreads)
+{
+  /* finds the means and sums of squares and products of each chunk, in
+     nthreads threads when they can be stored, and merges them in
+     order */
+
+  const size_t nchunks = (n + PARALLEL_CHUNK - 1) / PARALLEL_CHUNK;
+  FUNCTION (stats_parallel,ctx) ctx;
+  size_t c;
+  int k;
+
+  ctx.data1 = data1;
+  ctx.stride1 = stride1;
+  ctx.data2 = data2;
+  ctx.stride2 = stride2;
+  ctx.n = n;
+  ctx.m = NULL;
+
+  if (nthreads > 1 && nchunks > 1)
+    {
+      ctx.m = (long double *) malloc (5 * nchunks * sizeof (long double));
+
+      if (ctx.m != NULL)
+        {
+          parallel_for (nthreads, nchunks,
+                        FUNCTION (stats_parallel,comoments_range), &ctx);
+        }
+    }
+
+  for (k = 0; k < 5; k++)
+    m[k] = 0;
+
+  for (c = 0; c < nchunks; c++)
+    {
+      long double mc[5];
+
+      if (ctx.m != NULL)
+        {
+          for (k = 0; k < 5; k++)
+            mc[k] = ctx.m[5 * c + k];
+        }
+      else
+        {
+          FUNCTION (stats_parallel,comoments_chunk) (mc, data1, stride1,
+                                                     data2, stride2, n, c);
+        }
+
+      if (c == 0)
+        {
+          for (k = 0; k < 5; k++)
+            m[k] = mc[k];
+        }
+      else
+        {
+          comoments_merge (m, c * PARALLEL_CHUNK, mc,
+                           GSL_MIN (n - c * PARALLEL_CHUNK, PARALLEL_CHUNK));
+        }
+    }
+
+  free (ctx.m);
+}
+
+double
+FUNCTION (gsl_stats,mean_parallel) (const BASE data[], const size_t stride,
+                                    const size_t n, const size_t nthreads)
+{
+  long double m[4];
+  BASE min, max;
+
+  FUNCTION (stats_parallel,moments) (m, &min, &max, data, stride, n, nthreads);
+
+  return m[0];
+}
+
+double
+FUNCTION (gsl_stats,variance_parallel) (const BASE data[], const size_t stride,
+                                        const size_t n, const size_t nthreads)
+{
+  long double m[4];
+  BASE min, max;
+
+  FUNCTION (stats_parallel,moments) (m, &min, &max, data, stride, n, nthreads);
+
+  return m[1] / (n - 1);
+}
+
+double
+FUNCTION (gsl_stats,sd_parallel) (const BASE data[], const size_t stride,
+                                  const size_t n, const size_t nthreads)
+{
+  const double variance = FUNCTION (gsl_stats,variance_parallel) (data, stride,
+                                                                  n, nthreads);
+
+  return sqrt (variance);
+}
+
+void
+FUNCTION (gsl_stats,minmax_parallel) (BASE * min, BASE * max,
+                                      const BASE data[], const size_t stride,
+                                      const size_t n, const size_t nthreads)
+{
+  FUNCTION (stats_parallel,minmax) (min, max, data, stride, n, nthreads);
+}
+
+void
+FUNCTION (gsl_stats,moments_parallel) (double * mean, double * M2,
+                                       double * M3, double * M4,
+                                       BASE * min, BASE * max,
+                                       const BASE data[], const size_t stride,
+                                       const size_t n, const size_t nthreads)
+{
+  long double m[4];
+
+  FUNCTION (stats_parallel,moments) (m, min, max, data, stride, n, nthreads);
+
+  *mean = m[0];
+  *M2 = m[1];
+  *M3 = m[2];
+  *M4 = m[3];
+}
+
+double
+FUNCTION (gsl_stats,covariance_parallel) (const BASE data1[],
+                                          const size_t stride1,
+                                          const BASE data2[],
+                                          const size_t stride2,
+                                          const size_t n,
+                                          const size_t nthreads)
+{
+  long double m[5];
+
+  FUNCTION (stats_parallel,comoments) (m, data1, stride1, data2, stride2, n,
+                                       nthreads);
+
+  return m[4] / (n - 1);
+}
+
+double
+FUNCTION (gsl_stats,correlation_parallel) (const BASE data1[],
+                                           const size_t stride1,
+                                           const BASE data2[],
+                                           const size_t stride2,
+                                           const size_t n,
+                                           const size_t nthreads)
+{
+  long double m[5];
+
+  FUNCTION (stats_parallel,comoments) (m, data1, stride1, data2, stride2, n,
+                                       nthreads);
+
+  return m[4] / (sqrt (m[2]) * sqrt (m[3]));
+}
+
+#undef PARALLEL_REAL
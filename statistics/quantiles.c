@@ -1,6 +1,20 @@
 #include <config.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_statistics.h>
 
+/* The order statistics needed for the quantiles p[] of n values, two
+   for each quantile as in gsl_stats_quantile_from_sorted_data, so
+   that the m-th of them is the lower or upper one of p[m/2].  They are
+   in increasing order when p[] is. */
+
+static size_t
+quantile_rank (const double p[], const size_t n, const size_t m)
+{
+  const size_t lhs = (size_t) (p[m / 2] * (n - 1)) ;
+
+  return (m % 2 == 1 && lhs < n - 1) ? lhs + 1 : lhs ;
+}
+
 #define BASE_LONG_DOUBLE
 #include "templates_on.h"
 #include "quantiles_source.c"
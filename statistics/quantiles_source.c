@@ -43,3 +43,67 @@ FUNCTION(gsl_stats,quantile_from_sorted_data) (const BASE sorted_data[],
 
   return result ;
 }
+
+/* Put the order statistics rlo..rhi-1 of quantile_rank, which lie in
+   lo..hi-1, into place by selecting the middle one and dividing the
+   rest at it. */
+
+static void
+FUNCTION(quantiles,select) (BASE data[], const size_t stride,
+                            const size_t n, const double p[],
+                            const size_t lo, const size_t hi,
+                            const size_t rlo, const size_t rhi)
+{
+  size_t m, k, a, b ;
+
+  if (rlo >= rhi)
+    return ;
+
+  m = rlo + (rhi - rlo) / 2 ;
+  k = quantile_rank (p, n, m) ;
+
+  FUNCTION(gsl_stats,select) (data + lo * stride, stride, hi - lo, k - lo) ;
+
+  for (a = m; a > rlo && quantile_rank (p, n, a - 1) >= k; a--)
+    ;
+
+  for (b = m + 1; b < rhi && quantile_rank (p, n, b) <= k; b++)
+    ;
+
+  FUNCTION(quantiles,select) (data, stride, n, p, lo, k, rlo, a) ;
+  FUNCTION(quantiles,select) (data, stride, n, p, k + 1, hi, b, rhi) ;
+}
+
+int
+FUNCTION(gsl_stats,quantiles) (BASE data[], const size_t stride,
+                               const size_t n, const double p[],
+                               const size_t np, double q[])
+{
+  size_t i ;
+
+  for (i = 0; i < np; i++)
+    {
+      if (!(p[i] >= 0.0 && p[i] <= 1.0))
+        {
+          GSL_ERROR ("p must lie in the range [0,1]", GSL_EDOM) ;
+        }
+
+      if (i > 0 && p[i] < p[i - 1])
+        {
+          GSL_ERROR ("p must be in increasing order", GSL_EINVAL) ;
+        }
+    }
+
+  if (n > 0)
+    FUNCTION(quantiles,select) (data, stride, n, p, 0, n, 0, 2 * np) ;
+
+  /* the order statistics are now in place, as if the data were
+     sorted */
+
+  for (i = 0; i < np; i++)
+    {
+      q[i] = FUNCTION(gsl_stats,quantile_from_sorted_data) (data, stride, n, p[i]) ;
+    }
+
+  return GSL_SUCCESS ;
+}
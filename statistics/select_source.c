@@ -0,0 +1,140 @@
+/* statistics/select_source.c
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Selection of the k-th smallest element by the algorithm of Floyd
+   and Rivest, Comm. ACM 18, 173 (1975), in the form given by Kiwiel,
+   Theor. Comp. Sci. 347, 214 (2005).  For large ranges the pivot is
+   first selected from a sample around the expected position of the
+   k-th element, so that each partition leaves few elements besides
+   those near k, and the expected number of comparisons is n +
+   min(k, n-k) + o(n).  If the partitions shrink the range too slowly
+   the remaining range is sorted instead, which bounds the worst case
+   by O(n log n). */
+
+#ifndef SELECT_SAMPLE
+#define SELECT_SAMPLE 600
+#endif
+
+#define SWAP(a,b) do { const BASE tmp = data[(a) * stride]; \
+                       data[(a) * stride] = data[(b) * stride]; \
+                       data[(b) * stride] = tmp; } while (0)
+
+static void
+FUNCTION(select,range) (BASE data[], const size_t stride, size_t left,
+                        size_t right, const size_t k, int depth)
+{
+  while (right > left)
+    {
+      BASE t;
+      size_t i, j;
+
+      if (depth-- == 0)
+        {
+          TYPE(gsl_sort) (data + left * stride, stride, right - left + 1);
+          return;
+        }
+
+      if (right - left > SELECT_SAMPLE)
+        {
+          const double n = right - left + 1;
+          const double m = k - left + 1;
+          const double z = log (n);
+          const double s = 0.5 * exp (2 * z / 3);
+          const double sd = 0.5 * sqrt (z * s * (n - s) / n) * (m < n / 2 ? -1 : 1);
+          const double lo = k - m * s / n + sd;
+          const double hi = k + (n - m) * s / n + sd;
+          size_t sleft = (lo > left) ? (size_t) lo : left;
+          size_t sright = (hi < right) ? (size_t) hi : right;
+
+          if (sleft > k)
+            sleft = k;
+
+          if (sright < k)
+            sright = k;
+
+          FUNCTION(select,range) (data, stride, sleft, sright, k, depth);
+        }
+
+      /* partition around t = data[k], with the smaller of t and
+         data[right] at the left end and the larger at the right end as
+         sentinels */
+
+      t = data[k * stride];
+      i = left;
+      j = right;
+
+      SWAP (left, k);
+
+      if (data[right * stride] > t)
+        SWAP (right, left);
+
+      while (i < j)
+        {
+          SWAP (i, j);
+          i++;
+          j--;
+
+          while (data[i * stride] < t)
+            i++;
+
+          while (data[j * stride] > t)
+            j--;
+        }
+
+      if (data[left * stride] == t)
+        {
+          SWAP (left, j);
+        }
+      else
+        {
+          j++;
+          SWAP (j, right);
+        }
+
+      /* t is now at j, with no larger elements before it and no
+         smaller ones after it */
+
+      if (j == k)
+        return;
+      else if (j < k)
+        left = j + 1;
+      else
+        right = j - 1;
+    }
+}
+
+#undef SWAP
+
+BASE
+FUNCTION(gsl_stats,select) (BASE data[], const size_t stride,
+                            const size_t n, const size_t k)
+{
+  size_t m = n;
+  int depth = 8;
+
+  if (k >= n)
+    {
+      GSL_ERROR_VAL ("k must be less than n", GSL_EINVAL, 0);
+    }
+
+  while (m >>= 1)
+    depth += 2;
+
+  FUNCTION(select,range) (data, stride, 0, n - 1, k, depth);
+
+  return data[k * stride];
+}
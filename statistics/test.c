@@ -31,6 +31,223 @@
 
 int test_nist (void);
 
+/* allocates n values at the given stride, with the top 12 bits of
+   successive values of a 32-bit LCG with state *x times scale, so
+   that they take 4096 equally spaced values */
+
+static double *
+test_alloc_data (const size_t n, const size_t stride, const double scale,
+                 unsigned long int * x)
+{
+  double * data = (double *) malloc (n * stride * sizeof (double));
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      *x = (*x * 69069UL + 1UL) & 0xffffffffUL;
+      data[i * stride] = scale * (double) (*x >> 20);
+    }
+
+  return data;
+}
+
+/* selection over ranges long enough to use the samples of the
+   Floyd-Rivest algorithm, with many repeated values, sorted and
+   reversed data and constant data */
+
+void
+test_select (void)
+{
+  const size_t n = 20011, stride = 2;
+  const double p[] = { 0.0, 1e-4, 0.01, 0.25, 0.5, 0.5, 0.75, 0.999, 1.0 };
+  const size_t np = sizeof (p) / sizeof (p[0]);
+  double * work = (double *) malloc (n * stride * sizeof (double));
+  double q[9];
+  unsigned long int x = 1;
+  size_t i, k;
+  int c;
+
+  for (c = 0; c < 4; c++)
+    {
+      double * data = test_alloc_data (n, stride, 1.0, &x);
+      int status = 0;
+
+      if (c == 3)
+        {
+          for (i = 0; i < n; i++)
+            data[i * stride] = 1.0;
+        }
+
+      if (c > 0)
+        gsl_sort (data, stride, n);
+
+      if (c == 2)
+        {
+          for (i = 0; i < n / 2; i++)
+            {
+              double t = data[i * stride];
+              data[i * stride] = data[(n - 1 - i) * stride];
+              data[(n - 1 - i) * stride] = t;
+            }
+        }
+
+      for (k = 0; k < n; k += 997)
+        {
+          for (i = 0; i < n; i++)
+            work[i * stride] = data[i * stride];
+
+          gsl_stats_select (work, stride, n, k);
+
+          for (i = 0; i < n; i++)
+            {
+              if (i < k)
+                status |= (work[i * stride] > work[k * stride]);
+              else if (i > k)
+                status |= (work[i * stride] < work[k * stride]);
+            }
+        }
+
+      for (i = 0; i < n; i++)
+        work[i * stride] = data[i * stride];
+
+      status |= gsl_stats_quantiles (work, stride, n, p, np, q);
+
+      gsl_sort (data, stride, n);
+
+      for (k = 0; k < np; k++)
+        status |= (q[k] != gsl_stats_quantile_from_sorted_data (data, stride, n, p[k]));
+
+      gsl_test (status, "gsl_stats_select and gsl_stats_quantiles, n=%u, case %d",
+                (unsigned int) n, c);
+
+      free (data);
+    }
+
+  free (work);
+}
+
+/* moments over many blocks, against the separate functions and
+   against the same data offset by 1e8, whose sums of powers of the
+   deviations should be unchanged */
+
+void
+test_moments (void)
+{
+  const size_t n = 100003, stride = 3;
+  const double offset = 1e8;
+  double mean, M2, M3, M4, min, max;
+  double mean1, M21, M31, M41, min1, max1;
+  double sd;
+  unsigned long int x = 1;
+  double * data = test_alloc_data (n, stride, 1.0 / 4096.0, &x);
+  size_t i;
+
+  gsl_stats_moments (&mean, &M2, &M3, &M4, &min, &max, data, stride, n);
+
+  sd = gsl_stats_sd (data, stride, n);
+
+  gsl_test_rel (mean, gsl_stats_mean (data, stride, n), 1e-12,
+                "gsl_stats_moments mean, n=%u", (unsigned int) n);
+  gsl_test_rel (M2 / (n - 1), gsl_stats_variance (data, stride, n), 1e-12,
+                "gsl_stats_moments M2, n=%u", (unsigned int) n);
+  gsl_test_abs ((M3 / n) / (sd * sd * sd), gsl_stats_skew (data, stride, n),
+                1e-12, "gsl_stats_moments M3, n=%u", (unsigned int) n);
+  gsl_test_rel ((M4 / n) / (sd * sd * sd * sd) - 3.0,
+                gsl_stats_kurtosis (data, stride, n), 1e-12,
+                "gsl_stats_moments M4, n=%u", (unsigned int) n);
+  gsl_test (min != gsl_stats_min (data, stride, n)
+            || max != gsl_stats_max (data, stride, n),
+            "gsl_stats_moments minmax, n=%u", (unsigned int) n);
+
+  for (i = 0; i < n; i++)
+    data[i * stride] += offset;
+
+  gsl_stats_moments (&mean1, &M21, &M31, &M41, &min1, &max1, data, stride, n);
+
+  gsl_test_abs (mean1 - offset, mean, 1e-7,
+                "gsl_stats_moments mean with offset");
+  gsl_test_rel (M21, M2, 1e-10, "gsl_stats_moments M2 with offset");
+  gsl_test_abs (M31 / n, M3 / n, 1e-10, "gsl_stats_moments M3 with offset");
+  gsl_test_rel (M41, M4, 1e-10, "gsl_stats_moments M4 with offset");
+  gsl_test (min1 != min + offset || max1 != max + offset,
+            "gsl_stats_moments minmax with offset");
+
+  gsl_stats_moments (&mean1, &M21, &M31, &M41, &min1, &max1, data, stride, 1);
+
+  gsl_test (mean1 != data[0] || M21 != 0 || M31 != 0 || M41 != 0
+            || min1 != data[0] || max1 != data[0], "gsl_stats_moments, n=1");
+
+  free (data);
+}
+
+/* threaded reductions over many chunks, which should give the same
+   bits for any number of threads, and agree with the serial
+   functions */
+
+void
+test_parallel (void)
+{
+  const size_t n = 5 * 16384 + 123, stride = 2;
+  const size_t nthreads[] = { 1, 2, 3, 8 };
+  double r0[13], r[13];
+  unsigned long int u = 1;
+  double * x = test_alloc_data (n, stride, 1.0 / 4096.0, &u);
+  double * y = test_alloc_data (n, 1, 1.0 / 4096.0, &u);
+  size_t i, t;
+  int k;
+
+  for (i = 0; i < n; i++)
+    {
+      y[i] += x[i * stride];
+      x[i * stride] += 1e6;
+    }
+
+  for (t = 0; t < sizeof (nthreads) / sizeof (nthreads[0]); t++)
+    {
+      int status = 0;
+
+      r[0] = gsl_stats_mean_parallel (x, stride, n, nthreads[t]);
+      r[1] = gsl_stats_variance_parallel (x, stride, n, nthreads[t]);
+      r[2] = gsl_stats_sd_parallel (x, stride, n, nthreads[t]);
+      r[3] = gsl_stats_covariance_parallel (x, stride, y, 1, n, nthreads[t]);
+      r[4] = gsl_stats_correlation_parallel (x, stride, y, 1, n, nthreads[t]);
+      gsl_stats_minmax_parallel (&r[5], &r[6], x, stride, n, nthreads[t]);
+      gsl_stats_moments_parallel (&r[7], &r[8], &r[9], &r[10], &r[11], &r[12],
+                                  x, stride, n, nthreads[t]);
+
+      if (t == 0)
+        {
+          for (k = 0; k < 13; k++)
+            r0[k] = r[k];
+        }
+
+      for (k = 0; k < 13; k++)
+        status |= (memcmp (&r[k], &r0[k], sizeof (double)) != 0);
+
+      gsl_test (status, "gsl_stats_*_parallel, nthreads=%u reproducible",
+                (unsigned int) nthreads[t]);
+    }
+
+  gsl_test_rel (r0[0], gsl_stats_mean (x, stride, n), 1e-15,
+                "gsl_stats_mean_parallel");
+  gsl_test_rel (r0[1], gsl_stats_variance (x, stride, n), 1e-9,
+                "gsl_stats_variance_parallel");
+  gsl_test_rel (r0[2], gsl_stats_sd (x, stride, n), 1e-9,
+                "gsl_stats_sd_parallel");
+  gsl_test_rel (r0[3], gsl_stats_covariance (x, stride, y, 1, n), 1e-9,
+                "gsl_stats_covariance_parallel");
+  gsl_test_rel (r0[4], gsl_stats_correlation (x, stride, y, 1, n), 1e-9,
+                "gsl_stats_correlation_parallel");
+  gsl_test (r0[5] != gsl_stats_min (x, stride, n)
+            || r0[6] != gsl_stats_max (x, stride, n),
+            "gsl_stats_minmax_parallel");
+  gsl_test (r0[11] != r0[5] || r0[12] != r0[6],
+            "gsl_stats_moments_parallel, min and max");
+
+  free (y);
+  free (x);
+}
+
 /* Test program for mean.c.  JimDavies 7.96 */
 
 #define BASE_LONG_DOUBLE
@@ -125,6 +342,9 @@ main (void)
       test_char_func (s1,s2);
     }
 
+  test_select();
+  test_moments();
+  test_parallel();
   test_nist();
 
   exit (gsl_test_summary ());
@@ -199,6 +199,19 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
     gsl_test_rel (r, expected, rel, NAME(gsl_stats) "_correlation");
   }
 
+  {
+    double mean = FUNCTION(gsl_stats,mean_parallel) (groupa, stridea, na, 2);
+    double var = FUNCTION(gsl_stats,variance_parallel) (groupa, stridea, na, 2);
+    double c = FUNCTION(gsl_stats,covariance_parallel) (groupa, stridea, groupb, strideb, na, 2);
+    double r = FUNCTION(gsl_stats,correlation_parallel) (groupa, stridea, groupb, strideb, na, 2);
+    gsl_test_rel (mean, FUNCTION(gsl_stats,mean) (groupa, stridea, na), rel,
+                  NAME(gsl_stats) "_mean_parallel");
+    gsl_test_rel (var, FUNCTION(gsl_stats,variance) (groupa, stridea, na), rel,
+                  NAME(gsl_stats) "_variance_parallel");
+    gsl_test_rel (c, -0.000139021538461539, rel, NAME(gsl_stats) "_covariance_parallel");
+    gsl_test_rel (r, -0.112322712666074171, rel, NAME(gsl_stats) "_correlation_parallel");
+  }
+
   {
     double *work = malloc(2 * na * sizeof(double));
     double r = FUNCTION(gsl_stats,spearman) (groupa, stridea, groupb, strideb, nb, work);
@@ -280,6 +293,27 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
                min_index, expected_min_index);
   }
 
+  {
+    double mean, M2, M3, M4, skew, kurt;
+    BASE min, max;
+
+    FUNCTION(gsl_stats,moments) (&mean, &M2, &M3, &M4, &min, &max, groupa, stridea, na);
+
+    skew = (M3 / na) / pow (M2 / (na - 1), 1.5);
+    kurt = (M4 / na) / pow (M2 / (na - 1), 2.0) - 3.0;
+
+    gsl_test_rel (mean, 0.0728, rel, NAME(gsl_stats) "_moments mean");
+    gsl_test_rel (M2, 1.59372400000000e-02, rel, NAME(gsl_stats) "_moments M2");
+    gsl_test_rel (skew, 0.0954642051479004, rel, NAME(gsl_stats) "_moments skew");
+    gsl_test_rel (kurt, -1.38583851548909, rel, NAME(gsl_stats) "_moments kurtosis");
+    gsl_test (max != (BASE)0.1331,
+              NAME(gsl_stats) "_moments max (" OUT_FORMAT " observed vs " OUT_FORMAT " expected)",
+              max, (BASE)0.1331);
+    gsl_test (min != (BASE)0.0242,
+              NAME(gsl_stats) "_moments min (" OUT_FORMAT " observed vs " OUT_FORMAT " expected)",
+              min, (BASE)0.0242);
+  }
+
 
   sorted = (BASE *) malloc(stridea * na * sizeof(BASE)) ;
   
@@ -332,6 +366,50 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
 
   }
 
+  {
+    /* selection without sorting, on a copy of the data */
+
+    BASE * work = (BASE *) malloc (stridea * na * sizeof(BASE));
+    const double p[] = { 0.0, 0.1, 0.25, 0.5, 0.5, 0.77, 0.9, 1.0 };
+    double q[8];
+    size_t k;
+    int status = 0;
+
+    for (i = 0 ; i < na ; i++)
+      work[stridea * i] = groupa[stridea * i] ;
+
+    gsl_test_rel (FUNCTION(gsl_stats,median)(work, stridea, na), 0.07505, rel,
+                  NAME(gsl_stats) "_median (even)");
+
+    for (i = 0 ; i < na ; i++)
+      work[stridea * i] = groupa[stridea * i] ;
+
+    gsl_test_rel (FUNCTION(gsl_stats,median)(work, stridea, na - 1), 0.0773, rel,
+                  NAME(gsl_stats) "_median (odd)");
+
+    for (k = 0 ; k < na ; k++)
+      {
+        for (i = 0 ; i < na ; i++)
+          work[stridea * i] = groupa[stridea * i] ;
+
+        status |= (FUNCTION(gsl_stats,select)(work, stridea, na, k) != sorted[stridea * k]);
+      }
+
+    gsl_test (status, NAME(gsl_stats) "_select");
+
+    for (i = 0 ; i < na ; i++)
+      work[stridea * i] = groupa[stridea * i] ;
+
+    status = FUNCTION(gsl_stats,quantiles)(work, stridea, na, p, 8, q);
+
+    for (k = 0 ; k < 8 ; k++)
+      status |= (q[k] != FUNCTION(gsl_stats,quantile_from_sorted_data)(sorted, stridea, na, p[k]));
+
+    gsl_test (status, NAME(gsl_stats) "_quantiles");
+
+    free (work);
+  }
+
   /* Test for IEEE handling - set third element to NaN */
 
   groupa [3*stridea] = GSL_NAN;
@@ -416,6 +494,16 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
                min_index, expected_min_index);
   }
 
+  {
+    double mean, M2, M3, M4;
+    BASE min, max;
+
+    FUNCTION(gsl_stats,moments) (&mean, &M2, &M3, &M4, &min, &max, groupa, stridea, na);
+
+    gsl_test (!isnan(mean) || !isnan(M2), NAME(gsl_stats) "_moments NaN");
+    gsl_test (!isnan(min) || !isnan(max), NAME(gsl_stats) "_moments minmax NaN");
+  }
+
   free (sorted);
   free (groupa);
   free (groupb);
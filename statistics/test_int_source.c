@@ -127,6 +127,19 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
     gsl_test_rel (r, expected, rel, NAME(gsl_stats) "_correlation");
   }
 
+  {
+    double mean = FUNCTION(gsl_stats,mean_parallel) (igroupa, stridea, ina, 2);
+    double var = FUNCTION(gsl_stats,variance_parallel) (igroupa, stridea, ina, 2);
+    double c = FUNCTION(gsl_stats,covariance_parallel) (igroupa, stridea, igroupb, strideb, ina, 2);
+    double r = FUNCTION(gsl_stats,correlation_parallel) (igroupa, stridea, igroupb, strideb, ina, 2);
+    gsl_test_rel (mean, FUNCTION(gsl_stats,mean) (igroupa, stridea, ina), rel,
+                  NAME(gsl_stats) "_mean_parallel");
+    gsl_test_rel (var, FUNCTION(gsl_stats,variance) (igroupa, stridea, ina), rel,
+                  NAME(gsl_stats) "_variance_parallel");
+    gsl_test_rel (c, 14.5263157894737, rel, NAME(gsl_stats) "_covariance_parallel");
+    gsl_test_rel (r, 0.793090350710101, rel, NAME(gsl_stats) "_correlation_parallel");
+  }
+
   {
     double *work = malloc(2 * ina * sizeof(double));
     double r = FUNCTION(gsl_stats,spearman) (igroupa, stridea, igroupb, strideb, inb, work);
@@ -207,6 +220,27 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
                min_index, expected_min_index);
   }
 
+  {
+    double mean, M2, M3, M4, skew, kurt;
+    BASE min, max;
+
+    FUNCTION(gsl_stats,moments) (&mean, &M2, &M3, &M4, &min, &max, igroupa, stridea, ina);
+
+    skew = (M3 / ina) / pow (M2 / (ina - 1), 1.5);
+    kurt = (M4 / ina) / pow (M2 / (ina - 1), 2.0) - 3.0;
+
+    gsl_test_rel (mean, 17.0, rel, NAME(gsl_stats) "_moments mean");
+    gsl_test_rel (M2, 274.0, rel, NAME(gsl_stats) "_moments M2");
+    gsl_test_rel (skew, -0.909355923168064, rel, NAME(gsl_stats) "_moments skew");
+    gsl_test_rel (kurt, -0.233692524908094, rel, NAME(gsl_stats) "_moments kurtosis");
+    gsl_test (max != 22,
+              NAME(gsl_stats) "_moments max (" OUT_FORMAT " observed vs " OUT_FORMAT " expected)",
+              max, 22);
+    gsl_test (min != 8,
+              NAME(gsl_stats) "_moments min (" OUT_FORMAT " observed vs " OUT_FORMAT " expected)",
+              min, 8);
+  }
+
 
   sorted = (BASE *) malloc(stridea * ina * sizeof(BASE)) ;
 
@@ -259,6 +293,50 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
                   NAME(gsl_stats) "_quantile_from_sorted_data (50, odd)");
   }
 
+  {
+    /* selection without sorting, on a copy of the data */
+
+    BASE * work = (BASE *) malloc (stridea * ina * sizeof(BASE));
+    const double p[] = { 0.0, 0.1, 0.25, 0.5, 0.5, 0.77, 0.9, 1.0 };
+    double q[8];
+    size_t k;
+    int status = 0;
+
+    for (i = 0 ; i < ina ; i++)
+      work[stridea * i] = igroupa[stridea * i] ;
+
+    gsl_test_rel (FUNCTION(gsl_stats,median)(work, stridea, ina), 18, rel,
+                  NAME(gsl_stats) "_median (even)");
+
+    for (i = 0 ; i < ina ; i++)
+      work[stridea * i] = igroupa[stridea * i] ;
+
+    gsl_test_rel (FUNCTION(gsl_stats,median)(work, stridea, ina - 1), 18, rel,
+                  NAME(gsl_stats) "_median (odd)");
+
+    for (k = 0 ; k < ina ; k++)
+      {
+        for (i = 0 ; i < ina ; i++)
+          work[stridea * i] = igroupa[stridea * i] ;
+
+        status |= (FUNCTION(gsl_stats,select)(work, stridea, ina, k) != sorted[stridea * k]);
+      }
+
+    gsl_test (status, NAME(gsl_stats) "_select");
+
+    for (i = 0 ; i < ina ; i++)
+      work[stridea * i] = igroupa[stridea * i] ;
+
+    status = FUNCTION(gsl_stats,quantiles)(work, stridea, ina, p, 8, q);
+
+    for (k = 0 ; k < 8 ; k++)
+      status |= (q[k] != FUNCTION(gsl_stats,quantile_from_sorted_data)(sorted, stridea, ina, p[k]));
+
+    gsl_test (status, NAME(gsl_stats) "_quantiles");
+
+    free (work);
+  }
+
   free (sorted);
   free (igroupa);
   free (igroupb);
@@ -0,0 +1,19 @@
+/* GSL_VECTORIZE marks the functions whose loops should be vectorized,
+   for the internal use of the library.  It follows the declarator of
+   a separate prototype.  With GCC-compatible compilers on x86 the
+   functions are cloned for AVX-512, AVX2 and the baseline (SSE2)
+   instruction set, with the clone chosen at run time, and built with
+   loop vectorization enabled whatever the global optimization
+   level. */
+
+#ifndef GSL_VECTORIZE
+#if defined(HAVE_ATTRIBUTE_TARGET_CLONES) && defined(HAVE_ATTRIBUTE_OPTIMIZE)
+#define GSL_VECTORIZE __attribute__ ((target_clones ("avx512f", "avx2", "default"), optimize ("tree-vectorize", "vect-cost-model=dynamic")))
+#elif defined(HAVE_ATTRIBUTE_TARGET_CLONES)
+#define GSL_VECTORIZE __attribute__ ((target_clones ("avx512f", "avx2", "default")))
+#elif defined(HAVE_ATTRIBUTE_OPTIMIZE)
+#define GSL_VECTORIZE __attribute__ ((optimize ("tree-vectorize", "vect-cost-model=dynamic")))
+#else
+#define GSL_VECTORIZE
+#endif
+#endif